@@ -21,14 +21,65 @@
  *
  */
 
+#include <pybind11/numpy.h>
+
 #include <geode/basic/attribute.h>
+#include <geode/basic/range.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Copy the values of the first nb_elements elements into an array.
+         */
+        template < typename T >
+        pybind11::array_t< T > attribute_values_array(
+            const ReadOnlyAttribute< T >& attribute, index_t nb_elements )
+        {
+            pybind11::array_t< T > result( nb_elements );
+            auto values = result.template mutable_unchecked< 1 >();
+            pybind11::gil_scoped_release release;
+            for( const auto e : Range{ nb_elements } )
+            {
+                values( e ) = attribute.value( e );
+            }
+            return result;
+        }
+
+        /*!
+         * Set the values of all the nb_elements elements from an array.
+         */
+        template < typename T >
+        void set_attribute_values_array( VariableAttribute< T >& attribute,
+            pybind11::array_t< T, pybind11::array::c_style
+                                      | pybind11::array::forcecast > array,
+            index_t nb_elements )
+        {
+            OPENGEODE_EXCEPTION( array.ndim() == 1,
+                "[VariableAttribute::set_values_array] Array should be one "
+                "dimensional" );
+            OPENGEODE_EXCEPTION(
+                static_cast< size_t >( array.shape( 0 ) ) == nb_elements,
+                "[VariableAttribute::set_values_array] Array should have ",
+                nb_elements, " values" );
+            const auto values = array.template unchecked< 1 >();
+            pybind11::gil_scoped_release release;
+            for( const auto e : Range{ nb_elements } )
+            {
+                attribute.set_value( e, values( e ) );
+            }
+        }
+    } // namespace detail
+} // namespace geode
 
 #define PYTHON_ATTRIBUTE_CLASS( type, name )                                   \
     const auto read##name = std::string{ "ReadOnlyAttribute" } + #name;        \
     pybind11::class_< ReadOnlyAttribute< type >, AttributeBase,                \
         std::shared_ptr< ReadOnlyAttribute< type > > >(                        \
         module, read##name.c_str() )                                           \
-        .def( "value", &ReadOnlyAttribute< type >::value );                    \
+        .def( "value", &ReadOnlyAttribute< type >::value )                     \
+        .def( "values_array", &detail::attribute_values_array< type > );       \
     const auto constant##name = std::string{ "ConstantAttribute" } + #name;    \
     pybind11::class_< ConstantAttribute< type >, ReadOnlyAttribute< type >,    \
         std::shared_ptr< ConstantAttribute< type > > >(                        \
@@ -43,6 +94,8 @@
         std::shared_ptr< VariableAttribute< type > > >(                        \
         module, variable##name.c_str() )                                       \
         .def( "set_value", &VariableAttribute< type >::set_value )             \
+        .def( "set_values_array",                                              \
+            &detail::set_attribute_values_array< type > )                      \
         .def( "default_value", &VariableAttribute< type >::default_value );    \
     const auto sparse##name = std::string{ "SparseAttribute" } + #name;        \
     pybind11::class_< SparseAttribute< type >, ReadOnlyAttribute< type >,      \
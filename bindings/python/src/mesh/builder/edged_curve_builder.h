@@ -33,6 +33,9 @@
                 EdgedCurve< dimension >& ) )                                   \
                 & EdgedCurveBuilder##dimension##D::create )                    \
         .def( "set_point", &EdgedCurveBuilder##dimension##D::set_point )       \
+        .def( "create_points",                                                 \
+            &detail::create_points< dimension,                                 \
+                EdgedCurveBuilder##dimension##D > )                            \
         .def( "create_point", &EdgedCurveBuilder##dimension##D::create_point )
 
 namespace geode
@@ -33,6 +33,9 @@
                           PointSet< dimension >& ) )                           \
                           & PointSetBuilder##dimension##D::create )            \
         .def( "set_point", &PointSetBuilder##dimension##D::set_point )         \
+        .def( "create_points",                                                 \
+            &detail::create_points< dimension,                                 \
+                PointSetBuilder##dimension##D > )                              \
         .def( "create_point", &PointSetBuilder##dimension##D::create_point )
 
 namespace geode
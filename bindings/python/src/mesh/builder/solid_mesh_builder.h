@@ -33,6 +33,9 @@
                 SolidMesh< dimension >& ) )                                    \
                 & SolidMeshBuilder##dimension##D::create )                     \
         .def( "set_point", &SolidMeshBuilder##dimension##D::set_point )        \
+        .def( "create_points",                                                 \
+            &detail::create_points< dimension,                                 \
+                SolidMeshBuilder##dimension##D > )                             \
         .def( "create_point", &SolidMeshBuilder##dimension##D::create_point )  \
         .def( "create_polyhedron",                                             \
             &SolidMeshBuilder##dimension##D::create_polyhedron )               \
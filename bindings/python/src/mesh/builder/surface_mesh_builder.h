@@ -35,6 +35,9 @@
                 PolygonalSurface< dimension >& ) )                             \
                 & SurfaceMeshBuilder##dimension##D::create )                   \
         .def( "set_point", &SurfaceMeshBuilder##dimension##D::set_point )      \
+        .def( "create_points",                                                 \
+            &detail::create_points< dimension,                                 \
+                SurfaceMeshBuilder##dimension##D > )                           \
         .def(                                                                  \
             "create_point", &SurfaceMeshBuilder##dimension##D::create_point )  \
         .def( "create_polygon",                                                \
@@ -33,7 +33,8 @@
                 TetrahedralSolid< dimension >& ) )                             \
                 & TetrahedralSolidBuilder##dimension##D::create )              \
         .def( "create_tetrahedron",                                            \
-            &TetrahedralSolidBuilder##dimension##D::create_tetrahedron )
+            &TetrahedralSolidBuilder##dimension##D::create_tetrahedron )       \
+        .def( "create_tetrahedra", &detail::create_tetrahedra< dimension > )
 
 namespace geode
 {
@@ -34,7 +34,8 @@
                           TriangulatedSurface< dimension >& ) )                \
                           & TriangulatedSurfaceBuilder##dimension##D::create ) \
         .def( "create_triangle",                                               \
-            &TriangulatedSurfaceBuilder##dimension##D::create_triangle )
+            &TriangulatedSurfaceBuilder##dimension##D::create_triangle )       \
+        .def( "create_triangles", &detail::create_triangles< dimension > )
 
 namespace geode
 {
@@ -33,6 +33,8 @@
                           & EdgedCurve##dimension##D::create )                 \
         .def( "clone", &EdgedCurve##dimension##D::clone )                      \
         .def( "point", &EdgedCurve##dimension##D::point )                      \
+        .def( "points_array",                                                  \
+            &detail::points_array< dimension, EdgedCurve##dimension##D > )     \
         .def( "edge_length", &EdgedCurve##dimension##D::edge_length )          \
         .def( "edge_barycenter", &EdgedCurve##dimension##D::edge_barycenter )  \
         .def( "bounding_box", &EdgedCurve##dimension##D::bounding_box )
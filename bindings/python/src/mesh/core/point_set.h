@@ -36,6 +36,8 @@
                           & PointSet##dimension##D::create )                   \
         .def( "clone", &PointSet##dimension##D::clone )                        \
         .def( "point", &PointSet##dimension##D::point )                        \
+        .def( "points_array",                                                  \
+            &detail::points_array< dimension, PointSet##dimension##D > )       \
         .def( "bounding_box", &PointSet##dimension##D::bounding_box )
 
 namespace geode
@@ -33,6 +33,8 @@
                           & SolidMesh##dimension##D::create )                  \
         .def( "clone", &SolidMesh##dimension##D::clone )                       \
         .def( "point", &SolidMesh##dimension##D::point )                       \
+        .def( "points_array",                                                  \
+            &detail::points_array< dimension, SolidMesh##dimension##D > )      \
         .def( "nb_polyhedra", &SolidMesh##dimension##D::nb_polyhedra )         \
         .def( "nb_facets", &SolidMesh##dimension##D::nb_facets )               \
         .def( "nb_edges", &SolidMesh##dimension##D::nb_edges )                 \
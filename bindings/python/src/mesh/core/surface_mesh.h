@@ -33,6 +33,8 @@
     pybind11::class_< SurfaceMesh##dimension##D, VertexSet >(                  \
         module, name##dimension.c_str() )                                      \
         .def( "point", &SurfaceMesh##dimension##D::point )                     \
+        .def( "points_array",                                                  \
+            &detail::points_array< dimension, SurfaceMesh##dimension##D > )    \
         .def( "nb_edges", &SurfaceMesh##dimension##D::nb_edges )               \
         .def( "nb_polygons", &SurfaceMesh##dimension##D::nb_polygons )         \
         .def( "nb_polygon_vertices",                                           \
@@ -31,7 +31,8 @@
         .def_static( "create",                                                 \
             ( std::unique_ptr< TetrahedralSolid##dimension##D >( * )() )       \
                 & TetrahedralSolid##dimension##D::create )                     \
-        .def( "clone", &TetrahedralSolid##dimension##D::clone )
+        .def( "clone", &TetrahedralSolid##dimension##D::clone )                \
+        .def( "tetrahedra_array", &detail::tetrahedra_array< dimension > )
 
 namespace geode
 {
@@ -31,7 +31,8 @@
         .def_static( "create",                                                 \
             ( std::unique_ptr< TriangulatedSurface##dimension##D >( * )() )    \
                 & TriangulatedSurface##dimension##D::create )                  \
-        .def( "clone", &TriangulatedSurface##dimension##D::clone )
+        .def( "clone", &TriangulatedSurface##dimension##D::clone )             \
+        .def( "triangles_array", &detail::triangles_array< dimension > )
 
 namespace geode
 {
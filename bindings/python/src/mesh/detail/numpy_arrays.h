@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <pybind11/numpy.h>
+
+#include <geode/basic/range.h>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.h>
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/core/triangulated_surface.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        using IndexArray = pybind11::array_t< index_t,
+            pybind11::array::c_style | pybind11::array::forcecast >;
+        using CoordinateArray = pybind11::array_t< double,
+            pybind11::array::c_style | pybind11::array::forcecast >;
+        /*!
+         * Vertex indices given from Python are read as signed integers, so
+         * that negative values are not silently wrapped around when cast to
+         * index_t.
+         */
+        using InputIndexArray = pybind11::array_t< std::int64_t,
+            pybind11::array::c_style | pybind11::array::forcecast >;
+
+        inline void check_array_shape(
+            const pybind11::array& array, index_t nb_columns )
+        {
+            OPENGEODE_EXCEPTION(
+                array.ndim() == 2
+                    && static_cast< index_t >( array.shape( 1 ) ) == nb_columns,
+                "[numpy] Array should have a (n, ", nb_columns, ") shape" );
+        }
+
+        /*!
+         * Check that all the values of a (n, m) vertex index array are
+         * vertices of the mesh before any of them is used.
+         */
+        template < typename Values >
+        void check_indices( const Values& values, index_t nb_vertices )
+        {
+            const auto max_index = static_cast< std::int64_t >( nb_vertices );
+            for( const auto r : Range{ values.shape( 0 ) } )
+            {
+                for( const auto c : Range{ values.shape( 1 ) } )
+                {
+                    const auto index = values( r, c );
+                    OPENGEODE_EXCEPTION( index >= 0 && index < max_index,
+                        "[numpy] Invalid vertex index: ", index );
+                }
+            }
+        }
+
+        /*!
+         * Copy all the mesh vertex coordinates into a (nb_vertices,
+         * dimension) array in a single pass.
+         */
+        template < index_t dimension, typename Mesh >
+        CoordinateArray points_array( const Mesh& mesh )
+        {
+            CoordinateArray result{ std::vector< size_t >{
+                mesh.nb_vertices(), dimension } };
+            auto values = result.mutable_unchecked< 2 >();
+            pybind11::gil_scoped_release release;
+            for( const auto v : Range{ mesh.nb_vertices() } )
+            {
+                const auto& point = mesh.point( v );
+                for( const auto d : Range{ dimension } )
+                {
+                    values( v, d ) = point.value( d );
+                }
+            }
+            return result;
+        }
+
+        /*!
+         * Copy all the triangle vertices into a (nb_triangles, 3) array.
+         */
+        template < index_t dimension >
+        IndexArray triangles_array(
+            const TriangulatedSurface< dimension >& surface )
+        {
+            IndexArray result{ std::vector< size_t >{
+                surface.nb_polygons(), 3 } };
+            auto values = result.mutable_unchecked< 2 >();
+            pybind11::gil_scoped_release release;
+            for( const auto t : Range{ surface.nb_polygons() } )
+            {
+                for( const auto v : Range{ 3 } )
+                {
+                    values( t, v ) = surface.polygon_vertex( { t, v } );
+                }
+            }
+            return result;
+        }
+
+        /*!
+         * Copy all the tetrahedron vertices into a (nb_tetrahedra, 4) array.
+         */
+        template < index_t dimension >
+        IndexArray tetrahedra_array(
+            const TetrahedralSolid< dimension >& solid )
+        {
+            IndexArray result{ std::vector< size_t >{
+                solid.nb_polyhedra(), 4 } };
+            auto values = result.mutable_unchecked< 2 >();
+            pybind11::gil_scoped_release release;
+            for( const auto t : Range{ solid.nb_polyhedra() } )
+            {
+                for( const auto v : Range{ 4 } )
+                {
+                    values( t, v ) = solid.polyhedron_vertex( { t, v } );
+                }
+            }
+            return result;
+        }
+
+        /*!
+         * Create one vertex per row of a (n, dimension) coordinate array.
+         * @return the index of the first created vertex
+         */
+        template < index_t dimension, typename Builder >
+        index_t create_points( Builder& builder, CoordinateArray points )
+        {
+            check_array_shape( points, dimension );
+            const auto values = points.unchecked< 2 >();
+            pybind11::gil_scoped_release release;
+            const auto nb_points = static_cast< index_t >( values.shape( 0 ) );
+            const auto first = builder.create_vertices( nb_points );
+            for( const auto p : Range{ nb_points } )
+            {
+                Point< dimension > point;
+                for( const auto d : Range{ dimension } )
+                {
+                    point.set_value( d, values( p, d ) );
+                }
+                builder.set_point( first + p, point );
+            }
+            return first;
+        }
+
+        /*!
+         * Create one triangle per row of a (n, 3) vertex index array.
+         * @return the index of the first created triangle
+         */
+        template < index_t dimension >
+        index_t create_triangles(
+            TriangulatedSurfaceBuilder< dimension >& builder,
+            InputIndexArray triangles )
+        {
+            check_array_shape( triangles, 3 );
+            const auto values = triangles.unchecked< 2 >();
+            pybind11::gil_scoped_release release;
+            check_indices( values, builder.nb_vertices() );
+            const auto nb_triangles =
+                static_cast< index_t >( values.shape( 0 ) );
+            builder.reserve_triangles( nb_triangles );
+            index_t first{ NO_ID };
+            for( const auto t : Range{ nb_triangles } )
+            {
+                const auto id = builder.create_triangle(
+                    { static_cast< index_t >( values( t, 0 ) ),
+                        static_cast< index_t >( values( t, 1 ) ),
+                        static_cast< index_t >( values( t, 2 ) ) } );
+                if( t == 0 )
+                {
+                    first = id;
+                }
+            }
+            return first;
+        }
+
+        /*!
+         * Create one tetrahedron per row of a (n, 4) vertex index array.
+         * @return the index of the first created tetrahedron
+         */
+        template < index_t dimension >
+        index_t create_tetrahedra(
+            TetrahedralSolidBuilder< dimension >& builder,
+            InputIndexArray tetrahedra )
+        {
+            check_array_shape( tetrahedra, 4 );
+            const auto values = tetrahedra.unchecked< 2 >();
+            pybind11::gil_scoped_release release;
+            check_indices( values, builder.nb_vertices() );
+            const auto nb_tetrahedra =
+                static_cast< index_t >( values.shape( 0 ) );
+            builder.reserve_tetrahedra( nb_tetrahedra );
+            index_t first{ NO_ID };
+            for( const auto t : Range{ nb_tetrahedra } )
+            {
+                const auto id = builder.create_tetrahedron(
+                    { static_cast< index_t >( values( t, 0 ) ),
+                        static_cast< index_t >( values( t, 1 ) ),
+                        static_cast< index_t >( values( t, 2 ) ),
+                        static_cast< index_t >( values( t, 3 ) ) } );
+                if( t == 0 )
+                {
+                    first = id;
+                }
+            }
+            return first;
+        }
+    } // namespace detail
+} // namespace geode
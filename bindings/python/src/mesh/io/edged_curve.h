@@ -27,7 +27,10 @@
 #define PYTHON_EDGED_CURVE_IO( dimension )                                     \
     const auto save##dimension =                                               \
         "save_edged_curve" + std::to_string( dimension ) + "D";                \
-    module.def( save##dimension.c_str(), &save_edged_curve< dimension > );     \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )( const EdgedCurve< dimension >&,                          \
+            absl::string_view ) )                                              \
+            & save_edged_curve< dimension > );                                 \
     const auto load##dimension =                                               \
         "load_edged_curve" + std::to_string( dimension ) + "D";                \
     module.def( load##dimension.c_str(),                                       \
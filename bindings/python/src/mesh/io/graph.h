@@ -28,7 +28,9 @@ namespace geode
 {
     void define_graph_io( pybind11::module& module )
     {
-        module.def( "save_graph", &save_graph );
-        module.def( "load_graph", &load_graph );
+        module.def( "save_graph",
+            ( void ( * )( const Graph&, absl::string_view ) ) & save_graph );
+        module.def( "load_graph",
+            ( void ( * )( Graph&, absl::string_view ) ) & load_graph );
     }
 } // namespace geode
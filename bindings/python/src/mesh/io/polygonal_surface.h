@@ -27,8 +27,10 @@
 #define PYTHON_POLYGONAL_SURFACE_IO( dimension )                               \
     const auto save##dimension =                                               \
         "save_polygonal_surface" + std::to_string( dimension ) + "D";          \
-    module.def(                                                                \
-        save##dimension.c_str(), &save_polygonal_surface< dimension > );       \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )( const PolygonalSurface< dimension >&,                    \
+            absl::string_view ) )                                              \
+            & save_polygonal_surface< dimension > );                           \
     const auto load##dimension =                                               \
         "load_polygonal_surface" + std::to_string( dimension ) + "D";          \
     module.def( load##dimension.c_str(),                                       \
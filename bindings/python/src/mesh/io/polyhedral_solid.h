@@ -27,8 +27,10 @@
 #define PYTHON_POLYHEDRAL_SOLID_IO( dimension )                                \
     const auto save##dimension =                                               \
         "save_polyhedral_solid" + std::to_string( dimension ) + "D";           \
-    module.def(                                                                \
-        save##dimension.c_str(), &save_polyhedral_solid< dimension > );        \
+    module.def( save##dimension.c_str(),                                       \
+        ( void ( * )( const PolyhedralSolid< dimension >&,                     \
+            absl::string_view ) )                                              \
+            & save_polyhedral_solid< dimension > );                            \
     const auto load##dimension =                                               \
         "load_polyhedral_solid" + std::to_string( dimension ) + "D";           \
     module.def( load##dimension.c_str(),                                       \
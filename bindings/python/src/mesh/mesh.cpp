@@ -24,6 +24,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include "detail/numpy_arrays.h"
+
 #include "builder/edged_curve_builder.h"
 #include "builder/graph_builder.h"
 #include "builder/point_set_builder.h"
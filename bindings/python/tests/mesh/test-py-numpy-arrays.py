@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+# Copyright (c) 2019 - 2020 Geode-solutions
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY:
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM:
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+import numpy
+import opengeode_py_basic as basic
+import opengeode_py_mesh as mesh
+
+def test_triangulated_surface():
+    surface = mesh.TriangulatedSurface3D.create()
+    builder = mesh.TriangulatedSurfaceBuilder3D.create( surface )
+    points = numpy.array( [ [ 0.1, 0.2, 0.3 ], [ 2.1, 9.4, 6.7 ], [ 7.5, 5.2, 6.3 ], [ 8.1, 1.4, 4.7 ] ] )
+    if builder.create_points( points ) != 0:
+        raise ValueError( "[Test] First created vertex should be 0" )
+    triangles = numpy.array( [ [ 0, 1, 2 ], [ 1, 3, 2 ] ] )
+    if builder.create_triangles( triangles ) != 0:
+        raise ValueError( "[Test] First created triangle should be 0" )
+    if surface.nb_vertices() != 4:
+        raise ValueError( "[Test] TriangulatedSurface should have 4 vertices" )
+    if surface.nb_polygons() != 2:
+        raise ValueError( "[Test] TriangulatedSurface should have 2 triangles" )
+    if not numpy.array_equal( surface.points_array(), points ):
+        raise ValueError( "[Test] Wrong exported points" )
+    if not numpy.array_equal( surface.triangles_array(), triangles ):
+        raise ValueError( "[Test] Wrong exported triangles" )
+
+    attribute = surface.vertex_attribute_manager().find_or_create_attribute_variable_double( "double", 0 )
+    attribute.set_values_array( points[:, 2], surface.nb_vertices() )
+    if not numpy.array_equal( attribute.values_array( surface.nb_vertices() ), points[:, 2] ):
+        raise ValueError( "[Test] Wrong exported attribute values" )
+    try:
+        attribute.set_values_array( points[:2, 2], surface.nb_vertices() )
+    except RuntimeError:
+        pass
+    else:
+        raise ValueError( "[Test] Attribute values array with a wrong size should be rejected" )
+    try:
+        builder.create_triangles( numpy.array( [ [ 0, -1, 2 ] ] ) )
+    except RuntimeError:
+        pass
+    else:
+        raise ValueError( "[Test] Negative vertex index should be rejected" )
+    try:
+        builder.create_triangles( numpy.array( [ [ 0, 1, surface.nb_vertices() ] ] ) )
+    except RuntimeError:
+        pass
+    else:
+        raise ValueError( "[Test] Vertex index out of the mesh should be rejected" )
+    if surface.nb_polygons() != 2:
+        raise ValueError( "[Test] No triangle should be created from invalid indices" )
+
+def test_tetrahedral_solid():
+    solid = mesh.TetrahedralSolid3D.create()
+    builder = mesh.TetrahedralSolidBuilder3D.create( solid )
+    builder.create_points( numpy.array( [ [ 0, 0, 0 ], [ 1, 0, 0 ], [ 0, 1, 0 ], [ 0, 0, 1 ], [ 1, 1, 1 ] ] ) )
+    tetrahedra = numpy.array( [ [ 0, 1, 2, 3 ], [ 1, 2, 3, 4 ] ] )
+    builder.create_tetrahedra( tetrahedra )
+    if not numpy.array_equal( solid.tetrahedra_array(), tetrahedra ):
+        raise ValueError( "[Test] Wrong exported tetrahedra" )
+    try:
+        builder.create_tetrahedra( numpy.array( [ [ 0, 1, 2, solid.nb_vertices() ] ] ) )
+    except RuntimeError:
+        pass
+    else:
+        raise ValueError( "[Test] Vertex index out of the mesh should be rejected" )
+    if solid.nb_polyhedra() != 2:
+        raise ValueError( "[Test] No tetrahedron should be created from invalid indices" )
+
+if __name__ == '__main__':
+    test_triangulated_surface()
+    test_tetrahedral_solid()
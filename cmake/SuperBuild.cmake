@@ -27,6 +27,7 @@ set(OPENGEODE_EXTRA_ARGS
     -DCPACK_SYSTEM_NAME:STRING=${CPACK_SYSTEM_NAME}
     -DOPENGEODE_WITH_TESTS:BOOL=${OPENGEODE_WITH_TESTS}
     -DOPENGEODE_WITH_PYTHON:BOOL=${OPENGEODE_WITH_PYTHON}
+    -DOPENGEODE_64BIT_INDICES:BOOL=${OPENGEODE_64BIT_INDICES}
 )
 
 if(WIN32)
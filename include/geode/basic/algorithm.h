@@ -50,12 +50,16 @@ namespace geode
         OPENGEODE_ASSERT( to_delete.size() == values.size(),
             "[delete_vector_elements] Number of elements in the two vectors "
             "should match" );
-        index_t nb_removed_elements{ 0 };
-        if( absl::c_find( to_delete, true ) == to_delete.end() )
+        const auto first_deleted = absl::c_find( to_delete, true );
+        if( first_deleted == to_delete.end() )
         {
             return 0;
         }
-        for( const auto i : Indices{ to_delete } )
+        // Elements before the first deleted one do not move
+        index_t nb_removed_elements{ 0 };
+        for( const auto i :
+            Range{ std::distance( to_delete.begin(), first_deleted ),
+                to_delete.size() } )
         {
             if( to_delete[i] )
             {
@@ -63,7 +67,7 @@ namespace geode
             }
             else
             {
-                values[i - nb_removed_elements] = values[i];
+                values[i - nb_removed_elements] = std::move( values[i] );
             }
         }
         values.resize( to_delete.size() - nb_removed_elements );
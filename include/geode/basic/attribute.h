@@ -23,11 +23,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <typeinfo>
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/strings/string_view.h>
+#include <absl/types/span.h>
 
 #include <bitsery/bitsery.h>
 #include <bitsery/brief_syntax.h>
@@ -40,6 +44,7 @@
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/common.h>
 #include <geode/basic/detail/mapping_after_deletion.h>
+#include <geode/basic/detail/permutation.h>
 #include <geode/basic/passkey.h>
 
 namespace geode
@@ -47,6 +52,297 @@ namespace geode
     class AttributeManager;
 } // namespace geode
 
+namespace geode
+{
+    namespace detail
+    {
+        template < size_t size >
+        struct SameSizeUnsigned;
+
+        template <>
+        struct SameSizeUnsigned< 1 >
+        {
+            using type = uint8_t;
+        };
+
+        template <>
+        struct SameSizeUnsigned< 2 >
+        {
+            using type = uint16_t;
+        };
+
+        template <>
+        struct SameSizeUnsigned< 4 >
+        {
+            using type = uint32_t;
+        };
+
+        template <>
+        struct SameSizeUnsigned< 8 >
+        {
+            using type = uint64_t;
+        };
+
+        /*!
+         * Write or read a vector of values as one contiguous block preceded by
+         * its size. Each value is split into its arithmetic items which are
+         * handled by the archive adapter (endianness included).
+         */
+        template < typename Archive >
+        struct BulkValuesSerializer;
+
+        template < typename T >
+        using HasIndexItems = std::is_same<
+            typename BulkAttributeSerialization< T >::ItemType,
+            index_t >;
+
+        /*!
+         * Flag set on the number of values when index items are written on
+         * 8 bytes. Index items are written on 4 bytes (NO_ID included)
+         * whenever they all fit, so that 32 and 64 bits indices builds can
+         * read each other files.
+         */
+        static constexpr uint64_t WIDE_INDICES_FLAG{ uint64_t{ 1 } << 63 };
+
+        template < typename Adapter, typename Context >
+        struct BulkValuesSerializer< bitsery::Serializer< Adapter, Context > >
+        {
+            template < typename T >
+            static void process(
+                bitsery::Serializer< Adapter, Context >& archive,
+                std::vector< T >& values )
+            {
+                process( archive, values, HasIndexItems< T >{} );
+            }
+
+        private:
+            template < typename T >
+            static void process(
+                bitsery::Serializer< Adapter, Context >& archive,
+                std::vector< T >& values,
+                std::false_type )
+            {
+                using Traits = BulkAttributeSerialization< T >;
+                using Item = typename SameSizeUnsigned< sizeof(
+                    typename Traits::ItemType ) >::type;
+                static_assert( sizeof( T ) == Traits::nb_items * sizeof( Item ),
+                    "[BulkValuesSerializer] Type should not have padding" );
+                uint64_t nb_values = values.size();
+                archive.value8b( nb_values );
+                if( nb_values != 0 )
+                {
+                    archive.adapter().template writeBuffer< sizeof( Item ) >(
+                        reinterpret_cast< const Item* >( values.data() ),
+                        values.size() * Traits::nb_items );
+                }
+            }
+
+            template < typename T >
+            static void process(
+                bitsery::Serializer< Adapter, Context >& archive,
+                std::vector< T >& values,
+                std::true_type )
+            {
+                using Traits = BulkAttributeSerialization< T >;
+                static_assert(
+                    sizeof( T ) == Traits::nb_items * sizeof( index_t ),
+                    "[BulkValuesSerializer] Type should not have padding" );
+                const auto nb_items = values.size() * Traits::nb_items;
+                const auto* items =
+                    reinterpret_cast< const index_t* >( values.data() );
+                const auto narrow =
+                    sizeof( index_t ) == sizeof( uint32_t )
+                    || std::all_of( items, items + nb_items, fits_in_4_bytes );
+                uint64_t nb_values = values.size();
+                if( !narrow )
+                {
+                    nb_values |= WIDE_INDICES_FLAG;
+                }
+                archive.value8b( nb_values );
+                if( nb_items == 0 )
+                {
+                    return;
+                }
+                if( !narrow )
+                {
+                    archive.adapter().template writeBuffer< 8 >(
+                        reinterpret_cast< const uint64_t* >( items ),
+                        nb_items );
+                }
+                else if( sizeof( index_t ) == sizeof( uint32_t ) )
+                {
+                    archive.adapter().template writeBuffer< 4 >(
+                        reinterpret_cast< const uint32_t* >( items ),
+                        nb_items );
+                }
+                else
+                {
+                    std::vector< uint32_t > narrow_items( nb_items );
+                    std::transform( items, items + nb_items,
+                        narrow_items.begin(), []( index_t item ) {
+                            return item == NO_ID
+                                       ? NO_ID_4B
+                                       : static_cast< uint32_t >( item );
+                        } );
+                    archive.adapter().template writeBuffer< 4 >(
+                        narrow_items.data(), nb_items );
+                }
+            }
+        };
+
+        template < typename Adapter, typename Context >
+        struct BulkValuesSerializer< bitsery::Deserializer< Adapter, Context > >
+        {
+            template < typename T >
+            static void process(
+                bitsery::Deserializer< Adapter, Context >& archive,
+                std::vector< T >& values )
+            {
+                process( archive, values, HasIndexItems< T >{} );
+            }
+
+        private:
+            template < typename T >
+            static void process(
+                bitsery::Deserializer< Adapter, Context >& archive,
+                std::vector< T >& values,
+                std::false_type )
+            {
+                using Traits = BulkAttributeSerialization< T >;
+                using Item = typename SameSizeUnsigned< sizeof(
+                    typename Traits::ItemType ) >::type;
+                static_assert( sizeof( T ) == Traits::nb_items * sizeof( Item ),
+                    "[BulkValuesSerializer] Type should not have padding" );
+                uint64_t nb_values{ 0 };
+                archive.value8b( nb_values );
+                read_in_chunks( archive, values, nb_values,
+                    [&archive]( T* chunk, size_t nb_chunk_values ) {
+                        archive.adapter().template readBuffer< sizeof(
+                            Item ) >( reinterpret_cast< Item* >( chunk ),
+                            nb_chunk_values * Traits::nb_items );
+                    } );
+            }
+
+            template < typename T >
+            static void process(
+                bitsery::Deserializer< Adapter, Context >& archive,
+                std::vector< T >& values,
+                std::true_type )
+            {
+                using Traits = BulkAttributeSerialization< T >;
+                static_assert(
+                    sizeof( T ) == Traits::nb_items * sizeof( index_t ),
+                    "[BulkValuesSerializer] Type should not have padding" );
+                uint64_t nb_values{ 0 };
+                archive.value8b( nb_values );
+                const auto wide = ( nb_values & WIDE_INDICES_FLAG ) != 0;
+                nb_values &= ~WIDE_INDICES_FLAG;
+                if( wide )
+                {
+                    OPENGEODE_EXCEPTION(
+                        nb_values == 0
+                            || sizeof( index_t ) == sizeof( uint64_t ),
+                        "[BulkValuesSerializer] Indices do not fit in this "
+                        "build index type, use OPENGEODE_64BIT_INDICES" );
+                    read_in_chunks( archive, values, nb_values,
+                        [&archive]( T* chunk, size_t nb_chunk_values ) {
+                            archive.adapter().template readBuffer< 8 >(
+                                reinterpret_cast< uint64_t* >( chunk ),
+                                nb_chunk_values * Traits::nb_items );
+                        } );
+                }
+                else if( sizeof( index_t ) == sizeof( uint32_t ) )
+                {
+                    read_in_chunks( archive, values, nb_values,
+                        [&archive]( T* chunk, size_t nb_chunk_values ) {
+                            archive.adapter().template readBuffer< 4 >(
+                                reinterpret_cast< uint32_t* >( chunk ),
+                                nb_chunk_values * Traits::nb_items );
+                        } );
+                }
+                else
+                {
+                    std::vector< uint32_t > narrow_items;
+                    read_in_chunks( archive, values, nb_values,
+                        [&archive, &narrow_items](
+                            T* chunk, size_t nb_chunk_values ) {
+                            const auto nb_items =
+                                nb_chunk_values * Traits::nb_items;
+                            narrow_items.resize( nb_items );
+                            archive.adapter().template readBuffer< 4 >(
+                                narrow_items.data(), nb_items );
+                            std::transform( narrow_items.begin(),
+                                narrow_items.end(),
+                                reinterpret_cast< index_t* >( chunk ),
+                                []( uint32_t item ) {
+                                    return item == NO_ID_4B ? NO_ID
+                                                            : index_t{ item };
+                                } );
+                        } );
+                }
+            }
+
+            /*!
+             * The number of values is read from the input and cannot be
+             * trusted: values are allocated chunk by chunk as they are read,
+             * and reading stops at the first adapter error (e.g. end of
+             * input), so that a corrupted size cannot trigger a huge
+             * allocation.
+             */
+            template < typename T, typename ReadChunk >
+            static void read_in_chunks(
+                bitsery::Deserializer< Adapter, Context >& archive,
+                std::vector< T >& values,
+                uint64_t nb_values,
+                const ReadChunk& read_chunk )
+            {
+                static constexpr uint64_t CHUNK_NB_VALUES{ 1 << 16 };
+                values.clear();
+                while( values.size() < nb_values )
+                {
+                    const auto begin = values.size();
+                    const auto nb_chunk_values = static_cast< size_t >(
+                        std::min( nb_values - begin, CHUNK_NB_VALUES ) );
+                    values.resize( begin + nb_chunk_values );
+                    read_chunk( values.data() + begin, nb_chunk_values );
+                    if( archive.adapter().error()
+                        != bitsery::ReaderError::NoError )
+                    {
+                        values.clear();
+                        return;
+                    }
+                }
+            }
+        };
+
+        template < typename Archive, typename T >
+        void serialize_attribute_values(
+            Archive& archive, std::vector< T >& values, std::true_type )
+        {
+            BulkValuesSerializer< Archive >::process( archive, values );
+        }
+
+        template < typename Archive, typename T >
+        void serialize_attribute_values(
+            Archive& archive, std::vector< T >& values, std::false_type )
+        {
+            archive.container( values, values.max_size(),
+                []( Archive& archive, T& item ) {
+                    serialize_value( archive, item );
+                } );
+        }
+
+        template < typename Archive, typename T >
+        void serialize_attribute_values(
+            Archive& archive, std::vector< T >& values )
+        {
+            serialize_attribute_values( archive, values,
+                std::integral_constant< bool,
+                    BulkAttributeSerialization< T >::is_bulk >{} );
+        }
+    } // namespace detail
+} // namespace geode
+
 namespace geode
 {
     /*!
@@ -81,6 +377,9 @@ namespace geode
         virtual void delete_elements(
             const std::vector< bool >& to_delete, AttributeKey ) = 0;
 
+        virtual void permute_elements(
+            absl::Span< const index_t > permutation, AttributeKey ) = 0;
+
         virtual void compute_value(
             index_t from_element, index_t to_element, AttributeKey ) = 0;
 
@@ -89,6 +388,20 @@ namespace geode
             index_t to_element,
             AttributeKey ) = 0;
 
+        virtual void compute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeKey ) = 0;
+
+        virtual void compute_values(
+            const AttributeLinearInterpolations& interpolations,
+            AttributeKey ) = 0;
+
+        /*!
+         * Return the memory owned by the attribute in bytes, including the
+         * heap memory held by its values (see AttributeHeapMemory).
+         */
+        virtual size_t memory_usage() const = 0;
+
         const AttributeProperties& properties() const
         {
             return properties_;
@@ -198,6 +511,11 @@ namespace geode
             return value();
         }
 
+        size_t memory_usage() const override
+        {
+            return sizeof( *this ) + AttributeHeapMemory< T >::size( value_ );
+        }
+
         template < typename Modifier >
         void modify_value( Modifier&& modifier )
         {
@@ -216,6 +534,17 @@ namespace geode
         {
         }
 
+        void compute_values( absl::Span< const index_t > /*unused*/,
+            absl::Span< const index_t > /*unused*/,
+            AttributeBase::AttributeKey ) override
+        {
+        }
+
+        void compute_values( const AttributeLinearInterpolations& /*unused*/,
+            AttributeBase::AttributeKey ) override
+        {
+        }
+
     private:
         ConstantAttribute( T value, AttributeProperties properties )
             : ReadOnlyAttribute< T >( std::move( properties ) )
@@ -233,7 +562,7 @@ namespace geode
                 []( Archive& archive, ConstantAttribute< T >& attribute ) {
                     archive.ext( attribute,
                         bitsery::ext::BaseClass< ReadOnlyAttribute< T > >{} );
-                    archive( attribute.value_ );
+                    serialize_value( archive, attribute.value_ );
                 } );
         }
 
@@ -250,6 +579,11 @@ namespace geode
         {
         }
 
+        void permute_elements( absl::Span< const index_t > /*unused*/,
+            AttributeBase::AttributeKey ) override
+        {
+        }
+
         std::shared_ptr< AttributeBase > clone(
             AttributeBase::AttributeKey ) const override
         {
@@ -288,7 +622,7 @@ namespace geode
         {
         }
 
-        const T& value( index_t element ) const override
+        const T& value( index_t element ) const final
         {
             return values_.at( element );
         }
@@ -303,6 +637,23 @@ namespace geode
             return default_value_;
         }
 
+        size_t memory_usage() const override
+        {
+            return sizeof( *this )
+                   + AttributeHeapMemory< T >::size( default_value_ )
+                   + AttributeHeapMemory< std::vector< T > >::size( values_ );
+        }
+
+        /*!
+         * Return all the attribute values, indexed by element.
+         * @warning The returned Span is invalidated by any modification of
+         * the number of elements.
+         */
+        absl::Span< const T > values() const
+        {
+            return values_;
+        }
+
         template < typename Modifier >
         void modify_value( index_t element, Modifier&& modifier )
         {
@@ -323,6 +674,28 @@ namespace geode
             set_value( to_element, interpolation.compute_value( *this ) );
         }
 
+        void compute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeBase::AttributeKey ) override
+        {
+            for( const auto i : Indices{ to_elements } )
+            {
+                values_[to_elements[i]] = values_[from_elements[i]];
+            }
+        }
+
+        void compute_values(
+            const AttributeLinearInterpolations& interpolations,
+            AttributeBase::AttributeKey ) override
+        {
+            for( const auto i : Range{ interpolations.nb_interpolations() } )
+            {
+                values_[interpolations.target( i )] =
+                    AttributeLinearInterpolationsImpl< T >::compute(
+                        interpolations, i, *this );
+            }
+        }
+
     protected:
         VariableAttribute( T default_value, AttributeProperties properties )
             : ReadOnlyAttribute< T >( std::move( properties ) ),
@@ -337,15 +710,27 @@ namespace geode
         void serialize( Archive& archive )
         {
             archive.ext( *this,
-                DefaultGrowable< Archive, VariableAttribute< T > >{},
-                []( Archive& archive, VariableAttribute< T >& attribute ) {
-                    archive.ext( attribute,
-                        bitsery::ext::BaseClass< ReadOnlyAttribute< T > >{} );
-                    archive( attribute.default_value_ );
-                    archive.container( attribute.values_,
-                        attribute.values_.max_size(),
-                        []( Archive& archive, T& item ) { archive( item ); } );
-                } );
+                Growable< Archive, VariableAttribute< T > >{
+                    { []( Archive& archive, VariableAttribute< T >& attribute ) {
+                         archive.ext( attribute, bitsery::ext::BaseClass<
+                                                     ReadOnlyAttribute< T > >{} );
+                         serialize_value( archive, attribute.default_value_ );
+                         archive.container( attribute.values_,
+                             attribute.values_.max_size(),
+                             []( Archive& archive, T& item ) {
+                                 serialize_value( archive, item );
+                             } );
+                     },
+                        []( Archive& archive,
+                            VariableAttribute< T >& attribute ) {
+                            archive.ext(
+                                attribute, bitsery::ext::BaseClass<
+                                               ReadOnlyAttribute< T > >{} );
+                            serialize_value(
+                                archive, attribute.default_value_ );
+                            detail::serialize_attribute_values(
+                                archive, attribute.values_ );
+                        } } } );
             values_.reserve( 10 );
         }
 
@@ -369,6 +754,12 @@ namespace geode
             delete_vector_elements( to_delete, values_ );
         }
 
+        void permute_elements( absl::Span< const index_t > permutation,
+            AttributeBase::AttributeKey ) override
+        {
+            detail::permute( values_, permutation );
+        }
+
         std::shared_ptr< AttributeBase > clone(
             AttributeBase::AttributeKey ) const override
         {
@@ -434,6 +825,11 @@ namespace geode
             return default_value_;
         }
 
+        size_t memory_usage() const override
+        {
+            return sizeof( *this ) + values_.capacity();
+        }
+
         template < typename Modifier >
         void modify_value( index_t element, Modifier&& modifier )
         {
@@ -454,6 +850,28 @@ namespace geode
             set_value( to_element, interpolation.compute_value( *this ) );
         }
 
+        void compute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeBase::AttributeKey ) override
+        {
+            for( const auto i : Indices{ to_elements } )
+            {
+                set_value( to_elements[i], value( from_elements[i] ) );
+            }
+        }
+
+        void compute_values(
+            const AttributeLinearInterpolations& interpolations,
+            AttributeBase::AttributeKey ) override
+        {
+            for( const auto i : Range{ interpolations.nb_interpolations() } )
+            {
+                set_value( interpolations.target( i ),
+                    AttributeLinearInterpolationsImpl< bool >::compute(
+                        interpolations, i, *this ) );
+            }
+        }
+
     protected:
         VariableAttribute( bool default_value, AttributeProperties properties )
             : ReadOnlyAttribute< bool >( std::move( properties ) ),
@@ -500,6 +918,12 @@ namespace geode
             delete_vector_elements( to_delete, values_ );
         }
 
+        void permute_elements( absl::Span< const index_t > permutation,
+            AttributeBase::AttributeKey ) override
+        {
+            detail::permute( values_, permutation );
+        }
+
         std::shared_ptr< AttributeBase > clone(
             AttributeBase::AttributeKey ) const override
         {
@@ -564,6 +988,7 @@ namespace geode
         void set_value( index_t element, T value )
         {
             values_[element] = std::move( value );
+            nb_elements_ = std::max( nb_elements_, element + 1 );
         }
 
         T default_value() const
@@ -571,6 +996,14 @@ namespace geode
             return default_value_;
         }
 
+        size_t memory_usage() const override
+        {
+            return sizeof( *this )
+                   + AttributeHeapMemory< T >::size( default_value_ )
+                   + AttributeHeapMemory<
+                       absl::flat_hash_map< index_t, T > >::size( values_ );
+        }
+
         template < typename Modifier >
         void modify_value( index_t element, Modifier&& modifier )
         {
@@ -578,6 +1011,7 @@ namespace geode
             if( it == values_.end() )
             {
                 values_.emplace( element, default_value_ );
+                nb_elements_ = std::max( nb_elements_, element + 1 );
             }
             modifier( values_[element] );
         }
@@ -596,6 +1030,28 @@ namespace geode
             set_value( to_element, interpolation.compute_value( *this ) );
         }
 
+        void compute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeBase::AttributeKey ) override
+        {
+            for( const auto i : Indices{ to_elements } )
+            {
+                set_value( to_elements[i], value( from_elements[i] ) );
+            }
+        }
+
+        void compute_values(
+            const AttributeLinearInterpolations& interpolations,
+            AttributeBase::AttributeKey ) override
+        {
+            for( const auto i : Range{ interpolations.nb_interpolations() } )
+            {
+                set_value( interpolations.target( i ),
+                    AttributeLinearInterpolationsImpl< T >::compute(
+                        interpolations, i, *this ) );
+            }
+        }
+
     private:
         SparseAttribute( T default_value, AttributeProperties properties )
             : ReadOnlyAttribute< T >( std::move( properties ) ),
@@ -614,19 +1070,32 @@ namespace geode
                 []( Archive& archive, SparseAttribute< T >& attribute ) {
                     archive.ext( attribute,
                         bitsery::ext::BaseClass< ReadOnlyAttribute< T > >{} );
-                    archive( attribute.default_value_ );
+                    serialize_value( archive, attribute.default_value_ );
                     archive.ext( attribute.values_,
                         bitsery::ext::StdMap{ attribute.values_.max_size() },
                         []( Archive& archive, index_t& i, T& item ) {
-                            archive.value4b( i );
-                            archive( item );
+                            serialize_index( archive, i );
+                            serialize_value( archive, item );
                         } );
+                    for( const auto& value : attribute.values_ )
+                    {
+                        attribute.nb_elements_ = std::max(
+                            attribute.nb_elements_, value.first + 1 );
+                    }
                 } );
             values_.reserve( 10 );
         }
 
-        void resize( index_t /*unused*/, AttributeBase::AttributeKey ) override
+        void resize( index_t size, AttributeBase::AttributeKey ) override
         {
+            if( size < nb_elements_ )
+            {
+                absl::erase_if( values_,
+                    [size]( const std::pair< const index_t, T >& value ) {
+                        return value.first >= size;
+                    } );
+            }
+            nb_elements_ = size;
         }
 
         void reserve( index_t capacity, AttributeBase::AttributeKey ) override
@@ -638,16 +1107,33 @@ namespace geode
             AttributeBase::AttributeKey ) override
         {
             const auto old2new = detail::mapping_after_deletion( to_delete );
-            const auto old_values = values_;
-            values_.clear();
-            values_.reserve( old_values.size() );
-            for( const auto& value : old_values )
+            absl::flat_hash_map< index_t, T > new_values;
+            new_values.reserve( values_.size() );
+            for( auto& value : values_ )
             {
                 if( !to_delete[value.first] && value.second != default_value_ )
                 {
-                    values_.emplace( old2new[value.first], value.second );
+                    new_values.emplace(
+                        old2new[value.first], std::move( value.second ) );
                 }
             }
+            values_.swap( new_values );
+            nb_elements_ = std::min(
+                nb_elements_, static_cast< index_t >( to_delete.size() ) );
+        }
+
+        void permute_elements( absl::Span< const index_t > permutation,
+            AttributeBase::AttributeKey ) override
+        {
+            const auto old2new = detail::old2new_permutation( permutation );
+            absl::flat_hash_map< index_t, T > new_values;
+            new_values.reserve( values_.size() );
+            for( auto& value : values_ )
+            {
+                new_values.emplace(
+                    old2new[value.first], std::move( value.second ) );
+            }
+            values_.swap( new_values );
         }
 
         std::shared_ptr< AttributeBase > clone(
@@ -657,6 +1143,7 @@ namespace geode
                 new SparseAttribute< T >{ default_value_, this->properties() }
             };
             attribute->values_ = values_;
+            attribute->nb_elements_ = nb_elements_;
             return attribute;
         }
 
@@ -676,11 +1163,17 @@ namespace geode
                         values_[i] = typed_attribute.value( i );
                     }
                 }
+                nb_elements_ = std::max( nb_elements_, nb_elements );
             }
         }
 
     private:
         T default_value_;
         absl::flat_hash_map< index_t, T > values_;
+        /*!
+         * Upper bound of the stored element indices, so that growing the
+         * attribute does not need to scan the values.
+         */
+        index_t nb_elements_{ 0 };
     };
 } // namespace geode
@@ -33,6 +33,7 @@
 #include <geode/basic/attribute.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/common.h>
+#include <geode/basic/memory_usage.h>
 #include <geode/basic/pimpl.h>
 
 namespace geode
@@ -164,6 +165,32 @@ namespace geode
             const AttributeLinearInterpolation& interpolation,
             index_t to_element );
 
+        /*!
+         * Assign several attribute values from other values in the same
+         * attribute. Each attribute is processed once over the whole batch.
+         * @param[in] from_elements Attribute values to assign
+         * @param[in] to_elements Where the values are assigned, in the same
+         * order as from_elements
+         * @exception OpenGeodeException if an element is not smaller than
+         * nb_elements()
+         * @warning Only affect Attributes created with its AttributeProperties
+         * assignable flag set to true
+         */
+        void assign_attribute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements );
+
+        /*!
+         * Interpolate several attribute values from other values in the same
+         * attribute. Each attribute is processed once over the whole batch.
+         * @param[in] interpolations Batch of attribute interpolations
+         * @exception OpenGeodeException if an element is not smaller than
+         * nb_elements()
+         * @warning Only affect Attributes created with its AttributeProperties
+         * interpolable flag set to true
+         */
+        void interpolate_attribute_values(
+            const AttributeLinearInterpolations& interpolations );
+
         /*!
          * Get all the associated attribute names
          */
@@ -206,11 +233,24 @@ namespace geode
          */
         void delete_elements( const std::vector< bool >& to_delete );
 
+        /*!
+         * Reorder all attribute elements.
+         * @param[in] permutation a vector of size @function nb_elements().
+         * The new element i takes the values of the old element
+         * permutation[i].
+         */
+        void permute_elements( absl::Span< const index_t > permutation );
+
         /*!
          * Get the number of elements in each attribute
          */
         index_t nb_elements() const;
 
+        /*!
+         * Return the memory used by the manager, detailed by attribute name
+         */
+        MemoryUsage memory_usage() const;
+
         void copy( const AttributeManager& attribute_manager );
 
         template < typename Type, typename Serializer >
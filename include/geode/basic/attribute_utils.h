@@ -23,11 +23,18 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <typeinfo>
+#include <vector>
 
+#include <absl/container/fixed_array.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/inlined_vector.h>
 #include <absl/strings/string_view.h>
+#include <absl/types/span.h>
 
 #include <bitsery/bitsery.h>
 #include <bitsery/brief_syntax.h>
@@ -127,6 +134,100 @@ namespace geode
         const absl::FixedArray< double > lambdas_;
     };
 
+    /*!
+     * Batch of linear interpolations stored in flat arrays.
+     * The i-th interpolation computes the value of element target( i ) from
+     * the elements indices( i ) weighted by lambdas( i ).
+     */
+    class AttributeLinearInterpolations
+    {
+    public:
+        AttributeLinearInterpolations() : offsets_( 1, 0 ) {}
+
+        void reserve( index_t nb_interpolations, index_t nb_indices )
+        {
+            targets_.reserve( nb_interpolations );
+            offsets_.reserve( nb_interpolations + 1 );
+            indices_.reserve( nb_indices );
+            lambdas_.reserve( nb_indices );
+        }
+
+        void add_interpolation( index_t to_element,
+            absl::Span< const index_t > indices,
+            absl::Span< const double > lambdas )
+        {
+            OPENGEODE_EXCEPTION( indices.size() == lambdas.size(),
+                "[AttributeLinearInterpolations::add_interpolation] Both "
+                "arrays should have the same size" );
+            targets_.push_back( to_element );
+            indices_.insert( indices_.end(), indices.begin(), indices.end() );
+            lambdas_.insert( lambdas_.end(), lambdas.begin(), lambdas.end() );
+            offsets_.push_back( static_cast< index_t >( indices_.size() ) );
+        }
+
+        index_t nb_interpolations() const
+        {
+            return static_cast< index_t >( targets_.size() );
+        }
+
+        index_t target( index_t interpolation ) const
+        {
+            return targets_[interpolation];
+        }
+
+        absl::Span< const index_t > indices( index_t interpolation ) const
+        {
+            return { indices_.data() + offsets_[interpolation],
+                offsets_[interpolation + 1] - offsets_[interpolation] };
+        }
+
+        absl::Span< const double > lambdas( index_t interpolation ) const
+        {
+            return { lambdas_.data() + offsets_[interpolation],
+                offsets_[interpolation + 1] - offsets_[interpolation] };
+        }
+
+        AttributeLinearInterpolation interpolation(
+            index_t interpolation ) const
+        {
+            const auto interpolation_indices = indices( interpolation );
+            const auto interpolation_lambdas = lambdas( interpolation );
+            return { absl::FixedArray< index_t >(
+                         interpolation_indices.begin(),
+                         interpolation_indices.end() ),
+                absl::FixedArray< double >( interpolation_lambdas.begin(),
+                    interpolation_lambdas.end() ) };
+        }
+
+    private:
+        std::vector< index_t > targets_;
+        std::vector< index_t > offsets_;
+        std::vector< index_t > indices_;
+        std::vector< double > lambdas_;
+    };
+
+    /*!
+     * Helper struct to interpolate one Attribute value of a batch of
+     * interpolations.
+     * By default, it uses the AttributeLinearInterpolationImpl of the type.
+     * It is customized for types declared with
+     * IMPLICIT_ATTRIBUTE_LINEAR_INTERPOLATION, and for Point, to compute the
+     * weighted sum directly from the batch arrays.
+     */
+    template < typename AttributeType >
+    struct AttributeLinearInterpolationsImpl
+    {
+        template < template < typename > class Attribute >
+        static AttributeType compute(
+            const AttributeLinearInterpolations& interpolations,
+            index_t interpolation,
+            const Attribute< AttributeType >& attribute )
+        {
+            return interpolations.interpolation( interpolation )
+                .compute_value( attribute );
+        }
+    };
+
 #define IMPLICIT_ATTRIBUTE_LINEAR_INTERPOLATION( Type )                        \
     template <>                                                                \
     struct AttributeLinearInterpolationImpl< Type >                            \
@@ -143,6 +244,25 @@ namespace geode
             }                                                                  \
             return result;                                                     \
         }                                                                      \
+    };                                                                         \
+    template <>                                                                \
+    struct AttributeLinearInterpolationsImpl< Type >                           \
+    {                                                                          \
+        template < template < typename > class Attribute >                     \
+        static Type compute(                                                   \
+            const AttributeLinearInterpolations& interpolations,               \
+            index_t interpolation,                                             \
+            const Attribute< Type >& attribute )                               \
+        {                                                                      \
+            const auto indices = interpolations.indices( interpolation );      \
+            const auto lambdas = interpolations.lambdas( interpolation );      \
+            Type result{ 0 };                                                  \
+            for( auto i : Indices{ indices } )                                 \
+            {                                                                  \
+                result += lambdas[i] * attribute.value( indices[i] );          \
+            }                                                                  \
+            return result;                                                     \
+        }                                                                      \
     }
 
     IMPLICIT_ATTRIBUTE_LINEAR_INTERPOLATION( float );
@@ -183,6 +303,153 @@ namespace geode
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( bool );
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( int );
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( unsigned int );
+#ifdef OPENGEODE_64BIT_INDICES
+    IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( index_t );
+#endif
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( float );
     IMPLICIT_GENERIC_ATTRIBUTE_CONVERSION( double );
+
+    /*!
+     * Helper struct to serialize all the values of a VariableAttribute in a
+     * single contiguous block instead of value by value.
+     * Arithmetic types are handled by default.
+     * This struct may be customized for a trivially copyable type made of
+     * nb_items contiguous values of a same arithmetic type, without padding.
+     * Example:
+     * template <>
+     * struct BulkAttributeSerialization< MyType >
+     * {
+     *     static constexpr bool is_bulk = true;
+     *     using ItemType = double;
+     *     static constexpr index_t nb_items = 3;
+     * };
+     */
+    template < typename AttributeType >
+    struct BulkAttributeSerialization
+    {
+        static constexpr bool is_bulk =
+            std::is_arithmetic< AttributeType >::value;
+        using ItemType = AttributeType;
+        static constexpr index_t nb_items = 1;
+    };
+
+    template < typename Type, size_t size >
+    struct BulkAttributeSerialization< std::array< Type, size > >
+    {
+        static constexpr bool is_bulk =
+            BulkAttributeSerialization< Type >::is_bulk;
+        using ItemType = typename BulkAttributeSerialization< Type >::ItemType;
+        static constexpr index_t nb_items =
+            size * BulkAttributeSerialization< Type >::nb_items;
+    };
+
+#define BULK_ATTRIBUTE_SERIALIZATION( Type, Item, nb )                         \
+    template <>                                                                \
+    struct BulkAttributeSerialization< Type >                                  \
+    {                                                                          \
+        static constexpr bool is_bulk = true;                                  \
+        using ItemType = Item;                                                 \
+        static constexpr index_t nb_items = nb;                                \
+    }
+
+    /*!
+     * Helper struct to estimate the heap memory owned by an attribute value,
+     * in addition to its sizeof.
+     * Types without heap allocation are handled by default, as well as
+     * std::string, std::vector, std::array, absl::InlinedVector and
+     * absl::flat_hash_map of handled types.
+     * This struct may be customized for a type owning heap memory.
+     * Example:
+     * template <>
+     * struct AttributeHeapMemory< MyType >
+     * {
+     *     static size_t size( const MyType& value )
+     *     {
+     *         return AttributeHeapMemory< std::vector< double > >::size(
+     *             value.values );
+     *     }
+     * };
+     */
+    template < typename AttributeType >
+    struct AttributeHeapMemory
+    {
+        static size_t size( const AttributeType& /*unused*/ )
+        {
+            return 0;
+        }
+    };
+
+    template <>
+    struct AttributeHeapMemory< std::string >
+    {
+        static size_t size( const std::string& value )
+        {
+            static const auto small_capacity = std::string{}.capacity();
+            return value.capacity() > small_capacity ? value.capacity() + 1
+                                                     : 0;
+        }
+    };
+
+    template < typename Type >
+    struct AttributeHeapMemory< std::vector< Type > >
+    {
+        static size_t size( const std::vector< Type >& value )
+        {
+            auto result = value.capacity() * sizeof( Type );
+            for( const auto& item : value )
+            {
+                result += AttributeHeapMemory< Type >::size( item );
+            }
+            return result;
+        }
+    };
+
+    template < typename Type, size_t size_in >
+    struct AttributeHeapMemory< std::array< Type, size_in > >
+    {
+        static size_t size( const std::array< Type, size_in >& value )
+        {
+            size_t result{ 0 };
+            for( const auto& item : value )
+            {
+                result += AttributeHeapMemory< Type >::size( item );
+            }
+            return result;
+        }
+    };
+
+    template < typename Type, size_t size_in >
+    struct AttributeHeapMemory< absl::InlinedVector< Type, size_in > >
+    {
+        static size_t size( const absl::InlinedVector< Type, size_in >& value )
+        {
+            size_t result{ 0 };
+            if( value.capacity() > size_in )
+            {
+                result += value.capacity() * sizeof( Type );
+            }
+            for( const auto& item : value )
+            {
+                result += AttributeHeapMemory< Type >::size( item );
+            }
+            return result;
+        }
+    };
+
+    template < typename Key, typename Value >
+    struct AttributeHeapMemory< absl::flat_hash_map< Key, Value > >
+    {
+        static size_t size( const absl::flat_hash_map< Key, Value >& value )
+        {
+            // One control byte per slot in addition to the slot itself
+            auto result = value.capacity()
+                          * ( sizeof( std::pair< const Key, Value > ) + 1 );
+            for( const auto& item : value )
+            {
+                result += AttributeHeapMemory< Key >::size( item.first )
+                          + AttributeHeapMemory< Value >::size( item.second );
+            }
+            return result;
+        }
+    };
 } // namespace geode
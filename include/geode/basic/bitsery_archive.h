@@ -23,7 +23,10 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
+#include <limits>
+#include <vector>
 
 #include <absl/container/fixed_array.h>
 
@@ -66,6 +69,192 @@ namespace geode
     void opengeode_basic_api register_basic_deserialize_pcontext(
         PContext &context );
 
+    namespace detail
+    {
+        /*!
+         * Index fields are written on 4 bytes whatever the index_t width,
+         * NO_ID being mapped to the maximum 4 bytes value. Larger indices are
+         * written as an escape value followed by 8 bytes.
+         * This encoding is identical to the raw 4 bytes one for every index
+         * a 32 bits build can handle: the escape value would be the index of
+         * the last element of a mesh with 2^32 - 1 elements.
+         * It is only used for fields known to be indices (serialize_index),
+         * never for attribute values which may hold any unsigned value.
+         */
+        static constexpr uint32_t NO_ID_4B{
+            std::numeric_limits< uint32_t >::max()
+        };
+        static constexpr uint32_t LARGE_INDEX_4B{ NO_ID_4B - 1 };
+
+        inline bool fits_in_4_bytes( index_t index )
+        {
+            return index == NO_ID || index < NO_ID_4B;
+        }
+
+        template < typename Archive >
+        struct IndexSerializer;
+
+        template < typename Adapter, typename Context >
+        struct IndexSerializer< bitsery::Serializer< Adapter, Context > >
+        {
+            static void process(
+                bitsery::Serializer< Adapter, Context > &archive,
+                index_t &index )
+            {
+                if( index < LARGE_INDEX_4B || index == NO_ID )
+                {
+                    const auto value = index == NO_ID
+                                           ? NO_ID_4B
+                                           : static_cast< uint32_t >( index );
+                    archive.value4b( value );
+                    return;
+                }
+                archive.value4b( LARGE_INDEX_4B );
+                const auto value = static_cast< uint64_t >( index );
+                archive.value8b( value );
+            }
+        };
+
+        template < typename Adapter, typename Context >
+        struct IndexSerializer< bitsery::Deserializer< Adapter, Context > >
+        {
+            static void process(
+                bitsery::Deserializer< Adapter, Context > &archive,
+                index_t &index )
+            {
+                uint32_t value;
+                archive.value4b( value );
+                if( value == NO_ID_4B )
+                {
+                    index = NO_ID;
+                    return;
+                }
+                if( value != LARGE_INDEX_4B )
+                {
+                    index = value;
+                    return;
+                }
+                uint64_t large_value;
+                archive.value8b( large_value );
+                OPENGEODE_EXCEPTION( large_value < NO_ID,
+                    "[IndexSerializer] Index ", large_value,
+                    " does not fit in this build index type, "
+                    "use OPENGEODE_64BIT_INDICES" );
+                index = static_cast< index_t >( large_value );
+            }
+        };
+
+        /*!
+         * Attribute values of index_t type are written as raw 4 bytes values,
+         * NO_ID being mapped to the maximum 4 bytes value. This is exactly the
+         * 32 bits build layout, without any escape value, so every existing
+         * value is read back unchanged. A 64 bits build cannot write such a
+         * value if it does not fit on 4 bytes.
+         */
+        template < typename Archive >
+        struct IndexValueSerializer;
+
+        template < typename Adapter, typename Context >
+        struct IndexValueSerializer< bitsery::Serializer< Adapter, Context > >
+        {
+            static void process(
+                bitsery::Serializer< Adapter, Context > &archive,
+                index_t &value )
+            {
+                OPENGEODE_EXCEPTION( fits_in_4_bytes( value ),
+                    "[IndexValueSerializer] Attribute value ", value,
+                    " does not fit in 4 bytes" );
+                const auto raw_value = value == NO_ID
+                                           ? NO_ID_4B
+                                           : static_cast< uint32_t >( value );
+                archive.value4b( raw_value );
+            }
+        };
+
+        template < typename Adapter, typename Context >
+        struct IndexValueSerializer< bitsery::Deserializer< Adapter, Context > >
+        {
+            static void process(
+                bitsery::Deserializer< Adapter, Context > &archive,
+                index_t &value )
+            {
+                uint32_t raw_value;
+                archive.value4b( raw_value );
+                value = raw_value == NO_ID_4B ? NO_ID : raw_value;
+            }
+        };
+
+        template < typename Archive >
+        void serialize_index_value( Archive &archive, index_t &value )
+        {
+            IndexValueSerializer< Archive >::process( archive, value );
+        }
+    } // namespace detail
+
+    /*!
+     * Serialize an index field independently of the index_t width used by the
+     * build: files written by a 32 or a 64 bits indices build can be read by
+     * the other one as long as the indices fit.
+     */
+    template < typename Archive >
+    void serialize_index( Archive &archive, index_t &index )
+    {
+        detail::IndexSerializer< Archive >::process( archive, index );
+    }
+
+    template < typename Archive >
+    void serialize_indices( Archive &archive, std::vector< index_t > &indices )
+    {
+        archive.container(
+            indices, indices.max_size(), []( Archive &a, index_t &index ) {
+                serialize_index( a, index );
+            } );
+    }
+
+    template < typename Archive, size_t size >
+    void serialize_indices(
+        Archive &archive, std::array< index_t, size > &indices )
+    {
+        archive.container( indices, []( Archive &a, index_t &index ) {
+            serialize_index( a, index );
+        } );
+    }
+
+    /*!
+     * Serialize an attribute value with the bitsery brief syntax. Values of
+     * index_t type, and containers of them, are written on 4 bytes whatever
+     * the index_t width, with the raw 32 bits layout (no escape value).
+     */
+    template < typename Archive, typename T >
+    void serialize_value( Archive &archive, T &value )
+    {
+        archive( value );
+    }
+
+    template < typename Archive >
+    void serialize_value( Archive &archive, index_t &value )
+    {
+        detail::serialize_index_value( archive, value );
+    }
+
+    template < typename Archive >
+    void serialize_value( Archive &archive, std::vector< index_t > &value )
+    {
+        archive.container(
+            value, value.max_size(), []( Archive &a, index_t &item ) {
+                detail::serialize_index_value( a, item );
+            } );
+    }
+
+    template < typename Archive, size_t size >
+    void serialize_value(
+        Archive &archive, std::array< index_t, size > &value )
+    {
+        archive.container( value, []( Archive &a, index_t &item ) {
+            detail::serialize_index_value( a, item );
+        } );
+    }
+
     template < typename Archive, typename T >
     class DefaultGrowable
     {
@@ -73,7 +262,7 @@ namespace geode
         template < typename Fnc >
         void serialize( Archive &ser, const T &obj, Fnc &&fnc ) const
         {
-            constexpr index_t FIRST_VERSION{ 1 };
+            constexpr uint32_t FIRST_VERSION{ 1 };
             ser.ext4b( FIRST_VERSION, bitsery::ext::CompactValue{} );
             fnc( ser, const_cast< T & >( obj ) );
         }
@@ -81,7 +270,7 @@ namespace geode
         template < typename Fnc >
         void deserialize( Archive &des, T &obj, Fnc &&fnc ) const
         {
-            index_t current_version;
+            uint32_t current_version;
             des.ext4b( current_version, bitsery::ext::CompactValue{} );
             fnc( des, obj );
         }
@@ -90,7 +279,7 @@ namespace geode
     template < typename Archive, typename T >
     class Growable
     {
-        static constexpr index_t FIRST_VERSION{ 1 };
+        static constexpr uint32_t FIRST_VERSION{ 1 };
 
     public:
         Growable( absl::FixedArray< std::function< void( Archive &, T & ) > >
@@ -101,7 +290,7 @@ namespace geode
         Growable( absl::FixedArray< std::function< void( Archive &, T & ) > >
                       serializers,
             absl::FixedArray< std::function< void( T & ) > > initializers )
-            : version_( serializers.size() ),
+            : version_( static_cast< uint32_t >( serializers.size() ) ),
               serializers_( std::move( serializers ) ),
               initializers_( std::move( initializers ) )
         {
@@ -126,7 +315,7 @@ namespace geode
         void deserialize( Archive &des, T &obj, Fnc &&fnc ) const
         {
             geode_unused( fnc );
-            index_t current_version;
+            uint32_t current_version;
             des.ext4b( current_version, bitsery::ext::CompactValue{} );
             serializers_.at( current_version - 1 )( des, obj );
             if( !initializers_.empty() && current_version < version_ )
@@ -136,7 +325,7 @@ namespace geode
         }
 
     private:
-        index_t version_{ FIRST_VERSION };
+        uint32_t version_{ FIRST_VERSION };
         absl::FixedArray< std::function< void( Archive &, T & ) > >
             serializers_;
         absl::FixedArray< std::function< void( T & ) > > initializers_;
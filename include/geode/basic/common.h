@@ -107,3 +107,15 @@ void geode_unused( const T & /*unused*/ )
 #include <geode/basic/assert.h>
 #include <geode/basic/opengeode_basic_export.h>
 #include <geode/basic/types.h>
+
+namespace geode
+{
+    /*!
+     * Copy a string view into a null-terminated string,
+     * e.g. to use it as a Factory key.
+     */
+    inline std::string to_string( absl::string_view view )
+    {
+        return { view.data(), view.size() };
+    }
+} // namespace geode
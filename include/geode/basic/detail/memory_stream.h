@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <istream>
+#include <streambuf>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/common.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Read-only stream buffer over a contiguous memory block.
+         * No copy is done: the memory block should outlive the buffer.
+         */
+        class MemoryInputBuffer : public std::streambuf
+        {
+        public:
+            explicit MemoryInputBuffer( absl::Span< const char > buffer )
+            {
+                auto* begin = const_cast< char* >( buffer.data() );
+                setg( begin, begin, begin + buffer.size() );
+            }
+
+        protected:
+            pos_type seekoff( off_type offset,
+                std::ios_base::seekdir direction,
+                std::ios_base::openmode /*unused*/ ) override
+            {
+                char* position{ nullptr };
+                if( direction == std::ios_base::beg )
+                {
+                    position = eback() + offset;
+                }
+                else if( direction == std::ios_base::cur )
+                {
+                    position = gptr() + offset;
+                }
+                else
+                {
+                    position = egptr() + offset;
+                }
+                if( position < eback() || position > egptr() )
+                {
+                    return pos_type( off_type( -1 ) );
+                }
+                setg( eback(), position, egptr() );
+                return pos_type( position - eback() );
+            }
+
+            pos_type seekpos(
+                pos_type position, std::ios_base::openmode mode ) override
+            {
+                return seekoff(
+                    off_type( position ), std::ios_base::beg, mode );
+            }
+        };
+
+        /*!
+         * Input stream reading a contiguous memory block without copying it.
+         */
+        class MemoryInputStream : private MemoryInputBuffer, public std::istream
+        {
+        public:
+            explicit MemoryInputStream( absl::Span< const char > buffer )
+                : MemoryInputBuffer( buffer ),
+                  std::istream( static_cast< std::streambuf* >( this ) )
+            {
+            }
+        };
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/assert.h>
+#include <geode/basic/range.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Check that each index of [0, permutation.size()) appears once in
+         * the permutation.
+         * @exception OpenGeodeException if the input is not a permutation
+         */
+        inline void check_permutation( absl::Span< const index_t > permutation )
+        {
+            std::vector< bool > is_used( permutation.size(), false );
+            for( const auto old_id : permutation )
+            {
+                OPENGEODE_EXCEPTION(
+                    old_id < permutation.size() && !is_used[old_id],
+                    "[check_permutation] Input is not a permutation" );
+                is_used[old_id] = true;
+            }
+        }
+
+        /*!
+         * Inverse a permutation given as permutation[new_id] = old_id.
+         * @return the mapping old2new[old_id] = new_id
+         * @exception OpenGeodeException if the input is not a permutation
+         */
+        inline std::vector< index_t > old2new_permutation(
+            absl::Span< const index_t > permutation )
+        {
+            std::vector< index_t > old2new( permutation.size(), NO_ID );
+            for( const auto i : Indices{ permutation } )
+            {
+                OPENGEODE_EXCEPTION( permutation[i] < permutation.size()
+                                         && old2new[permutation[i]] == NO_ID,
+                    "[old2new_permutation] Input is not a permutation" );
+                old2new[permutation[i]] = i;
+            }
+            return old2new;
+        }
+
+        /*!
+         * Reorder the container values following permutation[new_id] =
+         * old_id.
+         */
+        template < typename Container >
+        void permute( Container& data, absl::Span< const index_t > permutation )
+        {
+            Container old_data( std::move( data ) );
+            data.clear();
+            data.reserve( old_data.size() );
+            for( const auto old_id : permutation )
+            {
+                data.push_back( old_data[old_id] );
+            }
+        }
+    } // namespace detail
+} // namespace geode
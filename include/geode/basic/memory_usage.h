@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geode/basic/common.h>
+
+namespace geode
+{
+    /*!
+     * Memory footprint of an object detailed as a tree of named parts
+     * (attribute managers, attributes, auxiliary indices...).
+     * Sizes are given in bytes and are estimations of the memory owned by
+     * each part, excluding allocator overheads.
+     */
+    struct opengeode_basic_api MemoryUsage
+    {
+        MemoryUsage() = default;
+        MemoryUsage( std::string name_in, size_t bytes_in );
+
+        /*!
+         * Add a part to this node, the part is renamed to the given name.
+         * @return The added part
+         */
+        MemoryUsage& add_child( std::string child_name, MemoryUsage child );
+
+        /*!
+         * Add a leaf part using the given number of bytes.
+         * @return The added part
+         */
+        MemoryUsage& add_child( std::string child_name, size_t child_bytes );
+
+        /*!
+         * Return the number of bytes of this node and all its parts.
+         */
+        size_t total() const;
+
+        /*!
+         * Return the total number of bytes of this node and of each part
+         * identified by its path, e.g. "BRep/Surfaces/<uuid>/vertices".
+         */
+        std::vector< std::pair< std::string, size_t > > flatten() const;
+
+        /*!
+         * Return an indented description of the tree, one part per line.
+         */
+        std::string string() const;
+
+        std::string name;
+        size_t bytes{ 0 };
+        std::vector< MemoryUsage > children;
+    };
+} // namespace geode
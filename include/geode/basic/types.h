@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -33,8 +35,13 @@ namespace geode
     static constexpr double global_epsilon2{ global_epsilon * global_epsilon };
     static constexpr double global_epsilon3{ global_epsilon2 * global_epsilon };
 
+#ifdef OPENGEODE_64BIT_INDICES
+    using index_t = uint64_t;
+    using signed_index_t = int64_t;
+#else
     using index_t = unsigned int;
     using signed_index_t = int;
+#endif
 
     /// Value used for a invalid index
     static constexpr index_t NO_ID = index_t( -1 );
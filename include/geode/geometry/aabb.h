@@ -29,6 +29,12 @@
 
 #pragma once
 
+#include <iosfwd>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <absl/strings/string_view.h>
 #include <absl/types/span.h>
 
 #include <geode/basic/pimpl.h>
@@ -54,9 +60,24 @@ namespace geode
          * tree which should match the index in its initial container.
          */
         AABBTree( absl::Span< const BoundingBox< dimension > > bboxes );
+        /*!
+         * @brief Creates an empty tree, only meant to be filled by
+         * deserialization (see load_aabb_tree).
+         * @note Queries on an empty tree find no element.
+         */
+        AABBTree();
         AABBTree( AABBTree&& ) = default;
         ~AABBTree();
 
+        /*!
+         * @brief Checks that the tree was built from the given boxes.
+         * @details Compares a checksum of the \p bboxes to the one computed
+         * when the tree was built. A loaded tree should be checked against
+         * the current geometry before any query.
+         */
+        bool is_built_from(
+            absl::Span< const BoundingBox< dimension > > bboxes ) const;
+
         /*!
          * @brief Gets the number of boxes in the lower level of the aabb tree.
          * @note This value should match the initial size of the container that
@@ -69,8 +90,11 @@ namespace geode
          * @param[in] query the point to test
          * @param[in] action the functor to compute the distance between
          * the \p query and the tree element in boxes
+         * @param[in] max_distance only elements closer than this distance are
+         * considered, boxes further away are pruned.
          * @return a tuple containing:
-         * - the index of the closest element/box.
+         * - the index of the closest element/box, NO_ID if the tree is empty
+         * or if no element is closer than \p max_distance.
          * - the nearest point on the element in box.
          * - the distance between the \p query and \p nearest_point.
          *
@@ -90,7 +114,80 @@ namespace geode
          */
         template < typename EvalDistance >
         std::tuple< index_t, Point< dimension >, double > closest_element_box(
-            const Point< dimension >& query, const EvalDistance& action ) const;
+            const Point< dimension >& query,
+            const EvalDistance& action,
+            double max_distance = std::numeric_limits< double >::max() ) const;
+
+        /*!
+         * @brief Gets the closest element to a point, evaluating the
+         * elements by blocks
+         * @details In subtrees holding at most 16 elements, the elements
+         * whose box is closer than the current distance are gathered and
+         * their distances are computed by a single call to \p block_action,
+         * e.g. with the batched kernels of batch_distance.h.
+         * @param[in] query the point to test
+         * @param[in] block_action the functor computing the distances between
+         * the \p query and a block of tree elements
+         * @param[in] action the functor computing the distance and the nearest
+         * point between the \p query and one tree element, with the same
+         * definition than for closest_element_box. It is only called on the
+         * closest element.
+         * @param[in] max_distance only elements closer than this distance are
+         * considered, boxes further away are pruned.
+         * @return the same tuple than closest_element_box.
+         *
+         * @tparam EvalBlockDistances this functor should have an operator()
+         * defined like this:
+         *  void operator()( const Point< dimension >& query,
+         *      absl::Span< const index_t > element_boxes,
+         *      absl::Span< double > distances ) const ;
+         * filling one distance per element box.
+         */
+        template < typename EvalBlockDistances, typename EvalDistance >
+        std::tuple< index_t, Point< dimension >, double >
+            closest_element_box_by_blocks( const Point< dimension >& query,
+                const EvalBlockDistances& block_action,
+                const EvalDistance& action,
+                double max_distance =
+                    std::numeric_limits< double >::max() ) const;
+
+        /*!
+         * @brief Gets the k closest elements to a point
+         * @param[in] query the point to test
+         * @param[in] k the number of elements to find
+         * @param[in] action the functor to compute the distance between
+         * the \p query and the tree element in boxes, with the same
+         * definition than for closest_element_box.
+         * @return at most \p k tuples sorted by increasing distance, each
+         * containing:
+         * - the index of the element/box.
+         * - the nearest point on the element in box.
+         * - the distance between the \p query and the nearest point.
+         * @note Nodes are visited by increasing distance to the query, and
+         * pruned once \p k elements closer than them are found.
+         */
+        template < typename EvalDistance >
+        std::vector< std::tuple< index_t, Point< dimension >, double > >
+            closest_element_boxes( const Point< dimension >& query,
+                index_t k,
+                const EvalDistance& action ) const;
+
+        /*!
+         * @brief Gets all the elements within a given distance of a point
+         * @param[in] query the point to test
+         * @param[in] radius the maximal distance between \p query and the
+         * returned elements.
+         * @param[in] action the functor to compute the distance between
+         * the \p query and the tree element in boxes, with the same
+         * definition than for closest_element_box.
+         * @return tuples sorted by increasing distance, with the same content
+         * than for closest_element_boxes.
+         */
+        template < typename EvalDistance >
+        std::vector< std::tuple< index_t, Point< dimension >, double > >
+            elements_within_distance( const Point< dimension >& query,
+                double radius,
+                const EvalDistance& action ) const;
 
         /*!
          * @brief Computes the intersections between a given
@@ -129,6 +226,24 @@ namespace geode
         void compute_self_element_bbox_intersections(
             EvalIntersection& action ) const;
 
+        /*!
+         * @brief Computes the intersections between the element boxes of
+         * this tree and the element boxes of another tree.
+         * Both trees are descended simultaneously, so that pairs of subtrees
+         * with disjoint boxes are pruned at once.
+         * @param[in] other The other tree.
+         * @param[in] action The functor to run when two boxes intersect
+         * @tparam EvalIntersection this functor should have an operator()
+         * defined like this:
+         * void operator()( index_t element_box, index_t other_element_box ) ;
+         * @note element_box is an element box index of this tree and
+         * other_element_box an element box index of \p other.
+         */
+        template < class EvalIntersection >
+        void compute_other_element_bbox_intersections(
+            const AABBTree< dimension >& other,
+            EvalIntersection& action ) const;
+
         /*!
          * @brief Computes the intersections between a given ray and all
          * element boxes.
@@ -165,10 +280,55 @@ namespace geode
 
         const BoundingBox< dimension >& node( index_t i ) const;
 
+    private:
+        friend class bitsery::Access;
+        template < typename Archive >
+        void serialize( Archive& archive );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
     ALIAS_2D_AND_3D( AABBTree );
+
+    /*!
+     * API function for saving an AABBTree, so that it does not have to be
+     * rebuilt for static geometries.
+     * The flat tree layout is written in bulk, with a checksum of the boxes
+     * it was built from.
+     * @param[in] tree AABBTree to save.
+     * @param[in] filename Path to the file where save the tree.
+     */
+    template < index_t dimension >
+    void save_aabb_tree(
+        const AABBTree< dimension >& tree, absl::string_view filename );
+
+    /*!
+     * API function for saving an AABBTree in a stream.
+     * @param[in] tree AABBTree to save.
+     * @param[in] stream Stream to write to.
+     */
+    template < index_t dimension >
+    void save_aabb_tree(
+        const AABBTree< dimension >& tree, std::ostream& stream );
+
+    /*!
+     * API function for loading an AABBTree saved with save_aabb_tree.
+     * @param[in] filename Path to the file to load.
+     * @warning Use AABBTree::is_built_from to check the loaded tree against
+     * the current geometry.
+     */
+    template < index_t dimension >
+    AABBTree< dimension > load_aabb_tree( absl::string_view filename );
+
+    /*!
+     * API function for loading an AABBTree from a stream, e.g. a stream over
+     * a memory mapped file.
+     * @param[in] stream Stream to read from.
+     * @warning Use AABBTree::is_built_from to check the loaded tree against
+     * the current geometry.
+     */
+    template < index_t dimension >
+    AABBTree< dimension > load_aabb_tree( std::istream& stream );
 } // namespace geode
 
 #include <geode/geometry/detail/aabb_impl.h>
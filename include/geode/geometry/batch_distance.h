@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <tuple>
+
+#include <absl/container/inlined_vector.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/range.h>
+
+#include <geode/geometry/common.h>
+#include <geode/geometry/point.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Segment );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Triangle );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Set of simplices (segments or triangles) whose vertex coordinates are
+     * stored by vertex and by axis in contiguous arrays (structure of
+     * arrays), so that the distance kernels load the same coordinate of
+     * several simplices into one SIMD register.
+     * Batches of up to 16 simplices, e.g. the element blocks of an AABBTree,
+     * do not allocate.
+     */
+    template < index_t dimension, index_t nb_vertices >
+    class SimplexBatch
+    {
+    public:
+        index_t size() const
+        {
+            return static_cast< index_t >( coordinates_[0][0].size() );
+        }
+
+        void reserve( index_t capacity )
+        {
+            for( auto& vertex : coordinates_ )
+            {
+                for( auto& axis : vertex )
+                {
+                    axis.reserve( capacity );
+                }
+            }
+        }
+
+        void clear()
+        {
+            for( auto& vertex : coordinates_ )
+            {
+                for( auto& axis : vertex )
+                {
+                    axis.clear();
+                }
+            }
+        }
+
+        /*!
+         * Add a simplex given by its vertices.
+         * @return the index of the simplex in the batch.
+         */
+        index_t add( const std::array< Point< dimension >, nb_vertices >&
+                vertices )
+        {
+            const auto id = size();
+            for( const auto v : Range{ nb_vertices } )
+            {
+                for( const auto d : Range{ dimension } )
+                {
+                    coordinates_[v][d].push_back( vertices[v].value( d ) );
+                }
+            }
+            return id;
+        }
+
+        /*!
+         * Resize the batch, new simplices should then be filled with
+         * set_vertex().
+         */
+        void resize( index_t size )
+        {
+            for( auto& vertex : coordinates_ )
+            {
+                for( auto& axis : vertex )
+                {
+                    axis.resize( size );
+                }
+            }
+        }
+
+        /*!
+         * Set the vertex \p vertex of the simplex \p simplex.
+         */
+        void set_vertex(
+            index_t simplex, index_t vertex, const Point< dimension >& point )
+        {
+            for( const auto d : Range{ dimension } )
+            {
+                coordinates_[vertex][d][simplex] = point.value( d );
+            }
+        }
+
+        /*!
+         * Get the coordinates along \p axis of the vertex \p vertex of all
+         * simplices.
+         */
+        const double* coordinates( index_t vertex, index_t axis ) const
+        {
+            return coordinates_[vertex][axis].data();
+        }
+
+    private:
+        std::array< std::array< absl::InlinedVector< double, 16 >, dimension >,
+            nb_vertices >
+            coordinates_;
+    };
+    template < index_t dimension >
+    using SegmentBatch = SimplexBatch< dimension, 2 >;
+    template < index_t dimension >
+    using TriangleBatch = SimplexBatch< dimension, 3 >;
+    ALIAS_2D_AND_3D( SegmentBatch );
+    ALIAS_2D_AND_3D( TriangleBatch );
+
+    /*
+     * The kernels below evaluate 4 elements (or points) at once with AVX, 2
+     * with SSE2, depending on the instruction set the library is compiled
+     * for, and fall back to scalar code otherwise and for the remaining
+     * elements.
+     */
+
+    /*!
+     * Compute the smallest distances between a point and each segment of a
+     * batch.
+     * @param[out] distances Output distances, one per segment.
+     */
+    template < index_t dimension >
+    void point_segments_distances( const Point< dimension >& point,
+        const SegmentBatch< dimension >& segments,
+        absl::Span< double > distances );
+
+    /*!
+     * Compute the smallest distances between each point and a segment.
+     * @param[out] distances Output distances, one per point.
+     */
+    template < index_t dimension >
+    void points_segment_distances(
+        absl::Span< const Point< dimension > > points,
+        const Segment< dimension >& segment,
+        absl::Span< double > distances );
+
+    /*!
+     * Find the closest segment of a batch to a point
+     * @return a tuple containing:
+     * - the index of the closest segment in the batch.
+     * - the distance to this segment.
+     */
+    template < index_t dimension >
+    std::tuple< index_t, double > point_closest_segment(
+        const Point< dimension >& point,
+        const SegmentBatch< dimension >& segments );
+
+    /*!
+     * Compute the smallest distances between a point and each triangle of a
+     * batch.
+     * @param[out] distances Output distances, one per triangle.
+     */
+    template < index_t dimension >
+    void point_triangles_distances( const Point< dimension >& point,
+        const TriangleBatch< dimension >& triangles,
+        absl::Span< double > distances );
+
+    /*!
+     * Compute the smallest distances between each point and a triangle.
+     * @param[out] distances Output distances, one per point.
+     */
+    template < index_t dimension >
+    void points_triangle_distances(
+        absl::Span< const Point< dimension > > points,
+        const Triangle< dimension >& triangle,
+        absl::Span< double > distances );
+
+    /*!
+     * Find the closest triangle of a batch to a point
+     * @return a tuple containing:
+     * - the index of the closest triangle in the batch.
+     * - the distance to this triangle.
+     * @note the nearest point is not computed, use point_triangle_distance on
+     * the returned triangle if needed.
+     */
+    template < index_t dimension >
+    std::tuple< index_t, double > point_closest_triangle(
+        const Point< dimension >& point,
+        const TriangleBatch< dimension >& triangles );
+} // namespace geode
@@ -29,9 +29,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <queue>
+
 #include <geode/basic/pimpl_impl.h>
 
 #include <geode/geometry/aabb.h>
+#include <geode/geometry/detail/geometry_checksum.h>
 #include <geode/geometry/perpendicular.h>
 
 namespace geode
@@ -52,7 +57,9 @@ namespace geode
     {
     public:
         static constexpr index_t ROOT_INDEX{ 1 };
+        static constexpr index_t CLOSEST_BLOCK_SIZE{ 16 };
 
+        Impl() = default;
         Impl( absl::Span< const BoundingBox< dimension > > bboxes );
 
         index_t nb_bboxes() const
@@ -60,6 +67,23 @@ namespace geode
             return mapping_morton_.size();
         }
 
+        uint64_t checksum() const
+        {
+            return checksum_;
+        }
+
+        static uint64_t compute_checksum(
+            absl::Span< const BoundingBox< dimension > > bboxes )
+        {
+            detail::GeometryChecksum checksum;
+            for( const auto& bbox : bboxes )
+            {
+                checksum.add_point( bbox.min() );
+                checksum.add_point( bbox.max() );
+            }
+            return checksum.value();
+        }
+
         const BoundingBox< dimension >& node( index_t i ) const
         {
             OPENGEODE_ASSERT( i < tree_.size(), "query out of tree" );
@@ -111,6 +135,53 @@ namespace geode
             index_t element_end,
             const ACTION& action ) const;
 
+        /*!
+         * @brief The recursive instruction used in
+         * closest_element_box_by_blocks()
+         */
+        template < typename BLOCK_ACTION >
+        void closest_element_block_recursive( const Point< dimension >& query,
+            index_t& nearest_box,
+            double& distance,
+            index_t node_index,
+            index_t element_begin,
+            index_t element_end,
+            const BLOCK_ACTION& block_action ) const;
+
+        /*!
+         * @brief Gathers the elements of a block whose box is closer than
+         * \p distance, used in closest_element_block_recursive()
+         */
+        void gather_block_recursive( const Point< dimension >& query,
+            double distance,
+            index_t node_index,
+            index_t element_begin,
+            index_t element_end,
+            std::array< index_t, CLOSEST_BLOCK_SIZE >& boxes,
+            index_t& nb_boxes ) const;
+
+        /*!
+         * @brief The best first search used in closest_element_boxes()
+         */
+        template < typename ACTION >
+        std::vector< std::tuple< index_t, Point< dimension >, double > >
+            closest_element_boxes_search( const Point< dimension >& query,
+                index_t k,
+                const ACTION& action ) const;
+
+        /*!
+         * @brief The recursive instruction used in elements_within_distance()
+         */
+        template < typename ACTION >
+        void within_distance_recursive( const Point< dimension >& query,
+            double radius,
+            std::vector< std::tuple< index_t, Point< dimension >, double > >&
+                elements,
+            index_t node_index,
+            index_t element_begin,
+            index_t element_end,
+            const ACTION& action ) const;
+
         template < class ACTION >
         void bbox_intersect_recursive( const BoundingBox< dimension >& box,
             index_t node_index,
@@ -127,6 +198,16 @@ namespace geode
             index_t element_end2,
             ACTION& action ) const;
 
+        template < class ACTION >
+        void other_intersect_recursive( const Impl& other,
+            index_t node_index1,
+            index_t element_begin1,
+            index_t element_end1,
+            index_t node_index2,
+            index_t element_begin2,
+            index_t element_end2,
+            ACTION& action ) const;
+
         template < class ACTION >
         void ray_intersect_recursive( const Ray< dimension >& ray,
             index_t node_index,
@@ -134,9 +215,15 @@ namespace geode
             index_t element_end,
             ACTION& action ) const;
 
+    private:
+        friend class bitsery::Access;
+        template < typename Archive >
+        void serialize( Archive& archive );
+
     private:
         std::vector< BoundingBox< dimension > > tree_;
         std::vector< index_t > mapping_morton_;
+        uint64_t checksum_{ detail::GeometryChecksum{}.value() };
     };
 
     template < index_t dimension >
@@ -156,8 +243,14 @@ namespace geode
     template < typename EvalDistance >
     std::tuple< index_t, Point< dimension >, double >
         AABBTree< dimension >::closest_element_box(
-            const Point< dimension >& query, const EvalDistance& action ) const
+            const Point< dimension >& query,
+            const EvalDistance& action,
+            double max_distance ) const
     {
+        if( nb_bboxes() == 0 )
+        {
+            return std::make_tuple( NO_ID, Point< dimension >{}, max_distance );
+        }
         index_t box_begin{ 0 };
         index_t box_end{ nb_bboxes() };
         index_t node_index{ Impl::ROOT_INDEX };
@@ -185,18 +278,90 @@ namespace geode
         double distance;
         Point< dimension > nearest_point;
         std::tie( distance, nearest_point ) = action( query, nearest_box );
+        if( distance >= max_distance )
+        {
+            nearest_box = NO_ID;
+            distance = max_distance;
+        }
 
         impl_->closest_element_box_recursive( query, nearest_box, nearest_point,
             distance, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
-        OPENGEODE_ASSERT( nearest_box != NO_ID, "No box found" );
         return std::make_tuple( nearest_box, nearest_point, distance );
     }
 
+    template < index_t dimension >
+    template < typename EvalBlockDistances, typename EvalDistance >
+    std::tuple< index_t, Point< dimension >, double >
+        AABBTree< dimension >::closest_element_box_by_blocks(
+            const Point< dimension >& query,
+            const EvalBlockDistances& block_action,
+            const EvalDistance& action,
+            double max_distance ) const
+    {
+        auto nearest_box = NO_ID;
+        auto distance = max_distance;
+        if( nb_bboxes() != 0 )
+        {
+            impl_->closest_element_block_recursive( query, nearest_box,
+                distance, Impl::ROOT_INDEX, 0, nb_bboxes(), block_action );
+        }
+        if( nearest_box == NO_ID )
+        {
+            return std::make_tuple( NO_ID, Point< dimension >{}, max_distance );
+        }
+        Point< dimension > nearest_point;
+        std::tie( distance, nearest_point ) = action( query, nearest_box );
+        return std::make_tuple( nearest_box, nearest_point, distance );
+    }
+
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::vector< std::tuple< index_t, Point< dimension >, double > >
+        AABBTree< dimension >::closest_element_boxes(
+            const Point< dimension >& query,
+            index_t k,
+            const EvalDistance& action ) const
+    {
+        if( k == 0 || nb_bboxes() == 0 )
+        {
+            return {};
+        }
+        return impl_->closest_element_boxes_search( query, k, action );
+    }
+
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::vector< std::tuple< index_t, Point< dimension >, double > >
+        AABBTree< dimension >::elements_within_distance(
+            const Point< dimension >& query,
+            double radius,
+            const EvalDistance& action ) const
+    {
+        std::vector< std::tuple< index_t, Point< dimension >, double > >
+            elements;
+        if( nb_bboxes() == 0 )
+        {
+            return elements;
+        }
+        impl_->within_distance_recursive(
+            query, radius, elements, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
+        std::sort( elements.begin(), elements.end(),
+            []( const std::tuple< index_t, Point< dimension >, double >& lhs,
+                const std::tuple< index_t, Point< dimension >, double >& rhs ) {
+                return std::get< 2 >( lhs ) < std::get< 2 >( rhs );
+            } );
+        return elements;
+    }
+
     template < index_t dimension >
     template < class EvalIntersection >
     void AABBTree< dimension >::compute_bbox_element_bbox_intersections(
         const BoundingBox< dimension >& box, EvalIntersection& action ) const
     {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
         impl_->bbox_intersect_recursive(
             box, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
     }
@@ -206,15 +371,36 @@ namespace geode
     void AABBTree< dimension >::compute_self_element_bbox_intersections(
         EvalIntersection& action ) const
     {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
         impl_->self_intersect_recursive( Impl::ROOT_INDEX, 0, nb_bboxes(),
             Impl::ROOT_INDEX, 0, nb_bboxes(), action );
     }
 
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void AABBTree< dimension >::compute_other_element_bbox_intersections(
+        const AABBTree< dimension >& other, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 || other.nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->other_intersect_recursive( *other.impl_, Impl::ROOT_INDEX, 0,
+            nb_bboxes(), Impl::ROOT_INDEX, 0, other.nb_bboxes(), action );
+    }
+
     template < index_t dimension >
     template < class EvalIntersection >
     void AABBTree< dimension >::compute_ray_element_bbox_intersections(
         const Ray< dimension >& ray, EvalIntersection& action ) const
     {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
         impl_->ray_intersect_recursive(
             ray, Impl::ROOT_INDEX, 0, nb_bboxes(), action );
     }
@@ -299,6 +485,115 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    template < typename BLOCK_ACTION >
+    void AABBTree< dimension >::Impl::closest_element_block_recursive(
+        const Point< dimension >& query,
+        index_t& nearest_box,
+        double& distance,
+        index_t node_index,
+        index_t box_begin,
+        index_t box_end,
+        const BLOCK_ACTION& block_action ) const
+    {
+        OPENGEODE_ASSERT( node_index < tree_.size(), "node out of tree" );
+        OPENGEODE_ASSERT(
+            box_begin != box_end, "Begin and End indices should be different" );
+
+        // If node holds few elements: gather the ones whose box may hold a
+        // nearer element, compute their distances at once and replace
+        // current if one is nearer
+        if( box_end - box_begin <= CLOSEST_BLOCK_SIZE )
+        {
+            std::array< index_t, CLOSEST_BLOCK_SIZE > boxes;
+            index_t nb_boxes{ 0 };
+            gather_block_recursive( query, distance, node_index, box_begin,
+                box_end, boxes, nb_boxes );
+            if( nb_boxes == 0 )
+            {
+                return;
+            }
+            std::array< double, CLOSEST_BLOCK_SIZE > distances;
+            block_action( query, absl::MakeConstSpan( boxes.data(), nb_boxes ),
+                absl::MakeSpan( distances.data(), nb_boxes ) );
+            for( const auto b : Range{ nb_boxes } )
+            {
+                if( distances[b] < distance )
+                {
+                    nearest_box = boxes[b];
+                    distance = distances[b];
+                }
+            }
+            return;
+        }
+        index_t box_middle, child_left, child_right;
+        get_recursive_iterators( node_index, box_begin, box_end, box_middle,
+            child_left, child_right );
+
+        const auto distance_left =
+            point_box_signed_distance( query, node( child_left ) );
+        const auto distance_right =
+            point_box_signed_distance( query, node( child_right ) );
+
+        // Traverse the "nearest" child first, so that it has more chances
+        // to prune the traversal of the other child.
+        if( distance_left < distance_right )
+        {
+            if( distance_left < distance )
+            {
+                closest_element_block_recursive( query, nearest_box, distance,
+                    child_left, box_begin, box_middle, block_action );
+            }
+            if( distance_right < distance )
+            {
+                closest_element_block_recursive( query, nearest_box, distance,
+                    child_right, box_middle, box_end, block_action );
+            }
+        }
+        else
+        {
+            if( distance_right < distance )
+            {
+                closest_element_block_recursive( query, nearest_box, distance,
+                    child_right, box_middle, box_end, block_action );
+            }
+            if( distance_left < distance )
+            {
+                closest_element_block_recursive( query, nearest_box, distance,
+                    child_left, box_begin, box_middle, block_action );
+            }
+        }
+    }
+
+    template < index_t dimension >
+    void AABBTree< dimension >::Impl::gather_block_recursive(
+        const Point< dimension >& query,
+        double distance,
+        index_t node_index,
+        index_t box_begin,
+        index_t box_end,
+        std::array< index_t, CLOSEST_BLOCK_SIZE >& boxes,
+        index_t& nb_boxes ) const
+    {
+        if( point_box_signed_distance( query, node( node_index ) )
+            >= distance )
+        {
+            return;
+        }
+        if( box_end == box_begin + 1 )
+        {
+            boxes[nb_boxes++] = mapping_morton_[box_begin];
+            return;
+        }
+        index_t box_middle, child_left, child_right;
+        get_recursive_iterators( node_index, box_begin, box_end, box_middle,
+            child_left, child_right );
+        gather_block_recursive( query, distance, child_left, box_begin,
+            box_middle, boxes, nb_boxes );
+        gather_block_recursive( query, distance, child_right, box_middle,
+            box_end, boxes, nb_boxes );
+    }
+
     template < index_t dimension >
     template < typename ACTION >
     void AABBTree< dimension >::Impl::bbox_intersect_recursive(
@@ -409,6 +704,199 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    template < typename ACTION >
+    std::vector< std::tuple< index_t, Point< dimension >, double > >
+        AABBTree< dimension >::Impl::closest_element_boxes_search(
+            const Point< dimension >& query,
+            index_t k,
+            const ACTION& action ) const
+    {
+        struct Node
+        {
+            // Reversed order so that the priority queue pops the nearest
+            // node first
+            bool operator<( const Node& other ) const
+            {
+                return distance > other.distance;
+            }
+
+            double distance;
+            index_t index;
+            index_t element_begin;
+            index_t element_end;
+        };
+        using Element = std::tuple< index_t, Point< dimension >, double >;
+        const auto farther = []( const Element& lhs, const Element& rhs ) {
+            return std::get< 2 >( lhs ) < std::get< 2 >( rhs );
+        };
+
+        // Max heap of the k nearest elements found so far
+        std::vector< Element > nearest;
+        nearest.reserve( k );
+        const auto worst_distance = [&nearest, k] {
+            return nearest.size() < k ? std::numeric_limits< double >::max()
+                                      : std::get< 2 >( nearest.front() );
+        };
+        std::priority_queue< Node > nodes;
+        nodes.push( { point_box_signed_distance( query, node( ROOT_INDEX ) ),
+            ROOT_INDEX, 0, nb_bboxes() } );
+        while( !nodes.empty() )
+        {
+            const auto current = nodes.top();
+            nodes.pop();
+            if( current.distance >= worst_distance() )
+            {
+                break;
+            }
+            if( is_leaf( current.element_begin, current.element_end ) )
+            {
+                const auto cur_box = mapping_morton_[current.element_begin];
+                Point< dimension > cur_nearest_point;
+                double cur_distance;
+                std::tie( cur_distance, cur_nearest_point ) =
+                    action( query, cur_box );
+                if( cur_distance >= worst_distance() )
+                {
+                    continue;
+                }
+                if( nearest.size() == k )
+                {
+                    std::pop_heap( nearest.begin(), nearest.end(), farther );
+                    nearest.pop_back();
+                }
+                nearest.emplace_back(
+                    cur_box, cur_nearest_point, cur_distance );
+                std::push_heap( nearest.begin(), nearest.end(), farther );
+                continue;
+            }
+            index_t box_middle, child_left, child_right;
+            get_recursive_iterators( current.index, current.element_begin,
+                current.element_end, box_middle, child_left, child_right );
+            const auto distance_left =
+                point_box_signed_distance( query, node( child_left ) );
+            if( distance_left < worst_distance() )
+            {
+                nodes.push( { distance_left, child_left, current.element_begin,
+                    box_middle } );
+            }
+            const auto distance_right =
+                point_box_signed_distance( query, node( child_right ) );
+            if( distance_right < worst_distance() )
+            {
+                nodes.push( { distance_right, child_right, box_middle,
+                    current.element_end } );
+            }
+        }
+        std::sort_heap( nearest.begin(), nearest.end(), farther );
+        return nearest;
+    }
+
+    template < index_t dimension >
+    template < typename ACTION >
+    void AABBTree< dimension >::Impl::within_distance_recursive(
+        const Point< dimension >& query,
+        double radius,
+        std::vector< std::tuple< index_t, Point< dimension >, double > >&
+            elements,
+        index_t node_index,
+        index_t element_begin,
+        index_t element_end,
+        const ACTION& action ) const
+    {
+        OPENGEODE_ASSERT( node_index < tree_.size(), "node out of tree" );
+        OPENGEODE_ASSERT(
+            element_begin != element_end, "No iteration allowed start == end" );
+
+        // Prune sub-tree further than the radius
+        if( point_box_signed_distance( query, node( node_index ) ) > radius )
+        {
+            return;
+        }
+
+        if( is_leaf( element_begin, element_end ) )
+        {
+            const auto cur_box = mapping_morton_[element_begin];
+            Point< dimension > cur_nearest_point;
+            double cur_distance;
+            std::tie( cur_distance, cur_nearest_point ) =
+                action( query, cur_box );
+            if( cur_distance <= radius )
+            {
+                elements.emplace_back(
+                    cur_box, cur_nearest_point, cur_distance );
+            }
+            return;
+        }
+
+        index_t box_middle, child_left, child_right;
+        get_recursive_iterators( node_index, element_begin, element_end,
+            box_middle, child_left, child_right );
+        within_distance_recursive< ACTION >( query, radius, elements,
+            child_left, element_begin, box_middle, action );
+        within_distance_recursive< ACTION >( query, radius, elements,
+            child_right, box_middle, element_end, action );
+    }
+
+    template < index_t dimension >
+    template < typename ACTION >
+    void AABBTree< dimension >::Impl::other_intersect_recursive(
+        const Impl& other,
+        index_t node_index1,
+        index_t element_begin1,
+        index_t element_end1,
+        index_t node_index2,
+        index_t element_begin2,
+        index_t element_end2,
+        ACTION& action ) const
+    {
+        OPENGEODE_ASSERT( element_end1 != element_begin1,
+            "No iteration allowed start == end" );
+        OPENGEODE_ASSERT( element_end2 != element_begin2,
+            "No iteration allowed start == end" );
+
+        if( !node( node_index1 ).intersects( other.node( node_index2 ) ) )
+        {
+            return;
+        }
+
+        const auto is_leaf1 = is_leaf( element_begin1, element_end1 );
+        const auto is_leaf2 = is_leaf( element_begin2, element_end2 );
+        if( is_leaf1 && is_leaf2 )
+        {
+            action( mapping_morton_[element_begin1],
+                other.mapping_morton_[element_begin2] );
+            return;
+        }
+
+        // Descend into the subtree with the most boxes
+        if( is_leaf1
+            || element_end2 - element_begin2 > element_end1 - element_begin1 )
+        {
+            index_t middle_box2, child_left2, child_right2;
+            get_recursive_iterators( node_index2, element_begin2, element_end2,
+                middle_box2, child_left2, child_right2 );
+            other_intersect_recursive< ACTION >( other, node_index1,
+                element_begin1, element_end1, child_left2, element_begin2,
+                middle_box2, action );
+            other_intersect_recursive< ACTION >( other, node_index1,
+                element_begin1, element_end1, child_right2, middle_box2,
+                element_end2, action );
+        }
+        else
+        {
+            index_t middle_box1, child_left1, child_right1;
+            get_recursive_iterators( node_index1, element_begin1, element_end1,
+                middle_box1, child_left1, child_right1 );
+            other_intersect_recursive< ACTION >( other, child_left1,
+                element_begin1, middle_box1, node_index2, element_begin2,
+                element_end2, action );
+            other_intersect_recursive< ACTION >( other, child_right1,
+                middle_box1, element_end1, node_index2, element_begin2,
+                element_end2, action );
+        }
+    }
+
     template < index_t dimension >
     template < typename ACTION >
     void AABBTree< dimension >::Impl::ray_intersect_recursive(
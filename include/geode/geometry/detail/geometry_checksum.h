@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <geode/geometry/common.h>
+#include <geode/geometry/point.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * FNV-1a hash of point coordinates.
+         * The value only depends on the coordinate bits so it is stable
+         * across runs and platforms: it can be stored in a file to check that
+         * a persisted search structure still matches its source geometry.
+         */
+        class GeometryChecksum
+        {
+        public:
+            template < index_t dimension >
+            void add_point( const Point< dimension >& point )
+            {
+                for( const auto c : Range{ dimension } )
+                {
+                    add_value( point.value( c ) );
+                }
+            }
+
+            uint64_t value() const
+            {
+                return hash_;
+            }
+
+        private:
+            void add_value( double value )
+            {
+                uint64_t bits;
+                std::memcpy( &bits, &value, sizeof( double ) );
+                for( const auto byte : Range{ sizeof( double ) } )
+                {
+                    hash_ ^= ( bits >> ( 8 * byte ) ) & 0xff;
+                    hash_ *= FNV_PRIME;
+                }
+            }
+
+        private:
+            static constexpr uint64_t FNV_PRIME{ 1099511628211ULL };
+            uint64_t hash_{ 14695981039346656037ULL };
+        };
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/geometry/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Segment );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Triangle );
+    ALIAS_3D( Segment );
+    ALIAS_3D( Triangle );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Exact intersection detection between 3D objects, based on the robust
+     * predicates (see predicates.h).
+     * Objects are closed: touching objects (e.g. a segment ending on a
+     * triangle) intersect. Degenerate triangles (with collinear vertices)
+     * never intersect anything.
+     */
+
+    /*!
+     * Detect if a segment and a triangle intersect.
+     */
+    bool opengeode_geometry_api segment_triangle_intersection_detection(
+        const Segment3D& segment, const Triangle3D& triangle );
+
+    /*!
+     * Detect if two triangles intersect.
+     */
+    bool opengeode_geometry_api triangle_triangle_intersection_detection(
+        const Triangle3D& triangle0, const Triangle3D& triangle1 );
+} // namespace geode
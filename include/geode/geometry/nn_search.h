@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <iosfwd>
+#include <memory>
+
+#include <absl/strings/string_view.h>
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.h>
 
 #include <geode/geometry/common.h>
@@ -61,8 +67,22 @@ namespace geode
 
     public:
         explicit NNSearch( std::vector< Point< dimension > > points );
+        /*!
+         * Create an empty search structure, only meant to be filled by
+         * deserialization (see load_nn_search).
+         */
+        NNSearch();
         ~NNSearch();
 
+        /*!
+         * Check that the search structure was built from the given points
+         * by comparing their checksum to the one computed at construction.
+         * A loaded structure should be checked against the current geometry
+         * before any query.
+         */
+        bool is_built_from(
+            absl::Span< const Point< dimension > > points ) const;
+
         index_t nb_points() const;
 
         const Point< dimension >& point( index_t index ) const;
@@ -103,8 +123,54 @@ namespace geode
          */
         ColocatedInfo colocated_index_mapping( double epsilon ) const;
 
+    private:
+        friend class bitsery::Access;
+        template < typename Archive >
+        void serialize( Archive& archive );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
     ALIAS_2D_AND_3D( NNSearch );
+
+    /*!
+     * API function for saving a NNSearch with its kd-tree, so that it does not
+     * have to be rebuilt for static point sets.
+     * @param[in] search NNSearch to save.
+     * @param[in] filename Path to the file where save the search structure.
+     */
+    template < index_t dimension >
+    void save_nn_search(
+        const NNSearch< dimension >& search, absl::string_view filename );
+
+    /*!
+     * API function for saving a NNSearch in a stream.
+     * @param[in] search NNSearch to save.
+     * @param[in] stream Stream to write to.
+     */
+    template < index_t dimension >
+    void save_nn_search(
+        const NNSearch< dimension >& search, std::ostream& stream );
+
+    /*!
+     * API function for loading a NNSearch saved with save_nn_search.
+     * The kd-tree is read as is, it is not rebuilt.
+     * @param[in] filename Path to the file to load.
+     * @warning Use NNSearch::is_built_from to check the loaded structure
+     * against the current points.
+     */
+    template < index_t dimension >
+    std::unique_ptr< NNSearch< dimension > > load_nn_search(
+        absl::string_view filename );
+
+    /*!
+     * API function for loading a NNSearch from a stream, e.g. a stream over
+     * a memory mapped file.
+     * @param[in] stream Stream to read from.
+     * @warning Use NNSearch::is_built_from to check the loaded structure
+     * against the current points.
+     */
+    template < index_t dimension >
+    std::unique_ptr< NNSearch< dimension > > load_nn_search(
+        std::istream& stream );
 } // namespace geode
@@ -180,4 +180,37 @@ namespace geode
             return result;
         }
     };
+
+    template < index_t dimension >
+    struct AttributeLinearInterpolationsImpl< Point< dimension > >
+    {
+        template < template < typename > class Attribute >
+        static Point< dimension > compute(
+            const AttributeLinearInterpolations &interpolations,
+            index_t interpolation,
+            const Attribute< Point< dimension > > &attribute )
+        {
+            const auto indices = interpolations.indices( interpolation );
+            const auto lambdas = interpolations.lambdas( interpolation );
+            std::array< double, dimension > result;
+            result.fill( 0 );
+            for( const auto i : Indices{ indices } )
+            {
+                const auto &point = attribute.value( indices[i] );
+                for( const auto c : Range{ dimension } )
+                {
+                    result[c] += lambdas[i] * point.value( c );
+                }
+            }
+            return Point< dimension >{ result };
+        }
+    };
+
+    template < index_t dimension >
+    struct BulkAttributeSerialization< Point< dimension > >
+    {
+        static constexpr bool is_bulk = true;
+        using ItemType = double;
+        static constexpr index_t nb_items = dimension;
+    };
 } // namespace geode
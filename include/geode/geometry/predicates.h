@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    ALIAS_2D_AND_3D( Point );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Robust geometric predicates.
+     * Each predicate is first evaluated in floating point arithmetic with a
+     * forward error bound. Only when the result is too close to zero to be
+     * trusted, the determinant is evaluated again with exact arithmetic on
+     * floating point expansions, so the returned Side is always exact.
+     */
+
+    /*!
+     * Compute the orientation of three 2D points.
+     * @return positive if a, b and c are ordered counter-clockwise (i.e. the
+     * sign of triangle_signed_area), negative if clockwise and zero if they
+     * are collinear.
+     */
+    Side opengeode_geometry_api orient2d(
+        const Point2D& a, const Point2D& b, const Point2D& c );
+
+    /*!
+     * Compute the orientation of four 3D points.
+     * @return positive if d lies on the side of the plane (a, b, c) pointed
+     * by its normal (b-a) x (c-a) (i.e. the sign of tetra_signed_volume),
+     * negative on the other side and zero if the four points are coplanar.
+     */
+    Side opengeode_geometry_api orient3d( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        const Point3D& d );
+
+    /*!
+     * Test if a point is inside the circle passing through three 2D points.
+     * @return positive if d lies inside the circle when orient2d( a, b, c ) is
+     * positive, negative if d lies outside and zero if the four points are
+     * cocircular. The sign is reversed when a, b and c are ordered clockwise.
+     */
+    Side opengeode_geometry_api incircle( const Point2D& a,
+        const Point2D& b,
+        const Point2D& c,
+        const Point2D& d );
+
+    /*!
+     * Test if a point is inside the sphere passing through four 3D points.
+     * @return positive if e lies inside the sphere when orient3d( a, b, c, d )
+     * is positive, negative if e lies outside and zero if the five points
+     * are cospherical. The sign is reversed when orient3d( a, b, c, d ) is
+     * negative.
+     */
+    Side opengeode_geometry_api insphere( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        const Point3D& d,
+        const Point3D& e );
+
+    /*!
+     * Compute orient2d( a, b, point ) for each point.
+     * The filtered evaluation is vectorized over all the points, exact
+     * arithmetic is only used for the uncertain ones.
+     * @param[out] sides Output sides, one per point.
+     */
+    void opengeode_geometry_api orient2d( const Point2D& a,
+        const Point2D& b,
+        absl::Span< const Point2D > points,
+        absl::Span< Side > sides );
+
+    /*!
+     * Compute orient3d( a, b, c, point ) for each point.
+     * @param[out] sides Output sides, one per point.
+     */
+    void opengeode_geometry_api orient3d( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        absl::Span< const Point3D > points,
+        absl::Span< Side > sides );
+
+    /*!
+     * Compute incircle( a, b, c, point ) for each point.
+     * @param[out] sides Output sides, one per point.
+     */
+    void opengeode_geometry_api incircle( const Point2D& a,
+        const Point2D& b,
+        const Point2D& c,
+        absl::Span< const Point2D > points,
+        absl::Span< Side > sides );
+
+    /*!
+     * Compute insphere( a, b, c, d, point ) for each point.
+     * @param[out] sides Output sides, one per point.
+     */
+    void opengeode_geometry_api insphere( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        const Point3D& d,
+        absl::Span< const Point3D > points,
+        absl::Span< Side > sides );
+} // namespace geode
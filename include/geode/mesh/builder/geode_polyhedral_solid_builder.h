@@ -67,6 +67,9 @@ namespace geode
 
         void do_delete_polyhedra( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_polyhedra(
+            absl::Span< const index_t > permutation ) final;
+
         void do_set_polyhedron_adjacent(
             const PolyhedronFacet& polyhedron_facet,
             index_t adjacent_id ) final;
@@ -66,6 +66,9 @@ namespace geode
 
         void do_delete_polygons( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_polygons(
+            absl::Span< const index_t > permutation ) final;
+
         void do_set_polygon_adjacent(
             const PolygonEdge& polygon_edge, index_t adjacent_id ) final;
 
@@ -49,6 +49,9 @@ namespace geode
 
         void do_delete_vertices( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_vertices(
+            absl::Span< const index_t > permutation ) final;
+
     private:
         OpenGeodeVertexSet* geode_vertex_set_;
     };
@@ -115,6 +115,9 @@ namespace geode
     private:
         void do_delete_vertices( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_vertices(
+            absl::Span< const index_t > permutation ) final;
+
         virtual void do_delete_curve_vertices(
             const std::vector< bool >& to_delete ) = 0;
 
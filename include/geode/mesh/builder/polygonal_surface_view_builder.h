@@ -52,6 +52,8 @@ namespace geode
 
         void add_viewed_polygon( index_t polygon_id );
 
+        void add_viewed_polygons( absl::Span< const index_t > polygon_ids );
+
     private:
         void do_set_mesh( VertexSet& mesh ) final;
 
@@ -64,13 +66,16 @@ namespace geode
         void do_delete_surface_vertices(
             const std::vector< bool >& to_delete ) final;
 
-        void do_create_polygon( absl::Span< const unsigned int > ) final;
+        void do_create_polygon( absl::Span< const index_t > ) final;
 
         void do_set_polygon_vertex(
             const PolygonVertex& polygon_vertex, index_t vertex_id ) final;
 
         void do_delete_polygons( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_polygons(
+            absl::Span< const index_t > permutation ) final;
+
         void do_set_polygon_adjacent(
             const PolygonEdge& polygon_edge, index_t adjacent_id ) final;
 
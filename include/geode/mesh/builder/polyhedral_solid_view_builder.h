@@ -54,6 +54,8 @@ namespace geode
 
         void add_viewed_polyhedron( index_t polyhedron_id );
 
+        void add_viewed_polyhedra( absl::Span< const index_t > polyhedron_ids );
+
     private:
         void do_set_mesh( VertexSet& mesh ) final;
 
@@ -75,6 +77,9 @@ namespace geode
 
         void do_delete_polyhedra( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_polyhedra(
+            absl::Span< const index_t > permutation ) final;
+
         void do_set_polyhedron_adjacent(
             const PolyhedronFacet& polyhedron_facet,
             index_t adjacent_id ) final;
@@ -130,6 +130,15 @@ namespace geode
         std::vector< index_t > delete_polyhedra(
             const std::vector< bool >& to_delete );
 
+        /*!
+         * Reorder all the solid polyhedra, e.g. to improve memory locality.
+         * @param[in] permutation Vector of size solid_mesh_.nb_polyhedra().
+         * The new polyhedron i is the old polyhedron permutation[i].
+         * @return the mapping between old polyhedron indices to new ones.
+         */
+        std::vector< index_t > reorder_polyhedra(
+            absl::Span< const index_t > permutation );
+
         /*!
          * Delete all the isolated vertices (not used as polyhedron vertices)
          * @return the mapping between old vertex indices to new ones.
@@ -181,6 +190,12 @@ namespace geode
 
         index_t find_or_create_edge( std::array< index_t, 2 > edge_vertices );
 
+        /*!
+         * Mark the cached metrics of the mesh as out of date.
+         * To call each time the mesh geometry or topology changes.
+         */
+        void set_metrics_dirty();
+
         void copy( const SolidMesh< dimension >& solid_mesh );
 
     private:
@@ -198,6 +213,9 @@ namespace geode
         virtual void do_delete_solid_vertices(
             const std::vector< bool >& to_delete ) = 0;
 
+        void do_permute_vertices(
+            absl::Span< const index_t > permutation ) final;
+
         virtual void do_set_polyhedron_vertex(
             const PolyhedronVertex& polyhedron_vertex, index_t vertex_id ) = 0;
 
@@ -213,6 +231,9 @@ namespace geode
         virtual void do_delete_polyhedra(
             const std::vector< bool >& to_delete ) = 0;
 
+        virtual void do_permute_polyhedra(
+            absl::Span< const index_t > permutation ) = 0;
+
         virtual void do_set_polyhedron_adjacent(
             const PolyhedronFacet& polyhedron_facet, index_t adjacent_id ) = 0;
 
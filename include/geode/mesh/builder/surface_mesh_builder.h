@@ -136,6 +136,15 @@ namespace geode
         std::vector< index_t > delete_polygons(
             const std::vector< bool >& to_delete );
 
+        /*!
+         * Reorder all the surface polygons, e.g. to improve memory locality.
+         * @param[in] permutation Vector of size surface_mesh_.nb_polygons().
+         * The new polygon i is the old polygon permutation[i].
+         * @return the mapping between old polygon indices to new ones.
+         */
+        std::vector< index_t > reorder_polygons(
+            absl::Span< const index_t > permutation );
+
         /*!
          * Delete all the isolated vertices (not used as polygon vertices)
          * @return the mapping between old vertex indices to new ones.
@@ -177,6 +186,12 @@ namespace geode
 
         index_t find_or_create_edge( std::array< index_t, 2 > edge_vertices );
 
+        /*!
+         * Mark the cached metrics of the mesh as out of date.
+         * To call each time the mesh geometry or topology changes.
+         */
+        void set_metrics_dirty();
+
         void copy( const SurfaceMesh< dimension >& surface_mesh );
 
     private:
@@ -188,6 +203,9 @@ namespace geode
         virtual void do_delete_surface_vertices(
             const std::vector< bool >& to_delete ) = 0;
 
+        void do_permute_vertices(
+            absl::Span< const index_t > permutation ) final;
+
         virtual void do_set_polygon_vertex(
             const PolygonVertex& polygon_vertex, index_t vertex_id ) = 0;
 
@@ -197,6 +215,9 @@ namespace geode
         virtual void do_delete_polygons(
             const std::vector< bool >& to_delete ) = 0;
 
+        virtual void do_permute_polygons(
+            absl::Span< const index_t > permutation ) = 0;
+
         virtual void do_set_polygon_adjacent(
             const PolygonEdge& polygon_edge, index_t adjacent_id ) = 0;
 
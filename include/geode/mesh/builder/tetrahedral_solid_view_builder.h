@@ -54,6 +54,9 @@ namespace geode
 
         void add_viewed_tetrahedron( index_t tetrahedron_id );
 
+        void add_viewed_tetrahedra(
+            absl::Span< const index_t > tetrahedron_ids );
+
     private:
         void do_set_mesh( VertexSet& mesh ) final;
 
@@ -72,6 +75,9 @@ namespace geode
 
         void do_delete_polyhedra( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_polyhedra(
+            absl::Span< const index_t > permutation ) final;
+
         void do_set_polyhedron_adjacent(
             const PolyhedronFacet& polyhedron_facet,
             index_t adjacent_id ) final;
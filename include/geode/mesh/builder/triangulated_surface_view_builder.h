@@ -52,6 +52,8 @@ namespace geode
 
         void add_viewed_triangle( index_t triangle_id );
 
+        void add_viewed_triangles( absl::Span< const index_t > triangle_ids );
+
     private:
         void do_set_mesh( VertexSet& mesh ) final;
 
@@ -74,6 +76,9 @@ namespace geode
 
         void do_delete_polygons( const std::vector< bool >& to_delete ) final;
 
+        void do_permute_polygons(
+            absl::Span< const index_t > permutation ) final;
+
         void do_set_polygon_adjacent(
             const PolygonEdge& polygon_edge, index_t adjacent_id ) final;
 
@@ -25,6 +25,8 @@
 
 #include <vector>
 
+#include <absl/types/span.h>
+
 #include <geode/mesh/common.h>
 #include <geode/mesh/core/mesh_id.h>
 
@@ -65,6 +67,12 @@ namespace geode
          */
         index_t create_vertices( index_t nb );
 
+        /*!
+         * Return the number of vertices of the VertexSet being built, e.g. to
+         * check vertex indices before using them.
+         */
+        index_t nb_vertices() const;
+
         /*!
          * Delete a set of vertices.
          * @param[in] to_delete Vector of size vertex_set_.nb_vertices(). If
@@ -76,6 +84,15 @@ namespace geode
         std::vector< index_t > delete_vertices(
             const std::vector< bool >& to_delete );
 
+        /*!
+         * Reorder all the vertices, e.g. to improve memory locality.
+         * @param[in] permutation Vector of size vertex_set_.nb_vertices().
+         * The new vertex i is the old vertex permutation[i].
+         * @return the mapping between old vertex indices to new ones.
+         */
+        std::vector< index_t > reorder_vertices(
+            absl::Span< const index_t > permutation );
+
         void set_mesh( VertexSet& mesh, MeshBuilderFactoryKey );
 
     protected:
@@ -94,6 +111,9 @@ namespace geode
         virtual void do_delete_vertices(
             const std::vector< bool >& to_delete ) = 0;
 
+        virtual void do_permute_vertices(
+            absl::Span< const index_t > permutation ) = 0;
+
     private:
         VertexSet* vertex_set_;
     };
@@ -49,6 +49,13 @@ namespace geode
     void opengeode_mesh_api register_mesh_deserialize_pcontext(
         PContext& context );
 
+    template < typename Archive, size_t N >
+    void serialize_indices(
+        Archive& archive, absl::InlinedVector< index_t, N >& indices )
+    {
+        archive.container( indices, indices.max_size(),
+            []( Archive& a, index_t& index ) { serialize_index( a, index ); } );
+    }
 } // namespace geode
 
 namespace bitsery
@@ -65,6 +72,8 @@ namespace bitsery
     template < typename Serializer, typename T, size_t N >
     void serialize( Serializer& s, absl::InlinedVector< T, N >& obj )
     {
-        s.container( obj, obj.max_size() );
+        s.container( obj, obj.max_size(), []( Serializer& s, T& item ) {
+            geode::serialize_value( s, item );
+        } );
     }
 } // namespace bitsery
\ No newline at end of file
@@ -35,8 +35,10 @@ namespace geode
         class EdgesViewImpl : public detail::PointsViewImpl< dimension, Mesh >
         {
         public:
-            EdgesViewImpl( Mesh& mesh_view, const Mesh& mesh )
-                : detail::PointsViewImpl< dimension, Mesh >( mesh_view, mesh ),
+            EdgesViewImpl(
+                Mesh& mesh_view, const Mesh& mesh, MeshViewMapping mapping )
+                : detail::PointsViewImpl< dimension, Mesh >(
+                    mesh_view, mesh, mapping ),
                   mesh_( mesh ),
                   mesh_view_( mesh_view ),
                   view2edges_(
@@ -47,7 +49,8 @@ namespace geode
                       mesh_view.edge_attribute_manager()
                           .template find_or_create_attribute< VariableAttribute,
                               std::array< index_t, 2 > >( "facet_vertices",
-                              std::array< index_t, 2 >{ { NO_ID, NO_ID } } ) )
+                              std::array< index_t, 2 >{ { NO_ID, NO_ID } } ) ),
+                  edges2view_( mapping, mesh.nb_edges() )
             {
             }
 
@@ -60,10 +63,11 @@ namespace geode
                 if( const auto viewed_edge =
                         mesh_.edge_from_vertices( viewed_vertices ) )
                 {
-                    const auto it = edges2view_.find( viewed_edge.value() );
-                    if( it != edges2view_.end() )
+                    const auto edge_id =
+                        edges2view_.find( viewed_edge.value() );
+                    if( edge_id != NO_ID )
                     {
-                        return it->second;
+                        return edge_id;
                     }
                 }
                 return absl::nullopt;
@@ -98,13 +102,21 @@ namespace geode
             void add_viewed_edge( index_t edge_id )
             {
                 const auto id = mesh_view_.nb_edges();
-                if( edges2view_.emplace( edge_id, id ).second )
+                if( edges2view_.emplace( edge_id, id ) )
                 {
                     mesh_view_.edge_attribute_manager().resize( id + 1 );
                     view2edges_->set_value( id, edge_id );
                 }
             }
 
+            MemoryUsage view_memory_usage() const
+            {
+                auto usage = PointsViewImpl< dimension,
+                    Mesh >::view_memory_usage();
+                usage.add_child( "edges", edges2view_.memory_usage() );
+                return usage;
+            }
+
         private:
             const Mesh& mesh_;
             Mesh& mesh_view_;
@@ -112,7 +124,7 @@ namespace geode
             mutable std::shared_ptr<
                 VariableAttribute< std::array< index_t, 2 > > >
                 edge_vertices_;
-            absl::flat_hash_map< index_t, index_t > edges2view_;
+            ViewIndexMapping edges2view_;
         };
     } // namespace detail
 } // namespace geode
@@ -34,6 +34,15 @@
 
 namespace geode
 {
+    template < typename Container >
+    struct AttributeHeapMemory< detail::VertexCycle< Container > >
+    {
+        static size_t size( const detail::VertexCycle< Container >& value )
+        {
+            return AttributeHeapMemory< Container >::size( value.vertices() );
+        }
+    };
+
     namespace detail
     {
         template < typename VertexContainer >
@@ -62,6 +71,15 @@ namespace geode
                 return facet_attribute_manager_;
             }
 
+            MemoryUsage memory_usage() const
+            {
+                auto usage = facet_attribute_manager_.memory_usage();
+                usage.add_child( "facet_indices",
+                    AttributeHeapMemory< absl::flat_hash_map< TypedVertexCycle,
+                        index_t > >::size( facet_indices_ ) );
+                return usage;
+            }
+
             absl::optional< index_t > find_facet(
                 TypedVertexCycle vertices ) const
             {
@@ -105,7 +123,7 @@ namespace geode
                     "[FacetStorage::remove_facet] Cannot "
                     "find facet from given vertices" );
                 const auto old_count = counter_->value( id );
-                const auto new_count = std::max( 1u, old_count ) - 1;
+                const auto new_count = std::max( index_t{ 1 }, old_count ) - 1;
                 counter_->set_value( id, new_count );
             }
 
@@ -126,41 +144,25 @@ namespace geode
             {
                 const auto old2new =
                     detail::mapping_after_deletion( to_delete );
-                std::vector< TypedVertexCycle > key_to_erase;
-                key_to_erase.reserve( old2new.size() );
-                for( auto& cycle : facet_indices_ )
-                {
-                    if( old2new[cycle.second] == NO_ID )
-                    {
-                        key_to_erase.emplace_back( cycle.first );
-                    }
-                    cycle.second = old2new[cycle.second];
-                }
-                for( const auto& key : key_to_erase )
-                {
-                    facet_indices_.erase( key );
-                }
                 facet_attribute_manager_.delete_elements( to_delete );
+                rebuild_facet_indices();
                 return old2new;
             }
 
             void update_facet_vertices( absl::Span< const index_t > old2new )
             {
-                const auto old_facet_indices = facet_indices_;
-                facet_indices_.clear();
-                facet_indices_.reserve( old_facet_indices.size() );
-                for( const auto& cycle : old_facet_indices )
+                for( const auto f :
+                    Range{ facet_attribute_manager_.nb_elements() } )
                 {
-                    auto updated_vertices = cycle.first.vertices();
-                    for( auto& v : updated_vertices )
-                    {
-                        v = old2new[v];
-                    }
-                    auto it = std::get< 0 >( facet_indices_.emplace(
-                        TypedVertexCycle{ std::move( updated_vertices ) },
-                        cycle.second ) );
-                    vertices_->set_value( cycle.second, it->first.vertices() );
+                    vertices_->modify_value(
+                        f, [&old2new]( VertexContainer& vertices ) {
+                            for( auto& v : vertices )
+                            {
+                                v = old2new[v];
+                            }
+                        } );
                 }
+                rebuild_facet_indices();
             }
 
             const VertexContainer& get_facet_vertices( index_t facet_id ) const
@@ -201,6 +203,23 @@ namespace geode
             }
 
         private:
+            /*!
+             * Rebuild the whole hash map from the facet vertices stored in
+             * the dense attribute, instead of updating it entry by entry.
+             */
+            void rebuild_facet_indices()
+            {
+                const auto nb_facets = facet_attribute_manager_.nb_elements();
+                facet_indices_.clear();
+                facet_indices_.reserve( nb_facets );
+                for( const auto f : Range{ nb_facets } )
+                {
+                    const auto it = std::get< 0 >( facet_indices_.emplace(
+                        TypedVertexCycle{ vertices_->value( f ) }, f ) );
+                    vertices_->set_value( f, it->first.vertices() );
+                }
+            }
+
             template < typename Archive >
             void serialize( Archive& archive )
             {
@@ -216,7 +235,7 @@ namespace geode
                             []( Archive& archive, TypedVertexCycle& cycle,
                                 index_t& attribute ) {
                                 archive.object( cycle );
-                                archive.value4b( attribute );
+                                serialize_index( archive, attribute );
                             } );
                         archive.ext(
                             storage.counter_, bitsery::ext::StdSmartPtr{} );
@@ -27,6 +27,7 @@
 
 #include <geode/geometry/point.h>
 
+#include <geode/mesh/core/detail/view_index_mapping.h>
 #include <geode/mesh/core/vertex_set.h>
 
 namespace geode
@@ -37,13 +38,16 @@ namespace geode
         class PointsViewImpl
         {
         public:
-            PointsViewImpl( VertexSet& mesh_view, const Mesh& mesh )
+            PointsViewImpl( VertexSet& mesh_view,
+                const Mesh& mesh,
+                MeshViewMapping mapping )
                 : mesh_( mesh ),
                   mesh_view_( mesh_view ),
                   view2vertices_(
                       mesh_view.vertex_attribute_manager()
                           .find_or_create_attribute< VariableAttribute,
-                              index_t >( "view2vertices", NO_ID ) )
+                              index_t >( "view2vertices", NO_ID ) ),
+                  vertices2view_( mapping, mesh.nb_vertices() )
             {
             }
 
@@ -65,7 +69,7 @@ namespace geode
             index_t add_viewed_vertex( index_t vertex_id )
             {
                 const auto id = mesh_view_.nb_vertices();
-                if( vertices2view_.emplace( vertex_id, id ).second )
+                if( vertices2view_.emplace( vertex_id, id ) )
                 {
                     mesh_view_.vertex_attribute_manager().resize( id + 1 );
                     view2vertices_->set_value( id, vertex_id );
@@ -73,11 +77,22 @@ namespace geode
                 return vertex_in_view( vertex_id );
             }
 
+            /*!
+             * Memory used by the mappings from viewed elements to view
+             * elements
+             */
+            MemoryUsage view_memory_usage() const
+            {
+                MemoryUsage usage{ "view_mappings", 0 };
+                usage.add_child( "vertices", vertices2view_.memory_usage() );
+                return usage;
+            }
+
         private:
             const Mesh& mesh_;
             VertexSet& mesh_view_;
             std::shared_ptr< VariableAttribute< index_t > > view2vertices_;
-            absl::flat_hash_map< index_t, index_t > vertices2view_;
+            ViewIndexMapping vertices2view_;
         };
     } // namespace detail
 } // namespace geode
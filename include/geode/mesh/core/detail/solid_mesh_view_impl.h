@@ -40,15 +40,17 @@ namespace geode
         {
         public:
             SolidMeshViewImpl( SolidMesh< dimension >& solid_view,
-                const SolidMesh< dimension >& solid )
+                const SolidMesh< dimension >& solid,
+                MeshViewMapping mapping )
                 : detail::EdgesViewImpl< dimension, SolidMesh< dimension > >(
-                    solid_view, solid ),
+                    solid_view, solid, mapping ),
                   solid_( solid ),
                   solid_view_( solid_view ),
                   view2polyhedra_(
                       solid_view.polyhedron_attribute_manager()
                           .template find_or_create_attribute< VariableAttribute,
                               index_t >( "view2polyhedra", NO_ID ) ),
+                  polyhedra2view_( mapping, solid.nb_polyhedra() ),
                   view2facets_(
                       solid_view.facet_attribute_manager()
                           .template find_or_create_attribute< VariableAttribute,
@@ -57,7 +59,8 @@ namespace geode
                       solid_view.facet_attribute_manager()
                           .template find_or_create_attribute< VariableAttribute,
                               PolyhedronFacetVertices >(
-                              "facet_vertices", PolyhedronFacetVertices{} ) )
+                              "facet_vertices", PolyhedronFacetVertices{} ) ),
+                  facets2view_( mapping, solid.nb_facets() )
             {
             }
 
@@ -97,21 +100,21 @@ namespace geode
                 {
                     return absl::nullopt;
                 }
-                const auto it = polyhedra2view_.find(
+                const auto polyhedron_id = polyhedra2view_.find(
                     viewed_polyhedron_vertex->polyhedron_id );
-                if( it != polyhedra2view_.end() )
+                if( polyhedron_id != NO_ID )
                 {
-                    return PolyhedronVertex{ it->second,
+                    return PolyhedronVertex{ polyhedron_id,
                         viewed_polyhedron_vertex->vertex_id };
                 }
                 for( const auto& polyhedron_around_vertex :
                     solid_.polyhedra_around_vertex( viewed_vertex ) )
                 {
-                    const auto it2 = polyhedra2view_.find(
+                    const auto around_id = polyhedra2view_.find(
                         polyhedron_around_vertex.polyhedron_id );
-                    if( it2 != polyhedra2view_.end() )
+                    if( around_id != NO_ID )
                     {
-                        return PolyhedronVertex{ it2->second,
+                        return PolyhedronVertex{ around_id,
                             polyhedron_around_vertex.vertex_id };
                     }
                 }
@@ -203,10 +206,11 @@ namespace geode
                 if( const auto viewed_facet =
                         solid_.facet_from_vertices( viewed_vertices ) )
                 {
-                    const auto it = facets2view_.find( viewed_facet.value() );
-                    if( it != facets2view_.end() )
+                    const auto facet_id =
+                        facets2view_.find( viewed_facet.value() );
+                    if( facet_id != NO_ID )
                     {
-                        return it->second;
+                        return facet_id;
                     }
                 }
                 return absl::nullopt;
@@ -243,7 +247,7 @@ namespace geode
             index_t add_viewed_facet( index_t facet_id )
             {
                 const auto id = solid_view_.nb_facets();
-                if( facets2view_.emplace( facet_id, id ).second )
+                if( facets2view_.emplace( facet_id, id ) )
                 {
                     solid_view_.facet_attribute_manager().resize( id + 1 );
                     view2facets_->set_value( id, facet_id );
@@ -257,10 +261,11 @@ namespace geode
                 if( const auto adj = solid_.polyhedron_adjacent(
                         viewed_polyhedron_facet( polyhedron_facet ) ) )
                 {
-                    const auto it = polyhedra2view_.find( adj.value() );
-                    if( it != polyhedra2view_.end() )
+                    const auto adjacent_id =
+                        polyhedra2view_.find( adj.value() );
+                    if( adjacent_id != NO_ID )
                     {
-                        return it->second;
+                        return adjacent_id;
                     }
                 }
                 return absl::nullopt;
@@ -305,8 +310,8 @@ namespace geode
             index_t add_viewed_polyhedron( index_t polyhedron_id )
             {
                 const auto polyhedron_view_id = solid_view_.nb_polyhedra();
-                if( polyhedra2view_.emplace( polyhedron_id, polyhedron_view_id )
-                        .second )
+                if( polyhedra2view_.emplace(
+                        polyhedron_id, polyhedron_view_id ) )
                 {
                     solid_view_.polyhedron_attribute_manager().resize(
                         polyhedron_view_id + 1 );
@@ -343,6 +348,29 @@ namespace geode
                 return polyhedra2view_.at( polyhedron_id );
             }
 
+            void add_viewed_polyhedra(
+                absl::Span< const index_t > polyhedron_ids )
+            {
+                const auto capacity = solid_view_.nb_polyhedra()
+                                      + static_cast< index_t >(
+                                          polyhedron_ids.size() );
+                polyhedra2view_.reserve( capacity );
+                solid_view_.polyhedron_attribute_manager().reserve( capacity );
+                for( const auto polyhedron_id : polyhedron_ids )
+                {
+                    add_viewed_polyhedron( polyhedron_id );
+                }
+            }
+
+            MemoryUsage view_memory_usage() const
+            {
+                auto usage = EdgesViewImpl< dimension,
+                    SolidMesh< dimension > >::view_memory_usage();
+                usage.add_child( "polyhedra", polyhedra2view_.memory_usage() );
+                usage.add_child( "facets", facets2view_.memory_usage() );
+                return usage;
+            }
+
         private:
             PolyhedronVertex viewed_polyhedron_vertex(
                 const PolyhedronVertex& polyhedron_vertex ) const
@@ -362,12 +390,12 @@ namespace geode
             const SolidMesh< dimension >& solid_;
             SolidMesh< dimension >& solid_view_;
             std::shared_ptr< VariableAttribute< index_t > > view2polyhedra_;
-            absl::flat_hash_map< index_t, index_t > polyhedra2view_;
+            ViewIndexMapping polyhedra2view_;
             std::shared_ptr< VariableAttribute< index_t > > view2facets_;
             mutable std::shared_ptr<
                 VariableAttribute< PolyhedronFacetVertices > >
                 facet_vertices_;
-            absl::flat_hash_map< index_t, index_t > facets2view_;
+            ViewIndexMapping facets2view_;
         };
     } // namespace detail
 } // namespace geode
@@ -39,15 +39,17 @@ namespace geode
         {
         public:
             SurfaceMeshViewImpl( SurfaceMesh< dimension >& surface_view,
-                const SurfaceMesh< dimension >& surface )
+                const SurfaceMesh< dimension >& surface,
+                MeshViewMapping mapping )
                 : detail::EdgesViewImpl< dimension, SurfaceMesh< dimension > >(
-                    surface_view, surface ),
+                    surface_view, surface, mapping ),
                   surface_( surface ),
                   surface_view_( surface_view ),
                   view2polygons_(
                       surface_view.polygon_attribute_manager()
                           .template find_or_create_attribute< VariableAttribute,
-                              index_t >( "view2polygons", NO_ID ) )
+                              index_t >( "view2polygons", NO_ID ) ),
+                  polygons2view_( mapping, surface.nb_polygons() )
             {
             }
 
@@ -74,21 +76,21 @@ namespace geode
                 {
                     return absl::nullopt;
                 }
-                const auto it =
+                const auto polygon_id =
                     polygons2view_.find( viewed_polygon_vertex->polygon_id );
-                if( it != polygons2view_.end() )
+                if( polygon_id != NO_ID )
                 {
-                    return PolygonVertex{ it->second,
+                    return PolygonVertex{ polygon_id,
                         viewed_polygon_vertex->vertex_id };
                 }
                 for( const auto& polygon_around_vertex :
                     surface_.polygons_around_vertex( viewed_vertex ) )
                 {
-                    const auto it2 =
+                    const auto around_id =
                         polygons2view_.find( polygon_around_vertex.polygon_id );
-                    if( it2 != polygons2view_.end() )
+                    if( around_id != NO_ID )
                     {
-                        return PolygonVertex{ it2->second,
+                        return PolygonVertex{ around_id,
                             polygon_around_vertex.vertex_id };
                     }
                 }
@@ -130,10 +132,10 @@ namespace geode
                 if( const auto adj = surface_.polygon_adjacent(
                         viewed_polygon_edge( polygon_edge ) ) )
                 {
-                    const auto it = polygons2view_.find( adj.value() );
-                    if( it != polygons2view_.end() )
+                    const auto adjacent_id = polygons2view_.find( adj.value() );
+                    if( adjacent_id != NO_ID )
                     {
-                        return it->second;
+                        return adjacent_id;
                     }
                 }
                 return absl::nullopt;
@@ -154,8 +156,7 @@ namespace geode
             index_t add_viewed_polygon( index_t polygon_id )
             {
                 const auto polygon_view_id = surface_view_.nb_polygons();
-                if( polygons2view_.emplace( polygon_id, polygon_view_id )
-                        .second )
+                if( polygons2view_.emplace( polygon_id, polygon_view_id ) )
                 {
                     surface_view_.polygon_attribute_manager().resize(
                         polygon_view_id + 1 );
@@ -178,6 +179,27 @@ namespace geode
                 return polygons2view_.at( polygon_id );
             }
 
+            void add_viewed_polygons( absl::Span< const index_t > polygon_ids )
+            {
+                const auto capacity = surface_view_.nb_polygons()
+                                      + static_cast< index_t >(
+                                          polygon_ids.size() );
+                polygons2view_.reserve( capacity );
+                surface_view_.polygon_attribute_manager().reserve( capacity );
+                for( const auto polygon_id : polygon_ids )
+                {
+                    add_viewed_polygon( polygon_id );
+                }
+            }
+
+            MemoryUsage view_memory_usage() const
+            {
+                auto usage = EdgesViewImpl< dimension,
+                    SurfaceMesh< dimension > >::view_memory_usage();
+                usage.add_child( "polygons", polygons2view_.memory_usage() );
+                return usage;
+            }
+
         private:
             PolygonVertex viewed_polygon_vertex(
                 const PolygonVertex& polygon_vertex ) const
@@ -197,7 +219,7 @@ namespace geode
             const SurfaceMesh< dimension >& surface_;
             SurfaceMesh< dimension >& surface_view_;
             std::shared_ptr< VariableAttribute< index_t > > view2polygons_;
-            absl::flat_hash_map< index_t, index_t > polygons2view_;
+            ViewIndexMapping polygons2view_;
         };
     } // namespace detail
 } // namespace geode
@@ -39,6 +39,8 @@
 
 #include <geode/basic/common.h>
 
+#include <geode/mesh/core/bitsery_archive.h>
+
 namespace geode
 {
     namespace detail
@@ -99,10 +101,10 @@ namespace geode
                 archive.ext( *this,
                     Growable< Archive, VertexCycle >{
                         { []( Archive& archive, VertexCycle& storage ) {
-                             archive( storage.vertices_ );
+                             serialize_indices( archive, storage.vertices_ );
                          },
                             []( Archive& archive, VertexCycle& storage ) {
-                                archive( storage.vertices_ );
+                                serialize_indices( archive, storage.vertices_ );
                             } },
                         { []( VertexCycle& storage ) {
                             rotate( storage.vertices_ );
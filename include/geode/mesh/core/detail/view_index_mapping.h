@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/attribute_utils.h>
+
+#include <geode/mesh/core/mesh_view_mapping.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Mapping from viewed element indices to view element indices,
+         * stored either in a hash map or in a dense array filled with NO_ID.
+         */
+        class ViewIndexMapping
+        {
+        public:
+            ViewIndexMapping( MeshViewMapping mapping, index_t nb_viewed )
+                : mapping_( mapping )
+            {
+                if( mapping_ == MeshViewMapping::dense )
+                {
+                    viewed2view_.resize( nb_viewed, NO_ID );
+                }
+            }
+
+            /*!
+             * Return the view index of a viewed element, NO_ID if the element
+             * is not in the view
+             */
+            index_t find( index_t viewed_id ) const
+            {
+                if( mapping_ == MeshViewMapping::dense )
+                {
+                    return viewed_id < viewed2view_.size()
+                               ? viewed2view_[viewed_id]
+                               : NO_ID;
+                }
+                const auto it = sparse_viewed2view_.find( viewed_id );
+                return it == sparse_viewed2view_.end() ? NO_ID : it->second;
+            }
+
+            index_t at( index_t viewed_id ) const
+            {
+                const auto view_id = find( viewed_id );
+                OPENGEODE_EXCEPTION( view_id != NO_ID,
+                    "[ViewIndexMapping::at] Element ", viewed_id,
+                    " is not in the view" );
+                return view_id;
+            }
+
+            /*!
+             * Map a viewed element to a view element if it is not already
+             * mapped
+             * @return true if the mapping has been added
+             */
+            bool emplace( index_t viewed_id, index_t view_id )
+            {
+                if( mapping_ == MeshViewMapping::dense )
+                {
+                    if( viewed_id >= viewed2view_.size() )
+                    {
+                        viewed2view_.resize( viewed_id + 1, NO_ID );
+                    }
+                    if( viewed2view_[viewed_id] != NO_ID )
+                    {
+                        return false;
+                    }
+                    viewed2view_[viewed_id] = view_id;
+                    return true;
+                }
+                return sparse_viewed2view_.emplace( viewed_id, view_id )
+                    .second;
+            }
+
+            void reserve( index_t capacity )
+            {
+                if( mapping_ == MeshViewMapping::sparse )
+                {
+                    sparse_viewed2view_.reserve( capacity );
+                }
+            }
+
+            size_t memory_usage() const
+            {
+                return sizeof( *this )
+                       + AttributeHeapMemory< std::vector< index_t > >::size(
+                           viewed2view_ )
+                       + AttributeHeapMemory< absl::flat_hash_map< index_t,
+                           index_t > >::size( sparse_viewed2view_ );
+            }
+
+        private:
+            MeshViewMapping mapping_;
+            std::vector< index_t > viewed2view_;
+            absl::flat_hash_map< index_t, index_t > sparse_viewed2view_;
+        };
+    } // namespace detail
+} // namespace geode
@@ -76,6 +76,8 @@ namespace geode
             return native_extension_static();
         }
 
+        MemoryUsage memory_usage() const override;
+
         void set_vertex( index_t vertex_id,
             Point< dimension > point,
             OGPolygonalSurfaceKey );
@@ -94,6 +96,9 @@ namespace geode
         void remove_polygons(
             const std::vector< bool >& to_delete, OGPolygonalSurfaceKey );
 
+        void permute_polygons( absl::Span< const index_t > permutation,
+            OGPolygonalSurfaceKey );
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
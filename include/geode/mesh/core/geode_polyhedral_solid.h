@@ -76,6 +76,8 @@ namespace geode
             return native_extension_static();
         }
 
+        MemoryUsage memory_usage() const override;
+
         void set_vertex(
             index_t vertex_id, Point< dimension > point, OGPolyhedralSolidKey );
 
@@ -86,6 +88,9 @@ namespace geode
         void remove_polyhedra(
             const std::vector< bool >& to_delete, OGPolyhedralSolidKey );
 
+        void permute_polyhedra( absl::Span< const index_t > permutation,
+            OGPolyhedralSolidKey );
+
         void set_polyhedron_adjacent( const PolyhedronFacet& polyhedron_facet,
             index_t adjacent_id,
             OGPolyhedralSolidKey );
@@ -64,8 +64,8 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, EdgeVertex >{},
                 []( Archive& archive, EdgeVertex& edge_vertex ) {
-                    archive.value4b( edge_vertex.edge_id );
-                    archive.value4b( edge_vertex.vertex_id );
+                    serialize_index( archive, edge_vertex.edge_id );
+                    serialize_index( archive, edge_vertex.vertex_id );
                 } );
         }
         /*!
@@ -122,6 +122,8 @@ namespace geode
          */
         AttributeManager& edge_attribute_manager() const;
 
+        MemoryUsage memory_usage() const override;
+
         /*!
          * Get all edge endpoints corresponding to a given vertex
          * @param[in] vertex_id Index of the vertex
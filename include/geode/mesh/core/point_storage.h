@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/mesh/common.h>
+
+namespace geode
+{
+    /*!
+     * Precision used to write the point coordinates of a TriangulatedSurface
+     * in the compact format: og_ctsf2d/og_ctsf3d extensions for
+     * single_precision, og_qtsf2d/og_qtsf3d extensions for quantized.
+     * This is a file format option only: coordinates are always handled as
+     * double in memory, since SurfaceMesh::point() returns a reference to a
+     * stored Point. The saving is on disk and on the wire.
+     */
+    enum struct PointStorage : unsigned char
+    {
+        // 32 bits floating point numbers, half the size of double
+        single_precision,
+        // 16 bits integers relative to the bounding box of the points,
+        // a quarter of the size of double
+        quantized
+    };
+} // namespace geode
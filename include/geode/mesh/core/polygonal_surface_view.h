@@ -25,10 +25,13 @@
 
 #include <array>
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/mesh/common.h>
+#include <geode/mesh/core/mesh_view_mapping.h>
 #include <geode/mesh/core/polygonal_surface.h>
 
 namespace geode
@@ -57,6 +60,8 @@ namespace geode
 
     public:
         PolygonalSurfaceView( const PolygonalSurface< dimension >& surface );
+        PolygonalSurfaceView( const PolygonalSurface< dimension >& surface,
+            MeshViewMapping mapping );
         PolygonalSurfaceView( PolygonalSurfaceView&& other );
         ~PolygonalSurfaceView();
 
@@ -82,6 +87,8 @@ namespace geode
             return "";
         }
 
+        MemoryUsage memory_usage() const override;
+
         index_t viewed_vertex( index_t vertex_id ) const;
 
         index_t add_viewed_vertex( index_t vertex_id, PolygonalSurfaceViewKey );
@@ -91,6 +98,9 @@ namespace geode
         index_t add_viewed_polygon(
             index_t polygon_id, PolygonalSurfaceViewKey );
 
+        void add_viewed_polygons(
+            absl::Span< const index_t > polygon_ids, PolygonalSurfaceViewKey );
+
     private:
         const Point< dimension >& get_point( index_t vertex_id ) const override;
 
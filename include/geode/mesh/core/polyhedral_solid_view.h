@@ -23,10 +23,13 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/mesh/common.h>
+#include <geode/mesh/core/mesh_view_mapping.h>
 #include <geode/mesh/core/polyhedral_solid.h>
 
 namespace geode
@@ -55,6 +58,8 @@ namespace geode
 
     public:
         PolyhedralSolidView( const PolyhedralSolid< dimension >& solid );
+        PolyhedralSolidView( const PolyhedralSolid< dimension >& solid,
+            MeshViewMapping mapping );
         PolyhedralSolidView( PolyhedralSolidView&& other );
         ~PolyhedralSolidView();
 
@@ -80,6 +85,8 @@ namespace geode
             return "";
         }
 
+        MemoryUsage memory_usage() const override;
+
         index_t viewed_vertex( index_t vertex_id ) const;
 
         index_t add_viewed_vertex( index_t vertex_id, PolyhedralSolidViewKey );
@@ -89,6 +96,10 @@ namespace geode
         index_t add_viewed_polyhedron(
             index_t polyhedron_id, PolyhedralSolidViewKey );
 
+        void add_viewed_polyhedra(
+            absl::Span< const index_t > polyhedron_ids,
+            PolyhedralSolidViewKey );
+
     private:
         const Point< dimension >& get_point( index_t vertex_id ) const override;
 
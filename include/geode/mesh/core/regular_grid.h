@@ -26,6 +26,7 @@
 #include <absl/container/inlined_vector.h>
 #include <absl/types/optional.h>
 
+#include <geode/basic/memory_usage.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/mesh/common.h>
@@ -107,6 +108,11 @@ namespace geode
 
         AttributeManager& cell_attribute_manager() const;
 
+        /*!
+         * Return the memory used by the grid, detailed by cell attribute
+         */
+        MemoryUsage memory_usage() const;
+
     private:
         RegularGrid();
 
@@ -27,6 +27,7 @@
 
 #include <absl/container/inlined_vector.h>
 
+#include <geode/basic/attribute_utils.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/passkey.h>
 
@@ -71,8 +72,8 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, PolyhedronVertex >{},
                 []( Archive& archive, PolyhedronVertex& polyhedron_vertex ) {
-                    archive.value4b( polyhedron_vertex.polyhedron_id );
-                    archive.value4b( polyhedron_vertex.vertex_id );
+                    serialize_index( archive, polyhedron_vertex.polyhedron_id );
+                    serialize_index( archive, polyhedron_vertex.vertex_id );
                 } );
         }
         index_t polyhedron_id{ NO_ID };
@@ -103,8 +104,8 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, PolyhedronFacet >{},
                 []( Archive& archive, PolyhedronFacet& polyhedron_facet ) {
-                    archive.value4b( polyhedron_facet.polyhedron_id );
-                    archive.value4b( polyhedron_facet.facet_id );
+                    serialize_index( archive, polyhedron_facet.polyhedron_id );
+                    serialize_index( archive, polyhedron_facet.facet_id );
                 } );
         }
         index_t polyhedron_id{ NO_ID };
@@ -135,7 +136,8 @@ namespace geode
                 []( Archive& archive,
                     PolyhedronFacetVertex& polyhedron_facet_vertex ) {
                     archive.object( polyhedron_facet_vertex.polyhedron_facet );
-                    archive.value4b( polyhedron_facet_vertex.vertex_id );
+                    serialize_index(
+                        archive, polyhedron_facet_vertex.vertex_id );
                 } );
         }
         PolyhedronFacet polyhedron_facet;
@@ -166,13 +168,16 @@ namespace geode
                 []( Archive& archive,
                     PolyhedronFacetEdge& polyhedron_facet_edge ) {
                     archive.object( polyhedron_facet_edge.polyhedron_facet );
-                    archive.value4b( polyhedron_facet_edge.edge_id );
+                    serialize_index( archive, polyhedron_facet_edge.edge_id );
                 } );
         }
         PolyhedronFacet polyhedron_facet;
         index_t edge_id{ NO_ID };
     };
 
+    BULK_ATTRIBUTE_SERIALIZATION( PolyhedronVertex, index_t, 2 );
+    BULK_ATTRIBUTE_SERIALIZATION( PolyhedronFacet, index_t, 2 );
+
     using PolyhedronFacetVertices = absl::InlinedVector< index_t, 4 >;
 
     using PolyhedronFacetsOnBorder = absl::InlinedVector< PolyhedronFacet, 4 >;
@@ -422,11 +427,26 @@ namespace geode
          */
         AttributeManager& edge_attribute_manager() const;
 
+        MemoryUsage memory_usage() const override;
+
         /*!
          * Compute the bounding box from mesh vertices
          */
         BoundingBox< dimension > bounding_box() const;
 
+        /*!
+         * Return true if the cached metric identified by metric_id should be
+         * computed again.
+         * @see mesh_metrics.h
+         */
+        bool is_metric_dirty( index_t metric_id ) const;
+
+        /*!
+         * Mark the cached metric identified by metric_id as up to date.
+         * @see mesh_metrics.h
+         */
+        void set_metric_clean( index_t metric_id ) const;
+
         /*!
          * Return one polyhedron with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
@@ -496,6 +516,8 @@ namespace geode
         void overwrite_edges(
             const SolidMesh< dimension >& from, SolidMeshKey );
 
+        void set_metrics_dirty( SolidMeshKey );
+
     protected:
         SolidMesh();
 
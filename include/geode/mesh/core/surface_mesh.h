@@ -26,6 +26,7 @@
 #include <absl/container/inlined_vector.h>
 #include <absl/types/optional.h>
 
+#include <geode/basic/attribute_utils.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/passkey.h>
 
@@ -73,8 +74,8 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, PolygonVertex >{},
                 []( Archive& archive, PolygonVertex& polygon_vertex ) {
-                    archive.value4b( polygon_vertex.polygon_id );
-                    archive.value4b( polygon_vertex.vertex_id );
+                    serialize_index( archive, polygon_vertex.polygon_id );
+                    serialize_index( archive, polygon_vertex.vertex_id );
                 } );
         }
         index_t polygon_id{ NO_ID };
@@ -105,14 +106,17 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, PolygonEdge >{},
                 []( Archive& archive, PolygonEdge& polygon_edge ) {
-                    archive.value4b( polygon_edge.polygon_id );
-                    archive.value4b( polygon_edge.edge_id );
+                    serialize_index( archive, polygon_edge.polygon_id );
+                    serialize_index( archive, polygon_edge.edge_id );
                 } );
         }
         index_t polygon_id{ NO_ID };
         index_t edge_id{ NO_ID };
     };
 
+    BULK_ATTRIBUTE_SERIALIZATION( PolygonVertex, index_t, 2 );
+    BULK_ATTRIBUTE_SERIALIZATION( PolygonEdge, index_t, 2 );
+
     using PolygonEdgesOnBorder = absl::InlinedVector< PolygonEdge, 3 >;
 
     using PolygonsAroundVertex = absl::InlinedVector< PolygonVertex, 10 >;
@@ -338,11 +342,26 @@ namespace geode
          */
         AttributeManager& polygon_attribute_manager() const;
 
+        MemoryUsage memory_usage() const override;
+
         /*!
          * Compute the bounding box from mesh vertices
          */
         BoundingBox< dimension > bounding_box() const;
 
+        /*!
+         * Return true if the cached metric identified by metric_id should be
+         * computed again.
+         * @see mesh_metrics.h
+         */
+        bool is_metric_dirty( index_t metric_id ) const;
+
+        /*!
+         * Mark the cached metric identified by metric_id as up to date.
+         * @see mesh_metrics.h
+         */
+        void set_metric_clean( index_t metric_id ) const;
+
         /*!
          * Return one polygon with one of the vertices matching given vertex.
          * @param[in] vertex_id Index of the vertex.
@@ -380,6 +399,8 @@ namespace geode
         void overwrite_edges(
             const SurfaceMesh< dimension >& from, SurfaceMeshKey );
 
+        void set_metrics_dirty( SurfaceMeshKey );
+
     protected:
         SurfaceMesh();
 
@@ -23,10 +23,13 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/mesh/common.h>
+#include <geode/mesh/core/mesh_view_mapping.h>
 #include <geode/mesh/core/tetrahedral_solid.h>
 
 namespace geode
@@ -55,6 +58,8 @@ namespace geode
 
     public:
         TetrahedralSolidView( const TetrahedralSolid< dimension >& solid );
+        TetrahedralSolidView( const TetrahedralSolid< dimension >& solid,
+            MeshViewMapping mapping );
         TetrahedralSolidView( TetrahedralSolidView&& other );
         ~TetrahedralSolidView();
 
@@ -80,6 +85,8 @@ namespace geode
             return "";
         }
 
+        MemoryUsage memory_usage() const override;
+
         index_t viewed_vertex( index_t vertex_id ) const;
 
         index_t add_viewed_vertex( index_t vertex_id, TetrahedralSolidViewKey );
@@ -89,6 +96,10 @@ namespace geode
         index_t add_viewed_tetrahedron(
             index_t tetrahedron_id, TetrahedralSolidViewKey );
 
+        void add_viewed_tetrahedra(
+            absl::Span< const index_t > tetrahedron_ids,
+            TetrahedralSolidViewKey );
+
     private:
         const Point< dimension >& get_point( index_t vertex_id ) const override;
 
@@ -25,10 +25,13 @@
 
 #include <array>
 
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/mesh/common.h>
+#include <geode/mesh/core/mesh_view_mapping.h>
 #include <geode/mesh/core/triangulated_surface.h>
 
 namespace geode
@@ -59,6 +62,9 @@ namespace geode
     public:
         TriangulatedSurfaceView(
             const TriangulatedSurface< dimension >& surface );
+        TriangulatedSurfaceView(
+            const TriangulatedSurface< dimension >& surface,
+            MeshViewMapping mapping );
         TriangulatedSurfaceView( TriangulatedSurfaceView&& other );
         ~TriangulatedSurfaceView();
 
@@ -85,6 +91,8 @@ namespace geode
             return "";
         }
 
+        MemoryUsage memory_usage() const override;
+
         index_t viewed_vertex( index_t vertex_id ) const;
 
         index_t add_viewed_vertex(
@@ -95,6 +103,10 @@ namespace geode
         index_t add_viewed_triangle(
             index_t triangle_id, TriangulatedSurfaceViewKey );
 
+        void add_viewed_triangles(
+            absl::Span< const index_t > triangle_ids,
+            TriangulatedSurfaceViewKey );
+
     private:
         const Point< dimension >& get_point( index_t vertex_id ) const override;
 
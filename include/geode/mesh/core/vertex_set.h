@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <geode/basic/memory_usage.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/mesh/common.h>
@@ -74,6 +75,12 @@ namespace geode
          */
         AttributeManager& vertex_attribute_manager() const;
 
+        /*!
+         * Return the memory used by the mesh, detailed by attribute manager
+         * and auxiliary storage.
+         */
+        virtual MemoryUsage memory_usage() const;
+
         virtual MeshImpl impl_name() const = 0;
 
         virtual MeshType type_name() const = 0;
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <absl/types/span.h>
+
+#include <geode/mesh/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
+    FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
+    ALIAS_3D( Point );
+    ALIAS_3D( AABBTree );
+    ALIAS_3D( TetrahedralSolid );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Location of a point inside a tetrahedron.
+     */
+    struct PolyhedronLocation
+    {
+        index_t polyhedron{ NO_ID };
+        /*!
+         * Barycentric coordinates of the point with regards to the
+         * tetrahedron vertices, in the tetrahedron vertex order.
+         */
+        std::array< double, 4 > barycentric_coordinates{ { 0, 0, 0, 0 } };
+    };
+
+    /*!
+     * Build an AABBTree on the polyhedra of a SolidMesh.
+     * The box indices in the tree match the polyhedron indices.
+     */
+    template < index_t dimension >
+    AABBTree< dimension > create_aabb_tree(
+        const SolidMesh< dimension >& mesh );
+
+    /*!
+     * Find the tetrahedron containing a point.
+     * @param[in] tree AABBTree built on \p mesh using create_aabb_tree.
+     * @param[in] mesh The TetrahedralSolid to look into.
+     * @param[in] point The query point.
+     * @param[in] tolerance Accepted negative value of the barycentric
+     * coordinates, to include points lying on the tetrahedron boundary.
+     * @return The containing tetrahedron and the barycentric coordinates of
+     * the point. If several tetrahedra contain the point, the one in which
+     * the point lies deepest is returned. Nothing is returned if the point is
+     * outside the mesh.
+     * @note Degenerate tetrahedra are ignored.
+     * @exception OpenGeodeException if \p tree was not built on \p mesh.
+     */
+    absl::optional< PolyhedronLocation > opengeode_mesh_api
+        containing_polyhedron( const AABBTree3D& tree,
+            const TetrahedralSolid3D& mesh,
+            const Point3D& point,
+            double tolerance = global_epsilon );
+
+    /*!
+     * Find the tetrahedra containing each given point.
+     * Queries are run in parallel.
+     * @return One location per query point, in the same order.
+     * @see containing_polyhedron
+     */
+    std::vector< absl::optional< PolyhedronLocation > > opengeode_mesh_api
+        containing_polyhedra( const AABBTree3D& tree,
+            const TetrahedralSolid3D& mesh,
+            absl::Span< const Point3D > points,
+            double tolerance = global_epsilon );
+
+    /*!
+     * Point location in a TetrahedralSolid using a visibility walk.
+     * Starting from a hint tetrahedron, the walk crosses the facets
+     * separating the current tetrahedron from the query point until the
+     * containing tetrahedron is reached. It is efficient for spatially
+     * coherent queries, where the previous answer is close to the next one.
+     * When the walk leaves the mesh, meets a degenerate tetrahedron or
+     * exceeds its step budget, the query falls back to containing_polyhedron.
+     */
+    class opengeode_mesh_api TetrahedralSolidLocator
+    {
+    public:
+        /*!
+         * Walk starting point, updated by each successful query.
+         * A Hint should not be shared between threads.
+         */
+        struct Hint
+        {
+            index_t tetrahedron{ NO_ID };
+        };
+
+        /*!
+         * @param[in] mesh The TetrahedralSolid to look into.
+         * @param[in] tree AABBTree built on \p mesh using create_aabb_tree.
+         * @param[in] max_steps Number of tetrahedra visited by the walk
+         * before falling back to the AABBTree.
+         */
+        TetrahedralSolidLocator( const TetrahedralSolid3D& mesh,
+            const AABBTree3D& tree,
+            index_t max_steps = 100 );
+
+        /*!
+         * Find the tetrahedron containing a point.
+         * @param[in] point The query point.
+         * @param[in,out] hint Starting tetrahedron of the walk, set to the
+         * containing tetrahedron when one is found. Without a valid
+         * tetrahedron, the AABBTree is used.
+         * @param[in] tolerance Accepted negative value of the barycentric
+         * coordinates.
+         * @see containing_polyhedron
+         * @note For points on a facet within \p tolerance, the returned
+         * tetrahedron depends on the walk path.
+         */
+        absl::optional< PolyhedronLocation > locate( const Point3D& point,
+            Hint& hint,
+            double tolerance = global_epsilon ) const;
+
+    private:
+        absl::optional< PolyhedronLocation > walk( const Point3D& point,
+            index_t start,
+            double tolerance ) const;
+
+    private:
+        const TetrahedralSolid3D& mesh_;
+        const AABBTree3D& tree_;
+        index_t max_steps_;
+    };
+} // namespace geode
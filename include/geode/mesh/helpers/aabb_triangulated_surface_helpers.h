@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/mesh/common.h>
 
 namespace geode
@@ -61,4 +63,26 @@ namespace geode
         const TriangulatedSurface< dimension >& mesh_;
     };
 
+    /*!
+     * Block functor for AABBTree::closest_element_box_by_blocks: the
+     * triangles of a block are gathered into a TriangleBatch and their
+     * distances to the query are computed by a single batched kernel call.
+     */
+    template < index_t dimension >
+    class DistanceToTriangles
+    {
+    public:
+        explicit DistanceToTriangles(
+            const TriangulatedSurface< dimension >& mesh )
+            : mesh_( mesh )
+        {
+        }
+
+        void operator()( const Point< dimension >& query,
+            absl::Span< const index_t > boxes,
+            absl::Span< double > distances ) const;
+
+    private:
+        const TriangulatedSurface< dimension >& mesh_;
+    };
 } // namespace geode
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <geode/mesh/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
+    FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
+    ALIAS_3D( Point );
+    ALIAS_3D( SolidMesh );
+
+    template < typename T >
+    class VariableAttribute;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Prefix of the attributes caching the mesh metrics. Attribute names
+     * starting with this prefix are reserved.
+     */
+    static constexpr auto metric_attribute_prefix = "geode_metric_";
+
+    /*!
+     * Mesh wide geometric metrics.
+     * Each metric is computed in parallel for all the elements and cached in
+     * an attribute of the mesh, named after the metric with the reserved
+     * prefix (e.g. "geode_metric_polygon_area" on polygons). Cached metrics
+     * are reused by the next requests until the mesh builder marks them as
+     * dirty: setting a point, creating elements or changing element vertices
+     * make them computed again on the next request. Deleting or reordering
+     * elements keeps them valid.
+     * @warning Metrics of the same mesh should not be requested concurrently.
+     */
+
+    /*!
+     * Get the area of all the polygons, cached as "geode_metric_polygon_area".
+     */
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > polygon_areas(
+        const SurfaceMesh< dimension >& mesh );
+
+    /*!
+     * Get the barycenter of all the polygons, cached as
+     * "geode_metric_polygon_barycenter".
+     */
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< Point< dimension > > >
+        polygon_barycenters( const SurfaceMesh< dimension >& mesh );
+
+    /*!
+     * Get the length of all the edges, cached as "geode_metric_edge_length".
+     */
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > edge_lengths(
+        const SurfaceMesh< dimension >& mesh );
+
+    /*!
+     * Get the length of all the edges, cached as "geode_metric_edge_length".
+     */
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > edge_lengths(
+        const SolidMesh< dimension >& mesh );
+
+    /*!
+     * Get the barycenter of all the polyhedra, cached as
+     * "geode_metric_polyhedron_barycenter".
+     */
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< Point< dimension > > >
+        polyhedron_barycenters( const SolidMesh< dimension >& mesh );
+
+    /*!
+     * Get the normal of all the facets, cached as "geode_metric_facet_normal".
+     * Normals are stored as Point3D to keep the attribute serializable, they
+     * convert implicitly to Vector3D.
+     */
+    std::shared_ptr< VariableAttribute< Point3D > >
+        opengeode_mesh_api facet_normals( const SolidMesh3D& mesh );
+} // namespace geode
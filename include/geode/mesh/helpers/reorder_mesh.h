@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <geode/mesh/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( SolidMesh );
+    FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
+    ALIAS_3D( SolidMesh );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Helpers computing element orderings improving memory locality.
+     * Each returned permutation gives, for each new index, the old element
+     * index. It is meant to be applied using the builder reorder_vertices,
+     * reorder_polygons or reorder_polyhedra methods.
+     */
+
+    /*!
+     * Order the vertices along a Hilbert curve.
+     */
+    template < index_t dimension >
+    std::vector< index_t > hilbert_vertex_ordering(
+        const SurfaceMesh< dimension >& surface );
+
+    std::vector< index_t > opengeode_mesh_api hilbert_vertex_ordering(
+        const SolidMesh3D& solid );
+
+    /*!
+     * Order the polygons along a Hilbert curve going through their
+     * barycenters.
+     */
+    template < index_t dimension >
+    std::vector< index_t > hilbert_polygon_ordering(
+        const SurfaceMesh< dimension >& surface );
+
+    /*!
+     * Order the polyhedra along a Hilbert curve going through their
+     * barycenters.
+     */
+    std::vector< index_t > opengeode_mesh_api hilbert_polyhedron_ordering(
+        const SolidMesh3D& solid );
+
+    /*!
+     * Order the vertices using the reverse Cuthill-McKee algorithm on the
+     * mesh edges, reducing the bandwidth of the vertex adjacency.
+     */
+    template < index_t dimension >
+    std::vector< index_t > reverse_cuthill_mckee_vertex_ordering(
+        const SurfaceMesh< dimension >& surface );
+
+    std::vector< index_t > opengeode_mesh_api
+        reverse_cuthill_mckee_vertex_ordering( const SolidMesh3D& solid );
+} // namespace geode
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <absl/strings/string_view.h>
+
+#include <geode/mesh/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( RegularGrid );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    ALIAS_3D( RegularGrid );
+    ALIAS_3D( TriangulatedSurface );
+
+    template < typename T >
+    class VariableAttribute;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Compute the signed distance to a closed surface at each grid cell
+     * center and store it in a cell attribute.
+     * The distance is negative inside the surface and positive outside,
+     * given that triangles are oriented with normals pointing outside.
+     * Grid slabs are processed in parallel.
+     * @param[in] attribute_name Name of the cell attribute to fill, created if
+     * needed.
+     * @param[in] narrow_band If positive, only cells close enough to the
+     * surface to be within this distance are evaluated. Other cells get
+     * +/- \p narrow_band, their sign being propagated from evaluated cells.
+     * The narrow band should be at least twice the largest cell size.
+     * @return The filled attribute.
+     */
+    std::shared_ptr< VariableAttribute< double > > opengeode_mesh_api
+        compute_cell_signed_distances( const RegularGrid3D& grid,
+            const TriangulatedSurface3D& surface,
+            absl::string_view attribute_name,
+            double narrow_band = 0 );
+
+    /*!
+     * Compute the signed distance to a closed surface at each grid node.
+     * Nodes are ordered like cells, with one more node than cells in each
+     * direction.
+     * @see compute_cell_signed_distances
+     */
+    std::vector< double > opengeode_mesh_api compute_node_signed_distances(
+        const RegularGrid3D& grid,
+        const TriangulatedSurface3D& surface,
+        double narrow_band = 0 );
+} // namespace geode
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <geode/mesh/common.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( AABBTree );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    ALIAS_3D( AABBTree );
+    ALIAS_3D( TriangulatedSurface );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Detection of intersecting triangles using exact predicates.
+     * Candidate pairs are given by the AABBTrees and tested in parallel.
+     * Triangles sharing vertices (i.e. vertices at the exact same position)
+     * only intersect if they also meet elsewhere than on these common
+     * vertices, so that adjacent triangles and surfaces sharing a boundary
+     * are not reported. Degenerate triangles are ignored.
+     */
+
+    /*!
+     * Find all the pairs of intersecting triangles of a surface.
+     * @param[in] tree AABBTree built on \p surface using create_aabb_tree.
+     * @return Sorted pairs of triangle indices, the first index being the
+     * smallest.
+     */
+    std::vector< std::pair< index_t, index_t > > opengeode_mesh_api
+        triangulated_surface_self_intersections(
+            const TriangulatedSurface3D& surface, const AABBTree3D& tree );
+
+    /*!
+     * Find all the pairs of intersecting triangles between two surfaces.
+     * Candidate pairs are given by a simultaneous descent of both trees.
+     * @param[in] tree1 AABBTree built on \p surface1 using create_aabb_tree.
+     * @param[in] tree2 AABBTree built on \p surface2 using create_aabb_tree.
+     * @return Sorted pairs of triangle indices, the first one in
+     * \p surface1 and the second one in \p surface2.
+     */
+    std::vector< std::pair< index_t, index_t > > opengeode_mesh_api
+        triangulated_surfaces_intersections(
+            const TriangulatedSurface3D& surface1,
+            const AABBTree3D& tree1,
+            const TriangulatedSurface3D& surface2,
+            const AABBTree3D& tree2 );
+} // namespace geode
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/bitsery_archive.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/common.h>
+#include <geode/mesh/core/point_storage.h>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+} // namespace geode
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Write or read the points with the precision given by a
+         * PointStorage.
+         */
+        template < typename Archive >
+        struct CompactPointsSerializer;
+
+        template < typename Adapter, typename Context >
+        struct CompactPointsSerializer<
+            bitsery::Serializer< Adapter, Context > >
+        {
+            /*!
+             * Points are given by an accessor returning the point of a vertex
+             * index, so that they are written straight from the mesh.
+             */
+            template < index_t dimension, typename PointAccessor >
+            static void process(
+                bitsery::Serializer< Adapter, Context >& archive,
+                PointStorage storage,
+                index_t nb_points,
+                const PointAccessor& point_accessor )
+            {
+                uint64_t nb_values = nb_points;
+                archive.value8b( nb_values );
+                if( storage == PointStorage::single_precision )
+                {
+                    for( const auto p : Range{ nb_points } )
+                    {
+                        const Point< dimension >& point = point_accessor( p );
+                        for( const auto d : Range{ dimension } )
+                        {
+                            auto value =
+                                static_cast< float >( point.value( d ) );
+                            archive.value4b( value );
+                        }
+                    }
+                    return;
+                }
+                std::array< double, dimension > min;
+                std::array< double, dimension > max;
+                min.fill( 0 );
+                max.fill( 0 );
+                if( nb_points != 0 )
+                {
+                    const Point< dimension >& first = point_accessor( 0 );
+                    for( const auto d : Range{ dimension } )
+                    {
+                        min[d] = first.value( d );
+                        max[d] = first.value( d );
+                    }
+                }
+                for( const auto p : Range{ nb_points } )
+                {
+                    const Point< dimension >& point = point_accessor( p );
+                    for( const auto d : Range{ dimension } )
+                    {
+                        min[d] = std::min( min[d], point.value( d ) );
+                        max[d] = std::max( max[d], point.value( d ) );
+                    }
+                }
+                std::array< double, dimension > scale;
+                for( const auto d : Range{ dimension } )
+                {
+                    archive.value8b( min[d] );
+                    archive.value8b( max[d] );
+                    const auto extent = max[d] - min[d];
+                    scale[d] =
+                        extent > 0
+                            ? std::numeric_limits< uint16_t >::max() / extent
+                            : 0;
+                }
+                for( const auto p : Range{ nb_points } )
+                {
+                    const Point< dimension >& point = point_accessor( p );
+                    for( const auto d : Range{ dimension } )
+                    {
+                        auto value = static_cast< uint16_t >( std::lround(
+                            ( point.value( d ) - min[d] ) * scale[d] ) );
+                        archive.value2b( value );
+                    }
+                }
+            }
+        };
+
+        template < typename Adapter, typename Context >
+        struct CompactPointsSerializer<
+            bitsery::Deserializer< Adapter, Context > >
+        {
+            template < index_t dimension >
+            static void process(
+                bitsery::Deserializer< Adapter, Context >& archive,
+                PointStorage storage,
+                std::vector< Point< dimension > >& points )
+            {
+                uint64_t nb_points{ 0 };
+                archive.value8b( nb_points );
+                points.clear();
+                if( storage == PointStorage::single_precision )
+                {
+                    read_points( archive, nb_points, points,
+                        [&archive]( Point< dimension >& point ) {
+                            for( const auto d : Range{ dimension } )
+                            {
+                                float value{ 0 };
+                                archive.value4b( value );
+                                point.set_value( d, value );
+                            }
+                        } );
+                    return;
+                }
+                std::array< double, dimension > min;
+                std::array< double, dimension > step;
+                for( const auto d : Range{ dimension } )
+                {
+                    double max{ 0 };
+                    archive.value8b( min[d] );
+                    archive.value8b( max );
+                    step[d] = ( max - min[d] )
+                              / std::numeric_limits< uint16_t >::max();
+                }
+                read_points( archive, nb_points, points,
+                    [&archive, &min, &step]( Point< dimension >& point ) {
+                        for( const auto d : Range{ dimension } )
+                        {
+                            uint16_t value{ 0 };
+                            archive.value2b( value );
+                            point.set_value( d, min[d] + value * step[d] );
+                        }
+                    } );
+            }
+
+        private:
+            /*!
+             * The number of points comes from the input: points are added as
+             * they are read and reading stops at the first adapter error
+             * (e.g. end of input), so that a corrupted size cannot trigger a
+             * huge allocation.
+             */
+            template < index_t dimension, typename ReadPoint >
+            static void read_points(
+                bitsery::Deserializer< Adapter, Context >& archive,
+                uint64_t nb_points,
+                std::vector< Point< dimension > >& points,
+                const ReadPoint& read_point )
+            {
+                for( uint64_t p = 0; p < nb_points; p++ )
+                {
+                    Point< dimension > point;
+                    read_point( point );
+                    if( archive.adapter().error()
+                        != bitsery::ReaderError::NoError )
+                    {
+                        points.clear();
+                        return;
+                    }
+                    points.push_back( point );
+                }
+            }
+        };
+
+        /*!
+         * Content of a compact TriangulatedSurface file, as read: the points
+         * written with a reduced precision and the triangle vertices.
+         */
+        template < index_t dimension >
+        struct CompactTriangulatedSurface
+        {
+            template < typename Archive >
+            void serialize( Archive& archive )
+            {
+                archive.ext( *this,
+                    DefaultGrowable< Archive, CompactTriangulatedSurface >{},
+                    []( Archive& archive,
+                        CompactTriangulatedSurface& surface ) {
+                        archive.value1b( surface.storage );
+                        OPENGEODE_EXCEPTION(
+                            surface.storage == PointStorage::single_precision
+                                || surface.storage == PointStorage::quantized,
+                            "[CompactTriangulatedSurface] Unknown point "
+                            "storage" );
+                        CompactPointsSerializer< Archive >::process(
+                            archive, surface.storage, surface.points );
+                        serialize_indices( archive, surface.triangles );
+                    } );
+            }
+
+            PointStorage storage{ PointStorage::single_precision };
+            std::vector< Point< dimension > > points;
+            std::vector< index_t > triangles;
+        };
+
+        /*!
+         * Same content than CompactTriangulatedSurface, written with the
+         * points taken straight from the mesh instead of a copy.
+         */
+        template < index_t dimension >
+        struct CompactTriangulatedSurfaceView
+        {
+            CompactTriangulatedSurfaceView(
+                const TriangulatedSurface< dimension >& surface_in,
+                PointStorage storage_in )
+                : surface( surface_in ), storage( storage_in )
+            {
+            }
+
+            template < typename Archive >
+            void serialize( Archive& archive )
+            {
+                archive.ext( *this,
+                    DefaultGrowable< Archive,
+                        CompactTriangulatedSurfaceView >{},
+                    []( Archive& archive,
+                        CompactTriangulatedSurfaceView& view ) {
+                        archive.value1b( view.storage );
+                        CompactPointsSerializer< Archive >::template process<
+                            dimension >( archive, view.storage,
+                            view.surface.nb_vertices(),
+                            [&view]( index_t v ) -> const Point< dimension >& {
+                                return view.surface.point( v );
+                            } );
+                        serialize_indices( archive, view.triangles );
+                    } );
+            }
+
+            const TriangulatedSurface< dimension >& surface;
+            PointStorage storage;
+            std::vector< index_t > triangles;
+        };
+
+        template < index_t dimension >
+        std::string compact_triangulated_surface_extension(
+            PointStorage storage )
+        {
+            return absl::StrCat(
+                storage == PointStorage::single_precision ? "og_ctsf"
+                                                          : "og_qtsf",
+                dimension, "d" );
+        }
+    } // namespace detail
+} // namespace geode
@@ -23,26 +23,30 @@
 
 #pragma once
 
-#include <fstream>
-
 #include <geode/geometry/bitsery_archive.h>
 
 #include <geode/mesh/core/bitsery_archive.h>
 
 #define BITSERY_DO_READ()                                                      \
+    bool is_stream_supported() const final                                     \
+    {                                                                          \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
     void do_read() final                                                       \
     {                                                                          \
-        std::ifstream file{ this->filename().data(), std::ifstream::binary };  \
         TContext context{};                                                    \
         register_basic_deserialize_pcontext( std::get< 0 >( context ) );       \
         register_geometry_deserialize_pcontext( std::get< 0 >( context ) );    \
         register_mesh_deserialize_pcontext( std::get< 0 >( context ) );        \
-        Deserializer archive{ context, file };                                 \
+        Deserializer archive{ context, this->stream() };                       \
         archive.object( mesh_ );                                               \
         const auto& adapter = archive.adapter();                               \
-        OPENGEODE_EXCEPTION( adapter.error() == bitsery::ReaderError::NoError  \
-                                 && adapter.isCompletedSuccessfully()          \
-                                 && std::get< 1 >( context ).isValid(),        \
+        OPENGEODE_EXCEPTION(                                                   \
+            adapter.error() == bitsery::ReaderError::NoError                   \
+                && ( this->reads_from_stream()                                 \
+                     || adapter.isCompletedSuccessfully() )                    \
+                && std::get< 1 >( context ).isValid(),                         \
             "[Bitsery::read] Error while reading file: ", this->filename() );  \
     }
 
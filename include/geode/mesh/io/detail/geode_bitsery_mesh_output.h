@@ -23,21 +23,23 @@
 
 #pragma once
 
-#include <fstream>
-
 #include <geode/geometry/bitsery_archive.h>
 
 #include <geode/mesh/core/bitsery_archive.h>
 
 #define BITSERY_WRITE()                                                        \
+    bool is_stream_supported() const final                                     \
+    {                                                                          \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
     void write() const final                                                   \
     {                                                                          \
-        std::ofstream file{ this->filename().data(), std::ofstream::binary };  \
         TContext context{};                                                    \
         register_basic_serialize_pcontext( std::get< 0 >( context ) );         \
         register_geometry_serialize_pcontext( std::get< 0 >( context ) );      \
         register_mesh_serialize_pcontext( std::get< 0 >( context ) );          \
-        Serializer archive{ context, file };                                   \
+        Serializer archive{ context, this->stream() };                         \
         archive.object( mesh_ );                                               \
         archive.adapter().flush();                                             \
         OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),               \
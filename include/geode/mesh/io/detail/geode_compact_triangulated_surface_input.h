@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/io/detail/compact_triangulated_surface.h>
+#include <geode/mesh/io/triangulated_surface_input.h>
+
+namespace geode
+{
+    /*!
+     * Load a TriangulatedSurface saved by
+     * OpenGeodeCompactTriangulatedSurfaceOutput, whatever its point storage.
+     * Polygon adjacencies are computed after loading.
+     */
+    template < index_t dimension >
+    class OpenGeodeCompactTriangulatedSurfaceInput
+        : public TriangulatedSurfaceInput< dimension >
+    {
+    public:
+        OpenGeodeCompactTriangulatedSurfaceInput(
+            TriangulatedSurface< dimension >& triangulated_surface,
+            absl::string_view filename )
+            : TriangulatedSurfaceInput< dimension >(
+                triangulated_surface, filename )
+        {
+        }
+
+        bool is_stream_supported() const final
+        {
+            return true;
+        }
+
+        void do_read() final
+        {
+            detail::CompactTriangulatedSurface< dimension > compact;
+            TContext context{};
+            Deserializer archive{ context, this->stream() };
+            archive.object( compact );
+            const auto& adapter = archive.adapter();
+            OPENGEODE_EXCEPTION(
+                adapter.error() == bitsery::ReaderError::NoError
+                    && ( this->reads_from_stream()
+                         || adapter.isCompletedSuccessfully() )
+                    && std::get< 1 >( context ).isValid(),
+                "[Bitsery::read] Error while reading file: ",
+                this->filename() );
+            const auto nb_points =
+                static_cast< index_t >( compact.points.size() );
+            OPENGEODE_EXCEPTION( compact.triangles.size() % 3 == 0,
+                "[OpenGeodeCompactTriangulatedSurfaceInput] Wrong number of "
+                "triangle vertices in file: ",
+                this->filename() );
+            OPENGEODE_EXCEPTION(
+                std::all_of( compact.triangles.begin(),
+                    compact.triangles.end(),
+                    [nb_points]( index_t vertex ) {
+                        return vertex < nb_points;
+                    } ),
+                "[OpenGeodeCompactTriangulatedSurfaceInput] Wrong triangle "
+                "vertex in file: ",
+                this->filename() );
+            auto builder = TriangulatedSurfaceBuilder< dimension >::create(
+                this->triangulated_surface() );
+            builder->create_vertices( nb_points );
+            for( const auto v : Range{ nb_points } )
+            {
+                builder->set_point( v, std::move( compact.points[v] ) );
+            }
+            for( index_t t = 0; t < compact.triangles.size(); t += 3 )
+            {
+                builder->create_triangle( { compact.triangles[t],
+                    compact.triangles[t + 1], compact.triangles[t + 2] } );
+            }
+            builder->compute_polygon_adjacencies();
+        }
+    };
+    ALIAS_2D_AND_3D( OpenGeodeCompactTriangulatedSurfaceInput );
+} // namespace geode
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/io/detail/compact_triangulated_surface.h>
+#include <geode/mesh/io/triangulated_surface_output.h>
+
+namespace geode
+{
+    /*!
+     * Save any TriangulatedSurface with its points written with a reduced
+     * precision. Only the points and the triangles are saved, attributes
+     * are not.
+     * @tparam storage Precision of the written point coordinates, selected
+     * through the file extension (see extension_static()).
+     */
+    template < index_t dimension, PointStorage storage >
+    class OpenGeodeCompactTriangulatedSurfaceOutput
+        : public TriangulatedSurfaceOutput< dimension >
+    {
+    public:
+        OpenGeodeCompactTriangulatedSurfaceOutput(
+            const TriangulatedSurface< dimension >& triangulated_surface,
+            absl::string_view filename )
+            : TriangulatedSurfaceOutput< dimension >(
+                triangulated_surface, filename )
+        {
+        }
+
+        static absl::string_view extension_static()
+        {
+            static const auto extension =
+                detail::compact_triangulated_surface_extension< dimension >(
+                    storage );
+            return extension;
+        }
+
+        bool is_stream_supported() const final
+        {
+            return true;
+        }
+
+        void write() const final
+        {
+            const auto& surface = this->triangulated_surface();
+            detail::CompactTriangulatedSurfaceView< dimension > compact{
+                surface, storage
+            };
+            compact.triangles.reserve( 3 * surface.nb_polygons() );
+            for( const auto t : Range{ surface.nb_polygons() } )
+            {
+                for( const auto v : Range{ 3 } )
+                {
+                    compact.triangles.push_back(
+                        surface.polygon_vertex( { t, v } ) );
+                }
+            }
+            TContext context{};
+            Serializer archive{ context, this->stream() };
+            archive.object( compact );
+            archive.adapter().flush();
+            OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
+                "[Bitsery::write] Error while writing file: ",
+                this->filename() );
+        }
+    };
+} // namespace geode
@@ -39,20 +39,24 @@ namespace geode
             mesh_.reset( new RegularGrid< dimension >{ std::move( mesh ) } );
         }
 
+        bool is_stream_supported() const final
+        {
+            return true;
+        }
+
         void read() final
         {
-            std::ifstream file{ this->filename().data(),
-                std::ifstream::binary };
             TContext context{};
             register_basic_deserialize_pcontext( std::get< 0 >( context ) );
             register_geometry_deserialize_pcontext( std::get< 0 >( context ) );
             register_mesh_deserialize_pcontext( std::get< 0 >( context ) );
-            Deserializer archive{ context, file };
+            Deserializer archive{ context, this->stream() };
             archive.object( *mesh_ );
             const auto& adapter = archive.adapter();
             OPENGEODE_EXCEPTION(
                 adapter.error() == bitsery::ReaderError::NoError
-                    && adapter.isCompletedSuccessfully()
+                    && ( this->reads_from_stream()
+                         || adapter.isCompletedSuccessfully() )
                     && std::get< 1 >( context ).isValid(),
                 "[Bitsery::read] Error while reading file: ",
                 this->filename() );
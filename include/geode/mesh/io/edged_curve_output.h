@@ -45,6 +45,19 @@ namespace geode
     void save_edged_curve( const EdgedCurve< dimension >& edged_curve,
         absl::string_view filename );
 
+    /*!
+     * API function for saving an EdgedCurve into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] edged_curve EdgedCurve to save.
+     * @param[in] stream Stream where the EdgedCurve is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_edged_curve(
+        const EdgedCurve< dimension >& edged_curve,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class EdgedCurveOutput : public GraphOutput
     {
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/factory.h>
 
 #include <geode/mesh/common.h>
@@ -44,6 +46,27 @@ namespace geode
     void opengeode_mesh_api load_graph(
         Graph& graph, absl::string_view filename );
 
+    /*!
+     * API function for loading an Graph from a stream.
+     * The adequate loader is called depending on the given extension.
+     * @param[out] graph Loaded Graph.
+     * @param[in] stream Stream to read from.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    void opengeode_mesh_api load_graph(
+        Graph& graph, std::istream& stream, absl::string_view extension );
+
+    /*!
+     * API function for loading an Graph from a memory buffer.
+     * The buffer is read in place, without any copy nor file.
+     * @param[out] graph Loaded Graph.
+     * @param[in] buffer Memory block containing the serialized mesh.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    void opengeode_mesh_api load_graph( Graph& graph,
+        absl::Span< const char > buffer,
+        absl::string_view extension );
+
     class opengeode_mesh_api GraphInput : public VertexSetInput
     {
     protected:
@@ -44,6 +44,17 @@ namespace geode
     void opengeode_mesh_api save_graph(
         const Graph& graph, absl::string_view filename );
 
+    /*!
+     * API function for saving a Graph into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] graph Graph to save.
+     * @param[in] stream Stream where the Graph is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    void opengeode_mesh_api save_graph( const Graph& graph,
+        std::ostream& stream,
+        absl::string_view extension );
+
     class opengeode_mesh_api GraphOutput : public VertexSetOutput
     {
     protected:
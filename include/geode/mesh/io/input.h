@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <fstream>
+
 #include <geode/mesh/common.h>
 #include <geode/mesh/io/io.h>
 
@@ -33,7 +35,43 @@ namespace geode
     public:
         virtual void read() = 0;
 
+        /*!
+         * Return true if the input is able to read from any std::istream
+         * (set by set_stream) instead of opening the file.
+         */
+        virtual bool is_stream_supported() const
+        {
+            return false;
+        }
+
+        /*!
+         * Read data from the given stream instead of opening the file.
+         * The stream should remain valid until the end of read().
+         * @exception OpenGeodeException if streams are not supported.
+         */
+        void set_stream( std::istream& stream );
+
     protected:
         Input( absl::string_view filename ) : IOFile( filename ) {}
+
+        /*!
+         * Return the stream to read from: the stream given by set_stream or
+         * the file opened in binary mode.
+         */
+        std::istream& stream();
+
+        /*!
+         * Return true if reading from a stream given by set_stream. Such a
+         * stream may hold other data after the read content, whereas a file
+         * is expected to be read up to its end.
+         */
+        bool reads_from_stream() const
+        {
+            return stream_ && !file_;
+        }
+
+    private:
+        std::istream* stream_{ nullptr };
+        std::unique_ptr< std::ifstream > file_;
     };
 } // namespace geode
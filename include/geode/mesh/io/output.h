@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <fstream>
+
 #include <geode/mesh/common.h>
 #include <geode/mesh/io/io.h>
 
@@ -33,7 +35,33 @@ namespace geode
     public:
         virtual void write() const = 0;
 
+        /*!
+         * Return true if the output is able to write into any std::ostream
+         * (set by set_stream) instead of creating the file.
+         */
+        virtual bool is_stream_supported() const
+        {
+            return false;
+        }
+
+        /*!
+         * Write data into the given stream instead of creating the file.
+         * The stream should remain valid until the end of write().
+         * @exception OpenGeodeException if streams are not supported.
+         */
+        void set_stream( std::ostream& stream );
+
     protected:
         Output( absl::string_view filename ) : IOFile( filename ) {}
+
+        /*!
+         * Return the stream to write into: the stream given by set_stream or
+         * the file created in binary mode.
+         */
+        std::ostream& stream() const;
+
+    private:
+        mutable std::ostream* stream_{ nullptr };
+        mutable std::unique_ptr< std::ofstream > file_;
     };
 } // namespace geode
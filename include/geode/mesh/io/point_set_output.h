@@ -45,6 +45,19 @@ namespace geode
     void save_point_set(
         const PointSet< dimension >& point_set, absl::string_view filename );
 
+    /*!
+     * API function for saving a PointSet into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] point_set PointSet to save.
+     * @param[in] stream Stream where the PointSet is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_point_set(
+        const PointSet< dimension >& point_set,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class PointSetOutput : public VertexSetOutput
     {
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/factory.h>
 
 #include <geode/mesh/common.h>
@@ -55,6 +57,41 @@ namespace geode
     std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
         absl::string_view filename );
 
+    /*!
+     * API function for loading a PolygonalSurface from a stream.
+     * The adequate loader is called depending on the given extension.
+     * @param[in] impl Data structure implementation.
+     * @param[in] stream Stream to read from.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension );
+
+    /*!
+     * API function for loading a PolygonalSurface from a stream.
+     * The adequate loader is called depending on the given extension.
+     * Default data structure implémentation is used.
+     * @param[in] stream Stream to read from.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        std::istream& stream, absl::string_view extension );
+
+    /*!
+     * API function for loading a PolygonalSurface from a memory buffer.
+     * The buffer is read in place, without any copy nor file.
+     * Default data structure implémentation is used.
+     * @param[in] buffer Memory block containing the serialized mesh.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        absl::Span< const char > buffer, absl::string_view extension );
+
     template < index_t dimension >
     class PolygonalSurfaceInput : public VertexSetInput
     {
@@ -47,6 +47,19 @@ namespace geode
         const PolygonalSurface< dimension >& polygonal_surface,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a PolygonalSurface into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] polygonal_surface PolygonalSurface to save.
+     * @param[in] stream Stream where the PolygonalSurface is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_polygonal_surface(
+        const PolygonalSurface< dimension >& polygonal_surface,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class PolygonalSurfaceOutput : public VertexSetOutput
     {
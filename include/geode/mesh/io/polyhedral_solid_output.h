@@ -46,6 +46,19 @@ namespace geode
         const PolyhedralSolid< dimension >& polyhedral_solid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a PolyhedralSolid into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] polyhedral_solid PolyhedralSolid to save.
+     * @param[in] stream Stream where the PolyhedralSolid is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_polyhedral_solid(
+        const PolyhedralSolid< dimension >& polyhedral_solid,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class PolyhedralSolidOutput : public VertexSetOutput
     {
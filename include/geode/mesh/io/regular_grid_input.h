@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/factory.h>
 
 #include <geode/mesh/common.h>
@@ -44,6 +46,26 @@ namespace geode
     std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
         absl::string_view filename );
 
+    /*!
+     * API function for loading a RegularGrid from a stream.
+     * The adequate loader is called depending on the given extension.
+     * @param[in] stream Stream to read from.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
+        std::istream& stream, absl::string_view extension );
+
+    /*!
+     * API function for loading a RegularGrid from a memory buffer.
+     * The buffer is read in place, without any copy nor file.
+     * @param[in] buffer Memory block containing the serialized mesh.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
+        absl::Span< const char > buffer, absl::string_view extension );
+
     template < index_t dimension >
     class RegularGridInput : public Input
     {
@@ -45,6 +45,18 @@ namespace geode
     void save_regular_grid( const RegularGrid< dimension >& regular_grid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a RegularGrid into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] regular_grid RegularGrid to save.
+     * @param[in] stream Stream where the RegularGrid is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_regular_grid( const RegularGrid< dimension >& regular_grid,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class RegularGridOutput : public Output
     {
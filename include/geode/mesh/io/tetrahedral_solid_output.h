@@ -46,6 +46,19 @@ namespace geode
         const TetrahedralSolid< dimension >& tetrahedral_solid,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a TetrahedralSolid into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] tetrahedral_solid TetrahedralSolid to save.
+     * @param[in] stream Stream where the TetrahedralSolid is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_tetrahedral_solid(
+        const TetrahedralSolid< dimension >& tetrahedral_solid,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class TetrahedralSolidOutput : public VertexSetOutput
     {
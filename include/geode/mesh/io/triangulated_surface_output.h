@@ -46,6 +46,19 @@ namespace geode
         const TriangulatedSurface< dimension >& triangulated_surface,
         absl::string_view filename );
 
+    /*!
+     * API function for saving a TriangulatedSurface into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] triangulated_surface TriangulatedSurface to save.
+     * @param[in] stream Stream where the TriangulatedSurface is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    template < index_t dimension >
+    void save_triangulated_surface(
+        const TriangulatedSurface< dimension >& triangulated_surface,
+        std::ostream& stream,
+        absl::string_view extension );
+
     template < index_t dimension >
     class TriangulatedSurfaceOutput : public VertexSetOutput
     {
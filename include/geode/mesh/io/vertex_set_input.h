@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/factory.h>
 
 #include <geode/mesh/common.h>
@@ -54,6 +56,38 @@ namespace geode
     std::unique_ptr< VertexSet > opengeode_mesh_api load_vertex_set(
         absl::string_view filename );
 
+    /*!
+     * API function for loading an VertexSet from a stream.
+     * The adequate loader is called depending on the given extension.
+     * @param[in] impl Data structure implementation.
+     * @param[in] stream Stream to read from.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    std::unique_ptr< VertexSet > opengeode_mesh_api load_vertex_set(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension );
+
+    /*!
+     * API function for loading an VertexSet from a stream.
+     * The adequate loader is called depending on the given extension.
+     * Default data structure implémentation is used.
+     * @param[in] stream Stream to read from.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    std::unique_ptr< VertexSet > opengeode_mesh_api load_vertex_set(
+        std::istream& stream, absl::string_view extension );
+
+    /*!
+     * API function for loading an VertexSet from a memory buffer.
+     * The buffer is read in place, without any copy nor file.
+     * Default data structure implémentation is used.
+     * @param[in] buffer Memory block containing the serialized mesh.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    std::unique_ptr< VertexSet > opengeode_mesh_api load_vertex_set(
+        absl::Span< const char > buffer, absl::string_view extension );
+
     class opengeode_mesh_api VertexSetInput : public Input
     {
         OPENGEODE_DISABLE_COPY_AND_MOVE( VertexSetInput );
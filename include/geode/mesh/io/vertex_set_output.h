@@ -44,6 +44,17 @@ namespace geode
     void opengeode_mesh_api save_vertex_set(
         const VertexSet& vertex_set, absl::string_view filename );
 
+    /*!
+     * API function for saving a VertexSet into a stream.
+     * The adequate saver is called depending on the given extension.
+     * @param[in] vertex_set VertexSet to save.
+     * @param[in] stream Stream where the VertexSet is written.
+     * @param[in] extension Extension of the data format (without dot).
+     */
+    void opengeode_mesh_api save_vertex_set( const VertexSet& vertex_set,
+        std::ostream& stream,
+        absl::string_view extension );
+
     class opengeode_mesh_api VertexSetOutput : public Output
     {
         OPENGEODE_DISABLE_COPY_AND_MOVE( VertexSetOutput );
@@ -50,6 +50,14 @@ namespace geode
          */
         void unregister_component( const uuid& id );
 
+        /*!
+         * Remove several components from the set of components registered by
+         * the Relationships and all their associated relationships.
+         * All the components are removed in a single pass.
+         * @param[in] ids Unique indices of the components to remove
+         */
+        void unregister_components( absl::Span< const uuid > ids );
+
         /*!
          * Add a new relationship of type boundary-incidence between two
          * components
@@ -57,6 +57,18 @@ namespace geode
             vertex_identifier_.unregister_mesh_component( component, {} );
         }
 
+        /*!
+         * Remove several components from the VertexIdentifier and delete
+         * corresponding information (i.e. the attribute on component meshes).
+         * The unique vertices are filtered in a single pass.
+         */
+        template < typename MeshComponent >
+        void unregister_mesh_components( absl::Span<
+            const std::reference_wrapper< const MeshComponent > > components )
+        {
+            vertex_identifier_.unregister_mesh_components( components, {} );
+        }
+
         /*!
          * Create an empty unique vertex.
          * @return Index of the created unique vertex.
@@ -86,6 +98,15 @@ namespace geode
             const MeshComponentVertex& component_vertex_id,
             index_t unique_vertex_id );
 
+        /*!
+         * Identify all the vertices of a component to unique vertices.
+         * @param[in] component_id Component unique index.
+         * @param[in] unique_vertices Unique vertex index of each component
+         * vertex. NO_ID unsets the corresponding component vertex.
+         */
+        void set_unique_vertices( const ComponentID& component_id,
+            absl::Span< const index_t > unique_vertices );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_id Component unique index used to filter
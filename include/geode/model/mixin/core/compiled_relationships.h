@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.h>
+
+#include <geode/model/common.h>
+#include <geode/model/mixin/core/component_type.h>
+
+namespace geode
+{
+    class Relationships;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Immutable snapshot of all the relations stored in a Relationships.
+     * Components are identified by dense indices in [0, nb_components()) and
+     * each relation kind is stored as a compressed adjacency array (CSR).
+     * Once built, all queries are allocation-free and return views on
+     * contiguous sorted arrays of component indices.
+     * The snapshot is not updated when the Relationships is modified and
+     * should be built again using Relationships::compile_relationships().
+     */
+    class opengeode_model_api CompiledRelationships
+    {
+        friend class Relationships;
+
+        /*!
+         * Compressed adjacency of one relation kind: the related components
+         * of component c are stored in values[offsets[c], offsets[c+1]).
+         */
+        struct Adjacency
+        {
+            absl::Span< const index_t > related( index_t component ) const
+            {
+                return { values.data() + offsets[component],
+                    offsets[component + 1] - offsets[component] };
+            }
+
+            bool contains( index_t component, index_t other ) const;
+
+            /*!
+             * Fill the adjacency from a list of (component, related) pairs
+             * using a counting sort.
+             */
+            void build( index_t nb_components,
+                absl::Span< const std::pair< index_t, index_t > > relations );
+
+            std::vector< index_t > offsets;
+            std::vector< index_t > values;
+        };
+
+    public:
+        CompiledRelationships() = default;
+
+        index_t nb_components() const
+        {
+            return static_cast< index_t >( components_.size() );
+        }
+
+        /*!
+         * Return the dense index of a component in the snapshot
+         * @param[in] id Unique index of the component
+         * @exception if the component is not in the snapshot
+         */
+        index_t component_index( const uuid& id ) const;
+
+        /*!
+         * Return the identifier (type and unique index) of a component
+         * @param[in] component Dense index of the component in the snapshot
+         */
+        const ComponentID& component_id( index_t component ) const
+        {
+            return components_[component];
+        }
+
+        absl::Span< const index_t > boundaries( index_t component ) const
+        {
+            return boundaries_.related( component );
+        }
+
+        absl::Span< const index_t > incidences( index_t component ) const
+        {
+            return incidences_.related( component );
+        }
+
+        absl::Span< const index_t > internals( index_t component ) const
+        {
+            return internals_.related( component );
+        }
+
+        absl::Span< const index_t > embeddings( index_t component ) const
+        {
+            return embeddings_.related( component );
+        }
+
+        absl::Span< const index_t > items( index_t component ) const
+        {
+            return items_.related( component );
+        }
+
+        absl::Span< const index_t > collections( index_t component ) const
+        {
+            return collections_.related( component );
+        }
+
+        bool is_boundary( index_t boundary, index_t incidence ) const
+        {
+            return boundaries_.contains( incidence, boundary );
+        }
+
+        bool is_internal( index_t internal, index_t embedding ) const
+        {
+            return internals_.contains( embedding, internal );
+        }
+
+        bool is_item( index_t item, index_t collection ) const
+        {
+            return items_.contains( collection, item );
+        }
+
+    private:
+        std::vector< ComponentID > components_;
+        absl::flat_hash_map< uuid, index_t > uuid2index_;
+        Adjacency boundaries_;
+        Adjacency incidences_;
+        Adjacency internals_;
+        Adjacency embeddings_;
+        Adjacency items_;
+        Adjacency collections_;
+    };
+} // namespace geode
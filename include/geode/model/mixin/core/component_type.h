@@ -27,6 +27,7 @@
 
 #include <absl/hash/hash.h>
 
+#include <geode/basic/attribute_utils.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/named_type.h>
 #include <geode/basic/uuid.h>
@@ -94,6 +95,15 @@ namespace geode
         uuid id_;
     };
 
+    template <>
+    struct AttributeHeapMemory< ComponentID >
+    {
+        static size_t size( const ComponentID& value )
+        {
+            return AttributeHeapMemory< std::string >::size(
+                value.type().get() );
+        }
+    };
 } // namespace geode
 
 namespace std
@@ -24,9 +24,11 @@
 #pragma once
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <bitsery/ext/std_map.h>
 
+#include <geode/basic/attribute_utils.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/uuid.h>
 
@@ -68,6 +70,21 @@ namespace geode
                 }
             }
 
+            void update_indices( absl::Span< const index_t > old2new )
+            {
+                for( auto& it : uuid2index_ )
+                {
+                    it.second = old2new[it.second];
+                }
+            }
+
+            size_t memory_usage() const
+            {
+                return sizeof( *this )
+                       + AttributeHeapMemory< absl::flat_hash_map< uuid,
+                           index_t > >::size( uuid2index_ );
+            }
+
         private:
             friend class bitsery::Access;
             template < typename Archive >
@@ -80,7 +97,7 @@ namespace geode
                                 uuids.uuid2index_.max_size() },
                             []( Archive& archive, uuid& id, index_t& index ) {
                                 archive.object( id );
-                                archive.value4b( index );
+                                serialize_index( archive, index );
                             } );
                     } );
             }
@@ -23,10 +23,14 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
+#include <geode/basic/memory_usage.h>
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
 #include <geode/model/common.h>
+#include <geode/model/mixin/core/compiled_relationships.h>
 #include <geode/model/mixin/core/component_type.h>
 
 namespace geode
@@ -252,6 +256,20 @@ namespace geode
         Relationships();
         ~Relationships();
 
+        /*!
+         * Return the identifier (type and unique index) of a registered
+         * component
+         * @param[in] id Unique index of the component
+         */
+        const ComponentID& component_id( const uuid& id ) const;
+
+        /*!
+         * Build an immutable snapshot of all the current relations, with
+         * dense component indices and compressed adjacency arrays, for
+         * allocation-free repeated queries.
+         */
+        CompiledRelationships compile_relationships() const;
+
         index_t nb_boundaries( const uuid& id ) const;
 
         BoundaryRange boundaries( const uuid& id ) const;
@@ -284,6 +302,11 @@ namespace geode
 
         void save_relationships( absl::string_view directory ) const;
 
+        /*!
+         * Return the memory used by the relationships graph and indices
+         */
+        MemoryUsage memory_usage() const;
+
         /*!
          * Add a component in the set of components registered by the
          * Relationships
@@ -299,6 +322,15 @@ namespace geode
          */
         void unregister_component( const uuid& id, RelationshipsBuilderKey );
 
+        /*!
+         * Remove several components from the set of components registered by
+         * the Relationships and all their associated relationships.
+         * All the components are removed in a single pass.
+         * @param[in] ids Unique indices of the components to remove
+         */
+        void unregister_components(
+            absl::Span< const uuid > ids, RelationshipsBuilderKey );
+
         /*!
          * Add a new relationship of type boundary-incidence between two
          * components
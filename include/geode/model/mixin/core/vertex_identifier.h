@@ -1,8 +1,11 @@
 #pragma once
 
+#include <functional>
+
 #include <absl/types/span.h>
 
 #include <geode/basic/bitsery_archive.h>
+#include <geode/basic/memory_usage.h>
 #include <geode/basic/passkey.h>
 #include <geode/basic/pimpl.h>
 
@@ -39,7 +42,7 @@ namespace geode
                 []( Archive& archive,
                     MeshComponentVertex& mesh_component_vertex ) {
                     archive.object( mesh_component_vertex.component_id );
-                    archive.value4b( mesh_component_vertex.vertex );
+                    serialize_index( archive, mesh_component_vertex.vertex );
                 } );
         }
 
@@ -54,6 +57,16 @@ namespace geode
         }
     };
 
+    template <>
+    struct AttributeHeapMemory< MeshComponentVertex >
+    {
+        static size_t size( const MeshComponentVertex& value )
+        {
+            return AttributeHeapMemory< ComponentID >::size(
+                value.component_id );
+        }
+    };
+
     /*!
      * This class identifies groups of geometric component vertices
      * as unique vertices.
@@ -102,6 +115,16 @@ namespace geode
         index_t unique_vertex(
             const MeshComponentVertex& component_vertex ) const;
 
+        /*!
+         * Return the unique vertex indices of all the vertices of a given
+         * component, indexed by component vertex.
+         * @param[in] component_id Component unique index.
+         * @warning The returned Span is invalidated by any modification of
+         * the component mesh vertices.
+         */
+        absl::Span< const index_t > unique_vertices(
+            const ComponentID& component_id ) const;
+
         /*!
          * Return true if given unique vertex has at least one mesh component
          * vertex of given component type
@@ -122,6 +145,13 @@ namespace geode
          */
         void save_unique_vertices( absl::string_view directory ) const;
 
+        /*!
+         * Return the memory used by the unique vertices and their
+         * component vertices. The attributes stored on component meshes are
+         * accounted by the meshes themselves.
+         */
+        MemoryUsage memory_usage() const;
+
         /*!
          * Add a component in the VertexIdentifier
          */
@@ -137,6 +167,17 @@ namespace geode
         void unregister_mesh_component(
             const MeshComponent& component, BuilderKey );
 
+        /*!
+         * Remove several components from the VertexIdentifier and delete
+         * corresponding information (i.e. the attribute on component meshes).
+         * The unique vertices are filtered in a single pass.
+         */
+        template < typename MeshComponent >
+        void unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const MeshComponent > >
+                components,
+            BuilderKey );
+
         /*!
          * Create an empty unique vertex.
          * @return Index of the created unique vertex.
@@ -168,6 +209,16 @@ namespace geode
             index_t unique_vertex_id,
             BuilderKey );
 
+        /*!
+         * Identify all the vertices of a component to unique vertices.
+         * @param[in] component_id Component unique index.
+         * @param[in] unique_vertices Unique vertex index of each component
+         * vertex. NO_ID unsets the corresponding component vertex.
+         */
+        void set_unique_vertices( const ComponentID& component_id,
+            absl::Span< const index_t > unique_vertices,
+            BuilderKey );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_id Component unique index used to filter
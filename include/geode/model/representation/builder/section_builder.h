@@ -122,6 +122,14 @@ namespace geode
 
         void remove_model_boundary( const ModelBoundary2D& boundary );
 
+        /*!
+         * Remove several components of any type at once.
+         * Relationships and unique vertices are updated in a single pass
+         * instead of one pass per removed component.
+         * @param[in] ids Unique indices of the components to remove
+         */
+        void remove_components( absl::Span< const uuid > ids );
+
         void add_corner_line_boundary_relationship(
             const Corner2D& corner, const Line2D& line );
 
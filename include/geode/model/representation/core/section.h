@@ -224,6 +224,12 @@ namespace geode
          */
         BoundingBox2D bounding_box() const;
 
+        /*!
+         * Return the memory used by the model, detailed by component mesh,
+         * relationships and unique vertices
+         */
+        MemoryUsage memory_usage() const;
+
         static absl::string_view native_extension_static()
         {
             static const auto extension = "og_sctn";
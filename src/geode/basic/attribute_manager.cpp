@@ -27,6 +27,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
 #include <bitsery/traits/string.h>
 
 #include <geode/basic/attribute.h>
@@ -38,6 +40,8 @@ namespace geode
 {
     class AttributeManager::Impl
     {
+        static constexpr index_t PARALLEL_DELETION_THRESHOLD{ 100000 };
+
     public:
         std::shared_ptr< AttributeBase > find_attribute_base(
             absl::string_view name ) const
@@ -110,6 +114,33 @@ namespace geode
             }
         }
 
+        void assign_attribute_values( absl::Span< const index_t > from_elements,
+            absl::Span< const index_t > to_elements,
+            AttributeBase::AttributeKey key )
+        {
+            for( auto &it : attributes_ )
+            {
+                if( it.second->properties().assignable )
+                {
+                    it.second->compute_values(
+                        from_elements, to_elements, key );
+                }
+            }
+        }
+
+        void interpolate_attribute_values(
+            const AttributeLinearInterpolations &interpolations,
+            AttributeBase::AttributeKey key )
+        {
+            for( auto &it : attributes_ )
+            {
+                if( it.second->properties().interpolable )
+                {
+                    it.second->compute_values( interpolations, key );
+                }
+            }
+        }
+
         absl::FixedArray< absl::string_view > attribute_names() const
         {
             absl::FixedArray< absl::string_view > names( attributes_.size() );
@@ -164,19 +195,63 @@ namespace geode
         void delete_elements( const std::vector< bool > &to_delete,
             AttributeBase::AttributeKey key )
         {
-            for( auto &it : attributes_ )
+            if( attributes_.size() < 2
+                || to_delete.size() < PARALLEL_DELETION_THRESHOLD )
             {
-                it.second->delete_elements( to_delete, key );
+                for( auto &it : attributes_ )
+                {
+                    it.second->delete_elements( to_delete, key );
+                }
+            }
+            else
+            {
+                // Each attribute is compacted by its own task
+                std::vector< AttributeBase * > attributes;
+                attributes.reserve( attributes_.size() );
+                for( auto &it : attributes_ )
+                {
+                    attributes.push_back( it.second.get() );
+                }
+                async::parallel_for(
+                    async::irange( index_t{ 0 },
+                        static_cast< index_t >( attributes.size() ) ),
+                    [&attributes, &to_delete, &key]( index_t a ) {
+                        attributes[a]->delete_elements( to_delete, key );
+                    } );
             }
             nb_elements_ -=
                 static_cast< index_t >( absl::c_count( to_delete, true ) );
         }
 
+        void permute_elements( absl::Span< const index_t > permutation,
+            AttributeBase::AttributeKey key )
+        {
+            for( auto &it : attributes_ )
+            {
+                it.second->permute_elements( permutation, key );
+            }
+        }
+
         index_t nb_elements() const
         {
             return nb_elements_;
         }
 
+        MemoryUsage memory_usage() const
+        {
+            MemoryUsage usage{ "AttributeManager",
+                sizeof( AttributeManager ) + sizeof( Impl )
+                    + AttributeHeapMemory< absl::flat_hash_map< std::string,
+                        std::shared_ptr< AttributeBase > > >::size(
+                        attributes_ ) };
+            for( const auto &attribute : attributes_ )
+            {
+                usage.add_child(
+                    attribute.first, attribute.second->memory_usage() );
+            }
+            return usage;
+        }
+
         void copy( const AttributeManager::Impl &attribute_manager,
             AttributeBase::AttributeKey key )
         {
@@ -210,7 +285,7 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, Impl >{},
                 []( Archive &archive, Impl &impl ) {
-                    archive.value4b( impl.nb_elements_ );
+                    serialize_index( archive, impl.nb_elements_ );
                     archive.ext( impl.attributes_,
                         bitsery::ext::StdMap{ impl.attributes_.max_size() },
                         []( Archive &archive, std::string &name,
@@ -269,6 +344,48 @@ namespace geode
         impl_->interpolate_attribute_value( interpolation, to_element, {} );
     }
 
+    void AttributeManager::assign_attribute_values(
+        absl::Span< const index_t > from_elements,
+        absl::Span< const index_t > to_elements )
+    {
+        OPENGEODE_EXCEPTION( from_elements.size() == to_elements.size(),
+            "[AttributeManager::assign_attribute_values] Both arrays should "
+            "have the same size" );
+        const auto nb = nb_elements();
+        const auto in_range = [nb]( index_t element ) {
+            return element < nb;
+        };
+        OPENGEODE_EXCEPTION(
+            std::all_of( from_elements.begin(), from_elements.end(), in_range )
+                && std::all_of(
+                    to_elements.begin(), to_elements.end(), in_range ),
+            "[AttributeManager::assign_attribute_values] Elements should be "
+            "smaller than the number of elements (",
+            nb, ")" );
+        impl_->assign_attribute_values( from_elements, to_elements, {} );
+    }
+
+    void AttributeManager::interpolate_attribute_values(
+        const AttributeLinearInterpolations &interpolations )
+    {
+        const auto nb = nb_elements();
+        for( const auto i : Range{ interpolations.nb_interpolations() } )
+        {
+            const auto indices = interpolations.indices( i );
+            OPENGEODE_EXCEPTION( interpolations.target( i ) < nb
+                                     && std::all_of( indices.begin(),
+                                         indices.end(),
+                                         [nb]( index_t element ) {
+                                             return element < nb;
+                                         } ),
+                "[AttributeManager::interpolate_attribute_values] Elements of "
+                "interpolation ",
+                i, " should be smaller than the number of elements (", nb,
+                ")" );
+        }
+        impl_->interpolate_attribute_values( interpolations, {} );
+    }
+
     absl::FixedArray< absl::string_view >
         AttributeManager::attribute_names() const
     {
@@ -314,11 +431,26 @@ namespace geode
         }
     }
 
+    void AttributeManager::permute_elements(
+        absl::Span< const index_t > permutation )
+    {
+        OPENGEODE_EXCEPTION( permutation.size() == nb_elements(),
+            "[AttributeManager::permute_elements] Permutation should "
+            "have the same size as the number of elements" );
+        detail::check_permutation( permutation );
+        impl_->permute_elements( permutation, {} );
+    }
+
     index_t AttributeManager::nb_elements() const
     {
         return impl_->nb_elements();
     }
 
+    MemoryUsage AttributeManager::memory_usage() const
+    {
+        return impl_->memory_usage();
+    }
+
     void AttributeManager::copy( const AttributeManager &attribute_manager )
     {
         impl_->copy( *attribute_manager.impl_, {} );
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/memory_usage.h>
+
+#include <absl/strings/str_cat.h>
+
+namespace
+{
+    void flatten_usage( const geode::MemoryUsage& usage,
+        const std::string& path,
+        std::vector< std::pair< std::string, size_t > >& result )
+    {
+        result.emplace_back( path, usage.total() );
+        for( const auto& child : usage.children )
+        {
+            flatten_usage(
+                child, absl::StrCat( path, "/", child.name ), result );
+        }
+    }
+
+    void print_usage( const geode::MemoryUsage& usage,
+        const std::string& indent,
+        std::string& result )
+    {
+        absl::StrAppend(
+            &result, indent, usage.name, ": ", usage.total(), " bytes\n" );
+        for( const auto& child : usage.children )
+        {
+            print_usage( child, absl::StrCat( indent, "  " ), result );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    MemoryUsage::MemoryUsage( std::string name_in, size_t bytes_in )
+        : name( std::move( name_in ) ), bytes( bytes_in )
+    {
+    }
+
+    MemoryUsage& MemoryUsage::add_child(
+        std::string child_name, MemoryUsage child )
+    {
+        child.name = std::move( child_name );
+        children.emplace_back( std::move( child ) );
+        return children.back();
+    }
+
+    MemoryUsage& MemoryUsage::add_child(
+        std::string child_name, size_t child_bytes )
+    {
+        children.emplace_back( std::move( child_name ), child_bytes );
+        return children.back();
+    }
+
+    size_t MemoryUsage::total() const
+    {
+        auto result = bytes;
+        for( const auto& child : children )
+        {
+            result += child.total();
+        }
+        return result;
+    }
+
+    std::vector< std::pair< std::string, size_t > > MemoryUsage::flatten()
+        const
+    {
+        std::vector< std::pair< std::string, size_t > > result;
+        flatten_usage( *this, name, result );
+        return result;
+    }
+
+    std::string MemoryUsage::string() const
+    {
+        std::string result;
+        print_usage( *this, "", result );
+        return result;
+    }
+} // namespace geode
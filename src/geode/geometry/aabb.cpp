@@ -29,10 +29,14 @@
 
 #include <geode/geometry/aabb.h>
 
+#include <geode/basic/attribute.h>
+
+#include <geode/geometry/bitsery_archive.h>
 #include <geode/geometry/point.h>
 #include <geode/geometry/vector.h>
 
 #include <algorithm>
+#include <fstream>
 #include <numeric>
 
 namespace
@@ -181,6 +185,62 @@ namespace
             bboxes, mapping_morton.begin(), mapping_morton.end() );
         return mapping_morton;
     }
+
+    /*!
+     * Write or read the tree nodes as one contiguous block of min/max corners.
+     * Empty nodes (unused slots of the flat layout) keep their inverted
+     * corners and are restored as empty boxes.
+     */
+    template < typename Archive >
+    struct NodesSerializer;
+
+    template < typename Adapter, typename Context >
+    struct NodesSerializer< bitsery::Serializer< Adapter, Context > >
+    {
+        template < geode::index_t dimension >
+        static void process( bitsery::Serializer< Adapter, Context >& archive,
+            std::vector< geode::BoundingBox< dimension > >& nodes )
+        {
+            std::vector< geode::Point< dimension > > corners;
+            corners.reserve( 2 * nodes.size() );
+            for( const auto& node : nodes )
+            {
+                corners.push_back( node.min() );
+                corners.push_back( node.max() );
+            }
+            geode::detail::BulkValuesSerializer<
+                bitsery::Serializer< Adapter, Context > >::process( archive,
+                corners );
+        }
+    };
+
+    template < typename Adapter, typename Context >
+    struct NodesSerializer< bitsery::Deserializer< Adapter, Context > >
+    {
+        template < geode::index_t dimension >
+        static void process( bitsery::Deserializer< Adapter, Context >& archive,
+            std::vector< geode::BoundingBox< dimension > >& nodes )
+        {
+            std::vector< geode::Point< dimension > > corners;
+            geode::detail::BulkValuesSerializer<
+                bitsery::Deserializer< Adapter, Context > >::process( archive,
+                corners );
+            OPENGEODE_EXCEPTION( corners.size() % 2 == 0,
+                "[AABBTree::load] Wrong number of box corners" );
+            nodes.clear();
+            nodes.resize( corners.size() / 2 );
+            for( const auto n : geode::Range{ nodes.size() } )
+            {
+                const auto& min = corners[2 * n];
+                const auto& max = corners[2 * n + 1];
+                if( min.value( 0 ) <= max.value( 0 ) )
+                {
+                    nodes[n].add_point( min );
+                    nodes[n].add_point( max );
+                }
+            }
+        }
+    };
 } // namespace
 
 namespace geode
@@ -189,12 +249,43 @@ namespace geode
     AABBTree< dimension >::Impl::Impl(
         absl::Span< const BoundingBox< dimension > > bboxes )
     {
+        checksum_ = compute_checksum( bboxes );
+        if( bboxes.empty() )
+        {
+            return;
+        }
         mapping_morton_ = morton_sort( bboxes );
         const auto nb_bboxes = static_cast< index_t >( bboxes.size() );
         tree_.resize( max_node_index( ROOT_INDEX, 0, nb_bboxes ) + ROOT_INDEX );
         initialize_tree_recursive( bboxes, ROOT_INDEX, 0, nb_bboxes );
     }
 
+    template < index_t dimension >
+    template < typename Archive >
+    void AABBTree< dimension >::Impl::serialize( Archive& archive )
+    {
+        archive.ext( *this, DefaultGrowable< Archive, Impl >{},
+            []( Archive& archive, Impl& impl ) {
+                archive.value8b( impl.checksum_ );
+                detail::BulkValuesSerializer< Archive >::process(
+                    archive, impl.mapping_morton_ );
+                NodesSerializer< Archive >::process( archive, impl.tree_ );
+                const auto nb_bboxes = impl.nb_bboxes();
+                const auto nb_nodes =
+                    nb_bboxes == 0
+                        ? 0
+                        : impl.max_node_index( ROOT_INDEX, 0, nb_bboxes )
+                              + ROOT_INDEX;
+                OPENGEODE_EXCEPTION( impl.tree_.size() == nb_nodes,
+                    "[AABBTree::serialize] Wrong number of tree nodes" );
+                for( const auto box : impl.mapping_morton_ )
+                {
+                    OPENGEODE_EXCEPTION( box < nb_bboxes,
+                        "[AABBTree::serialize] Wrong box index" );
+                }
+            } );
+    }
+
     template < index_t dimension >
     AABBTree< dimension >::AABBTree(
         absl::Span< const BoundingBox< dimension > > bboxes )
@@ -202,6 +293,29 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    AABBTree< dimension >::AABBTree() // NOLINT
+    {
+    }
+
+    template < index_t dimension >
+    bool AABBTree< dimension >::is_built_from(
+        absl::Span< const BoundingBox< dimension > > bboxes ) const
+    {
+        return bboxes.size() == nb_bboxes()
+               && Impl::compute_checksum( bboxes ) == impl_->checksum();
+    }
+
+    template < index_t dimension >
+    template < typename Archive >
+    void AABBTree< dimension >::serialize( Archive& archive )
+    {
+        archive.ext( *this, DefaultGrowable< Archive, AABBTree >{},
+            []( Archive& archive, AABBTree& tree ) {
+                archive.object( tree.impl_ );
+            } );
+    }
+
     template < index_t dimension >
     AABBTree< dimension >::~AABBTree() // NOLINT
     {
@@ -294,11 +408,83 @@ namespace geode
         return result.length();
     }
 
+    template < index_t dimension >
+    void save_aabb_tree(
+        const AABBTree< dimension >& tree, std::ostream& stream )
+    {
+        TContext context{};
+        register_basic_serialize_pcontext( std::get< 0 >( context ) );
+        register_geometry_serialize_pcontext( std::get< 0 >( context ) );
+        Serializer archive{ context, stream };
+        archive.object( tree );
+        archive.adapter().flush();
+        OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
+            "[save_aabb_tree] Error while writing AABBTree" );
+    }
+
+    template < index_t dimension >
+    void save_aabb_tree(
+        const AABBTree< dimension >& tree, absl::string_view filename )
+    {
+        std::ofstream file{ std::string{ filename }, std::ofstream::binary };
+        OPENGEODE_EXCEPTION(
+            file.good(), "[save_aabb_tree] Cannot create file: ", filename );
+        save_aabb_tree( tree, file );
+    }
+
+    template < index_t dimension >
+    AABBTree< dimension > load_aabb_tree( std::istream& stream )
+    {
+        AABBTree< dimension > tree;
+        TContext context{};
+        register_basic_deserialize_pcontext( std::get< 0 >( context ) );
+        register_geometry_deserialize_pcontext( std::get< 0 >( context ) );
+        Deserializer archive{ context, stream };
+        archive.object( tree );
+        const auto& adapter = archive.adapter();
+        OPENGEODE_EXCEPTION( adapter.error() == bitsery::ReaderError::NoError
+                                 && std::get< 1 >( context ).isValid(),
+            "[load_aabb_tree] Error while reading AABBTree" );
+        return tree;
+    }
+
+    template < index_t dimension >
+    AABBTree< dimension > load_aabb_tree( absl::string_view filename )
+    {
+        std::ifstream file{ std::string{ filename }, std::ifstream::binary };
+        OPENGEODE_EXCEPTION(
+            file.good(), "[load_aabb_tree] Cannot open file: ", filename );
+        auto tree = load_aabb_tree< dimension >( file );
+        OPENGEODE_EXCEPTION(
+            file.peek() == std::ifstream::traits_type::eof(),
+            "[load_aabb_tree] Unexpected data at the end of file: ",
+            filename );
+        return tree;
+    }
+
     template double opengeode_geometry_api point_box_signed_distance(
         const Point2D&, const BoundingBox2D& );
     template class opengeode_geometry_api AABBTree< 2 >;
+    SERIALIZE_BITSERY_ARCHIVE( opengeode_geometry_api, AABBTree< 2 > );
+    template void opengeode_geometry_api save_aabb_tree(
+        const AABBTree< 2 >&, std::ostream& );
+    template void opengeode_geometry_api save_aabb_tree(
+        const AABBTree< 2 >&, absl::string_view );
+    template AABBTree< 2 > opengeode_geometry_api load_aabb_tree(
+        std::istream& );
+    template AABBTree< 2 > opengeode_geometry_api load_aabb_tree(
+        absl::string_view );
 
     template double opengeode_geometry_api point_box_signed_distance(
         const Point3D&, const BoundingBox3D& );
     template class opengeode_geometry_api AABBTree< 3 >;
+    SERIALIZE_BITSERY_ARCHIVE( opengeode_geometry_api, AABBTree< 3 > );
+    template void opengeode_geometry_api save_aabb_tree(
+        const AABBTree< 3 >&, std::ostream& );
+    template void opengeode_geometry_api save_aabb_tree(
+        const AABBTree< 3 >&, absl::string_view );
+    template AABBTree< 3 > opengeode_geometry_api load_aabb_tree(
+        std::istream& );
+    template AABBTree< 3 > opengeode_geometry_api load_aabb_tree(
+        absl::string_view );
 } // namespace geode
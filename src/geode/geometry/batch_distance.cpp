@@ -0,0 +1,659 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/batch_distance.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined( __AVX__ )
+#    include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#    include <emmintrin.h>
+#endif
+
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/point.h>
+
+namespace
+{
+    /*
+     * Minimal portable SIMD abstraction. Kernels are written once for a
+     * value type V providing the arithmetic and comparison operators, and
+     * the functions broadcast, vmin, vmax, select, mask_and and vsqrt.
+     * Each Lanes type loads and stores nb_lanes consecutive values:
+     * - ScalarLanes (double) is the fallback, also used for batch tails,
+     * - Sse2Lanes holds 2 doubles, AvxLanes 4 doubles, when the target
+     * instruction set provides them.
+     * Conditions are evaluated as masks and selects, so all lanes follow the
+     * same path.
+     */
+    template < typename V >
+    V broadcast( double value );
+
+    template <>
+    inline double broadcast< double >( double value )
+    {
+        return value;
+    }
+
+    inline double vmin( double v0, double v1 )
+    {
+        return std::min( v0, v1 );
+    }
+
+    inline double vmax( double v0, double v1 )
+    {
+        return std::max( v0, v1 );
+    }
+
+    inline bool mask_and( bool m0, bool m1 )
+    {
+        return m0 && m1;
+    }
+
+    inline double select( bool mask, double v0, double v1 )
+    {
+        return mask ? v0 : v1;
+    }
+
+    inline double vsqrt( double value )
+    {
+        return std::sqrt( value );
+    }
+
+    struct ScalarLanes
+    {
+        using Value = double;
+        static constexpr geode::index_t nb_lanes = 1;
+
+        static Value load( const double* values )
+        {
+            return *values;
+        }
+
+        template < geode::index_t dimension >
+        static Value load( const geode::Point< dimension >* points,
+            geode::index_t axis )
+        {
+            return points->value( axis );
+        }
+
+        static void store( double* values, Value value )
+        {
+            *values = value;
+        }
+    };
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+    struct Sse2Value
+    {
+        __m128d v;
+    };
+
+    struct Sse2Mask
+    {
+        __m128d m;
+    };
+
+    template <>
+    inline Sse2Value broadcast< Sse2Value >( double value )
+    {
+        return { _mm_set1_pd( value ) };
+    }
+
+    inline Sse2Value operator+( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_add_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Value operator-( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_sub_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Value operator*( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_mul_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Value operator/( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_div_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Mask operator>( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_cmpgt_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Mask operator>=( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_cmpge_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Mask operator<=( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_cmple_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Value vmin( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_min_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Value vmax( Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_max_pd( v0.v, v1.v ) };
+    }
+
+    inline Sse2Mask mask_and( Sse2Mask m0, Sse2Mask m1 )
+    {
+        return { _mm_and_pd( m0.m, m1.m ) };
+    }
+
+    inline Sse2Value select( Sse2Mask mask, Sse2Value v0, Sse2Value v1 )
+    {
+        return { _mm_or_pd(
+            _mm_and_pd( mask.m, v0.v ), _mm_andnot_pd( mask.m, v1.v ) ) };
+    }
+
+    inline Sse2Value vsqrt( Sse2Value value )
+    {
+        return { _mm_sqrt_pd( value.v ) };
+    }
+
+    struct Sse2Lanes
+    {
+        using Value = Sse2Value;
+        static constexpr geode::index_t nb_lanes = 2;
+
+        static Value load( const double* values )
+        {
+            return { _mm_loadu_pd( values ) };
+        }
+
+        template < geode::index_t dimension >
+        static Value load( const geode::Point< dimension >* points,
+            geode::index_t axis )
+        {
+            return { _mm_set_pd(
+                points[1].value( axis ), points[0].value( axis ) ) };
+        }
+
+        static void store( double* values, Value value )
+        {
+            _mm_storeu_pd( values, value.v );
+        }
+    };
+#endif
+
+#if defined( __AVX__ )
+    struct AvxValue
+    {
+        __m256d v;
+    };
+
+    struct AvxMask
+    {
+        __m256d m;
+    };
+
+    template <>
+    inline AvxValue broadcast< AvxValue >( double value )
+    {
+        return { _mm256_set1_pd( value ) };
+    }
+
+    inline AvxValue operator+( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_add_pd( v0.v, v1.v ) };
+    }
+
+    inline AvxValue operator-( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_sub_pd( v0.v, v1.v ) };
+    }
+
+    inline AvxValue operator*( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_mul_pd( v0.v, v1.v ) };
+    }
+
+    inline AvxValue operator/( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_div_pd( v0.v, v1.v ) };
+    }
+
+    inline AvxMask operator>( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_cmp_pd( v0.v, v1.v, _CMP_GT_OQ ) };
+    }
+
+    inline AvxMask operator>=( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_cmp_pd( v0.v, v1.v, _CMP_GE_OQ ) };
+    }
+
+    inline AvxMask operator<=( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_cmp_pd( v0.v, v1.v, _CMP_LE_OQ ) };
+    }
+
+    inline AvxValue vmin( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_min_pd( v0.v, v1.v ) };
+    }
+
+    inline AvxValue vmax( AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_max_pd( v0.v, v1.v ) };
+    }
+
+    inline AvxMask mask_and( AvxMask m0, AvxMask m1 )
+    {
+        return { _mm256_and_pd( m0.m, m1.m ) };
+    }
+
+    inline AvxValue select( AvxMask mask, AvxValue v0, AvxValue v1 )
+    {
+        return { _mm256_blendv_pd( v1.v, v0.v, mask.m ) };
+    }
+
+    inline AvxValue vsqrt( AvxValue value )
+    {
+        return { _mm256_sqrt_pd( value.v ) };
+    }
+
+    struct AvxLanes
+    {
+        using Value = AvxValue;
+        static constexpr geode::index_t nb_lanes = 4;
+
+        static Value load( const double* values )
+        {
+            return { _mm256_loadu_pd( values ) };
+        }
+
+        template < geode::index_t dimension >
+        static Value load( const geode::Point< dimension >* points,
+            geode::index_t axis )
+        {
+            return { _mm256_set_pd( points[3].value( axis ),
+                points[2].value( axis ), points[1].value( axis ),
+                points[0].value( axis ) ) };
+        }
+
+        static void store( double* values, Value value )
+        {
+            _mm256_storeu_pd( values, value.v );
+        }
+    };
+
+    using Lanes = AvxLanes;
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+    using Lanes = Sse2Lanes;
+#else
+    using Lanes = ScalarLanes;
+#endif
+
+    constexpr double MIN_LENGTH2 = std::numeric_limits< double >::min();
+
+    template < typename V, size_t dimension >
+    using Coordinates = std::array< V, dimension >;
+
+    template < typename V, size_t dimension >
+    inline V dot( const Coordinates< V, dimension >& v0,
+        const Coordinates< V, dimension >& v1 )
+    {
+        auto result = v0[0] * v1[0];
+        for( const auto d : geode::Range{ 1, dimension } )
+        {
+            result = result + v0[d] * v1[d];
+        }
+        return result;
+    }
+
+    template < typename V, size_t dimension >
+    inline Coordinates< V, dimension > difference(
+        const Coordinates< V, dimension >& v0,
+        const Coordinates< V, dimension >& v1 )
+    {
+        Coordinates< V, dimension > result;
+        for( const auto d : geode::Range{ dimension } )
+        {
+            result[d] = v0[d] - v1[d];
+        }
+        return result;
+    }
+
+    template < typename V, size_t dimension >
+    inline V segment_squared_distance( const Coordinates< V, dimension >& point,
+        const Coordinates< V, dimension >& v0,
+        const Coordinates< V, dimension >& v1 )
+    {
+        const auto zero = broadcast< V >( 0 );
+        const auto one = broadcast< V >( 1 );
+        const auto edge = difference( v1, v0 );
+        const auto diff = difference( point, v0 );
+        const auto length2 =
+            vmax( dot( edge, edge ), broadcast< V >( MIN_LENGTH2 ) );
+        const auto parameter =
+            vmin( vmax( dot( diff, edge ) / length2, zero ), one );
+        auto result = zero;
+        for( const auto d : geode::Range{ dimension } )
+        {
+            const auto delta = diff[d] - parameter * edge[d];
+            result = result + delta * delta;
+        }
+        return result;
+    }
+
+    template < typename V, size_t dimension >
+    inline V triangle_squared_distance(
+        const Coordinates< V, dimension >& point,
+        const Coordinates< V, dimension >& v0,
+        const Coordinates< V, dimension >& v1,
+        const Coordinates< V, dimension >& v2 )
+    {
+        const auto zero = broadcast< V >( 0 );
+        const auto two = broadcast< V >( 2 );
+        const auto diff = difference( v0, point );
+        const auto edge0 = difference( v1, v0 );
+        const auto edge1 = difference( v2, v0 );
+        const auto a00 = dot( edge0, edge0 );
+        const auto a01 = dot( edge0, edge1 );
+        const auto a11 = dot( edge1, edge1 );
+        const auto b0 = dot( diff, edge0 );
+        const auto b1 = dot( diff, edge1 );
+        const auto c = dot( diff, diff );
+        const auto det = a00 * a11 - a01 * a01;
+        const auto s = a01 * b1 - a11 * b0;
+        const auto t = a01 * b0 - a00 * b1;
+        const auto inside = mask_and( mask_and( det > zero, s >= zero ),
+            mask_and( t >= zero, s + t <= det ) );
+
+        // Projection onto the triangle plane, used when it lies inside
+        const auto inv_det =
+            broadcast< V >( 1 ) / vmax( det, broadcast< V >( MIN_LENGTH2 ) );
+        const auto ss = s * inv_det;
+        const auto tt = t * inv_det;
+        const auto plane =
+            vmax( ss * ( a00 * ss + a01 * tt + two * b0 )
+                      + tt * ( a01 * ss + a11 * tt + two * b1 ) + c,
+                zero );
+
+        const auto edge01 = segment_squared_distance( point, v0, v1 );
+        const auto edge12 = segment_squared_distance( point, v1, v2 );
+        const auto edge20 = segment_squared_distance( point, v2, v0 );
+        const auto edges = vmin( vmin( edge01, edge12 ), edge20 );
+        return select( inside, plane, edges );
+    }
+
+    template < typename L, geode::index_t dimension >
+    Coordinates< typename L::Value, dimension > broadcast_point(
+        const geode::Point< dimension >& point )
+    {
+        Coordinates< typename L::Value, dimension > result;
+        for( const auto d : geode::Range{ dimension } )
+        {
+            result[d] = broadcast< typename L::Value >( point.value( d ) );
+        }
+        return result;
+    }
+
+    template < typename L, geode::index_t dimension >
+    Coordinates< typename L::Value, dimension > load_points(
+        const geode::Point< dimension >* points )
+    {
+        Coordinates< typename L::Value, dimension > result;
+        for( const auto d : geode::Range{ dimension } )
+        {
+            result[d] = L::load( points, d );
+        }
+        return result;
+    }
+
+    template < typename L,
+        geode::index_t dimension,
+        geode::index_t nb_vertices >
+    Coordinates< typename L::Value, dimension > load_batch_vertex(
+        const geode::SimplexBatch< dimension, nb_vertices >& batch,
+        geode::index_t vertex,
+        geode::index_t element )
+    {
+        Coordinates< typename L::Value, dimension > result;
+        for( const auto d : geode::Range{ dimension } )
+        {
+            result[d] = L::load( batch.coordinates( vertex, d ) + element );
+        }
+        return result;
+    }
+
+    /*
+     * The batch drivers below process the elements [begin, end) by groups of
+     * L::nb_lanes, and return the first element that was not processed.
+     * They are called with Lanes first, then with ScalarLanes on the tail.
+     */
+    template < typename L, geode::index_t dimension >
+    geode::index_t point_segments_lanes( const geode::Point< dimension >& point,
+        const geode::SegmentBatch< dimension >& segments,
+        geode::index_t begin,
+        double* output )
+    {
+        const auto query = broadcast_point< L >( point );
+        auto s = begin;
+        for( ; s + L::nb_lanes <= segments.size(); s += L::nb_lanes )
+        {
+            L::store( output + s,
+                vsqrt( segment_squared_distance( query,
+                    load_batch_vertex< L >( segments, 0, s ),
+                    load_batch_vertex< L >( segments, 1, s ) ) ) );
+        }
+        return s;
+    }
+
+    template < typename L, geode::index_t dimension >
+    geode::index_t point_triangles_lanes(
+        const geode::Point< dimension >& point,
+        const geode::TriangleBatch< dimension >& triangles,
+        geode::index_t begin,
+        double* output )
+    {
+        const auto query = broadcast_point< L >( point );
+        auto t = begin;
+        for( ; t + L::nb_lanes <= triangles.size(); t += L::nb_lanes )
+        {
+            L::store( output + t,
+                vsqrt( triangle_squared_distance( query,
+                    load_batch_vertex< L >( triangles, 0, t ),
+                    load_batch_vertex< L >( triangles, 1, t ),
+                    load_batch_vertex< L >( triangles, 2, t ) ) ) );
+        }
+        return t;
+    }
+
+    template < typename L, geode::index_t dimension >
+    geode::index_t points_segment_lanes(
+        absl::Span< const geode::Point< dimension > > points,
+        const geode::Segment< dimension >& segment,
+        geode::index_t begin,
+        double* output )
+    {
+        const auto v0 = broadcast_point< L >( segment.vertices()[0].get() );
+        const auto v1 = broadcast_point< L >( segment.vertices()[1].get() );
+        const auto nb_points = static_cast< geode::index_t >( points.size() );
+        auto p = begin;
+        for( ; p + L::nb_lanes <= nb_points; p += L::nb_lanes )
+        {
+            L::store( output + p,
+                vsqrt( segment_squared_distance(
+                    load_points< L >( &points[p] ), v0, v1 ) ) );
+        }
+        return p;
+    }
+
+    template < typename L, geode::index_t dimension >
+    geode::index_t points_triangle_lanes(
+        absl::Span< const geode::Point< dimension > > points,
+        const geode::Triangle< dimension >& triangle,
+        geode::index_t begin,
+        double* output )
+    {
+        const auto v0 = broadcast_point< L >( triangle.vertices()[0].get() );
+        const auto v1 = broadcast_point< L >( triangle.vertices()[1].get() );
+        const auto v2 = broadcast_point< L >( triangle.vertices()[2].get() );
+        const auto nb_points = static_cast< geode::index_t >( points.size() );
+        auto p = begin;
+        for( ; p + L::nb_lanes <= nb_points; p += L::nb_lanes )
+        {
+            L::store( output + p,
+                vsqrt( triangle_squared_distance(
+                    load_points< L >( &points[p] ), v0, v1, v2 ) ) );
+        }
+        return p;
+    }
+
+    std::tuple< geode::index_t, double > closest(
+        absl::Span< const double > distances )
+    {
+        if( distances.empty() )
+        {
+            return std::make_tuple(
+                geode::NO_ID, std::numeric_limits< double >::max() );
+        }
+        const auto it = std::min_element( distances.begin(), distances.end() );
+        return std::make_tuple(
+            static_cast< geode::index_t >( it - distances.begin() ), *it );
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    void point_segments_distances( const Point< dimension >& point,
+        const SegmentBatch< dimension >& segments,
+        absl::Span< double > distances )
+    {
+        OPENGEODE_EXCEPTION( distances.size() >= segments.size(),
+            "[point_segments_distances] Output is too small" );
+        const auto tail = point_segments_lanes< Lanes >(
+            point, segments, 0, distances.data() );
+        point_segments_lanes< ScalarLanes >(
+            point, segments, tail, distances.data() );
+    }
+
+    template < index_t dimension >
+    void points_segment_distances(
+        absl::Span< const Point< dimension > > points,
+        const Segment< dimension >& segment,
+        absl::Span< double > distances )
+    {
+        OPENGEODE_EXCEPTION( distances.size() >= points.size(),
+            "[points_segment_distances] Output is too small" );
+        const auto tail = points_segment_lanes< Lanes >(
+            points, segment, 0, distances.data() );
+        points_segment_lanes< ScalarLanes >(
+            points, segment, tail, distances.data() );
+    }
+
+    template < index_t dimension >
+    std::tuple< index_t, double > point_closest_segment(
+        const Point< dimension >& point,
+        const SegmentBatch< dimension >& segments )
+    {
+        absl::InlinedVector< double, 16 > distances( segments.size() );
+        point_segments_distances(
+            point, segments, absl::MakeSpan( distances ) );
+        return closest( distances );
+    }
+
+    template < index_t dimension >
+    void point_triangles_distances( const Point< dimension >& point,
+        const TriangleBatch< dimension >& triangles,
+        absl::Span< double > distances )
+    {
+        OPENGEODE_EXCEPTION( distances.size() >= triangles.size(),
+            "[point_triangles_distances] Output is too small" );
+        const auto tail = point_triangles_lanes< Lanes >(
+            point, triangles, 0, distances.data() );
+        point_triangles_lanes< ScalarLanes >(
+            point, triangles, tail, distances.data() );
+    }
+
+    template < index_t dimension >
+    void points_triangle_distances(
+        absl::Span< const Point< dimension > > points,
+        const Triangle< dimension >& triangle,
+        absl::Span< double > distances )
+    {
+        OPENGEODE_EXCEPTION( distances.size() >= points.size(),
+            "[points_triangle_distances] Output is too small" );
+        const auto tail = points_triangle_lanes< Lanes >(
+            points, triangle, 0, distances.data() );
+        points_triangle_lanes< ScalarLanes >(
+            points, triangle, tail, distances.data() );
+    }
+
+    template < index_t dimension >
+    std::tuple< index_t, double > point_closest_triangle(
+        const Point< dimension >& point,
+        const TriangleBatch< dimension >& triangles )
+    {
+        absl::InlinedVector< double, 16 > distances( triangles.size() );
+        point_triangles_distances(
+            point, triangles, absl::MakeSpan( distances ) );
+        return closest( distances );
+    }
+    template class opengeode_geometry_api SimplexBatch< 2, 2 >;
+    template class opengeode_geometry_api SimplexBatch< 2, 3 >;
+    template class opengeode_geometry_api SimplexBatch< 3, 2 >;
+    template class opengeode_geometry_api SimplexBatch< 3, 3 >;
+
+    template void opengeode_geometry_api point_segments_distances(
+        const Point2D&, const SegmentBatch2D&, absl::Span< double > );
+    template void opengeode_geometry_api points_segment_distances(
+        absl::Span< const Point2D >, const Segment2D&, absl::Span< double > );
+    template std::tuple< index_t, double > opengeode_geometry_api
+        point_closest_segment( const Point2D&, const SegmentBatch2D& );
+    template void opengeode_geometry_api point_triangles_distances(
+        const Point2D&, const TriangleBatch2D&, absl::Span< double > );
+    template void opengeode_geometry_api points_triangle_distances(
+        absl::Span< const Point2D >, const Triangle2D&, absl::Span< double > );
+    template std::tuple< index_t, double > opengeode_geometry_api
+        point_closest_triangle( const Point2D&, const TriangleBatch2D& );
+
+    template void opengeode_geometry_api point_segments_distances(
+        const Point3D&, const SegmentBatch3D&, absl::Span< double > );
+    template void opengeode_geometry_api points_segment_distances(
+        absl::Span< const Point3D >, const Segment3D&, absl::Span< double > );
+    template std::tuple< index_t, double > opengeode_geometry_api
+        point_closest_segment( const Point3D&, const SegmentBatch3D& );
+    template void opengeode_geometry_api point_triangles_distances(
+        const Point3D&, const TriangleBatch3D&, absl::Span< double > );
+    template void opengeode_geometry_api points_triangle_distances(
+        absl::Span< const Point3D >, const Triangle3D&, absl::Span< double > );
+    template std::tuple< index_t, double > opengeode_geometry_api
+        point_closest_triangle( const Point3D&, const TriangleBatch3D& );
+} // namespace geode
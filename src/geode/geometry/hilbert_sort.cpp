@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/hilbert_sort.h>
+
+#include <algorithm>
+#include <array>
+
+#include <absl/algorithm/container.h>
+
+#include <async++.h>
+
+#include <geode/geometry/point.h>
+
+namespace
+{
+    using itr = std::vector< geode::index_t >::iterator;
+
+    constexpr geode::index_t PARALLEL_THRESHOLD{ 4096 };
+
+    template < geode::index_t dimension >
+    struct HilbertRange
+    {
+        itr begin;
+        itr end;
+        geode::index_t axis;
+        std::array< bool, dimension > up;
+    };
+
+    template < geode::index_t dimension >
+    class HilbertCmp
+    {
+    public:
+        HilbertCmp( absl::Span< const geode::Point< dimension > > points,
+            geode::index_t axis,
+            bool up )
+            : points_( points ), axis_( axis ), up_( up )
+        {
+        }
+
+        bool operator()( geode::index_t point1, geode::index_t point2 ) const
+        {
+            const auto value1 = points_[point1].value( axis_ );
+            const auto value2 = points_[point2].value( axis_ );
+            return up_ ? value1 < value2 : value2 < value1;
+        }
+
+    private:
+        absl::Span< const geode::Point< dimension > > points_;
+        geode::index_t axis_;
+        bool up_;
+    };
+    ALIAS_2D_AND_3D( HilbertCmp );
+
+    /*!
+     * Partitions [begin, end) into two halves of the same size such that
+     * the elements of the first half are smaller than the ones of the second.
+     * @return the iterator separating the two halves
+     */
+    template < geode::index_t dimension >
+    itr split( itr begin, itr end, const HilbertCmp< dimension >& cmp )
+    {
+        if( begin >= end )
+        {
+            return begin;
+        }
+        const auto middle = begin + ( end - begin ) / 2;
+        std::nth_element( begin, middle, end, cmp );
+        return middle;
+    }
+
+    std::array< HilbertRange< 2 >, 4 > split_range(
+        absl::Span< const geode::Point2D > points,
+        const HilbertRange< 2 >& range )
+    {
+        const auto x = range.axis;
+        const auto y = ( x + 1 ) % 2;
+        const auto& up = range.up;
+        const auto m0 = range.begin;
+        const auto m4 = range.end;
+        const auto m2 = split( m0, m4, HilbertCmp2D{ points, x, up[x] } );
+        const auto m1 = split( m0, m2, HilbertCmp2D{ points, y, up[y] } );
+        const auto m3 = split( m2, m4, HilbertCmp2D{ points, y, !up[y] } );
+        const std::array< bool, 2 > flipped{ { !up[0], !up[1] } };
+        return { { { m0, m1, y, up }, { m1, m2, x, up }, { m2, m3, x, up },
+            { m3, m4, y, flipped } } };
+    }
+
+    std::array< HilbertRange< 3 >, 8 > split_range(
+        absl::Span< const geode::Point3D > points,
+        const HilbertRange< 3 >& range )
+    {
+        const auto x = range.axis;
+        const auto y = ( x + 1 ) % 3;
+        const auto z = ( x + 2 ) % 3;
+        const auto& up = range.up;
+        const auto m0 = range.begin;
+        const auto m8 = range.end;
+        const auto m4 = split( m0, m8, HilbertCmp3D{ points, x, up[x] } );
+        const auto m2 = split( m0, m4, HilbertCmp3D{ points, y, up[y] } );
+        const auto m1 = split( m0, m2, HilbertCmp3D{ points, z, up[z] } );
+        const auto m3 = split( m2, m4, HilbertCmp3D{ points, z, !up[z] } );
+        const auto m6 = split( m4, m8, HilbertCmp3D{ points, y, !up[y] } );
+        const auto m5 = split( m4, m6, HilbertCmp3D{ points, z, up[z] } );
+        const auto m7 = split( m6, m8, HilbertCmp3D{ points, z, !up[z] } );
+        auto flipped_yz = up;
+        flipped_yz[y] = !flipped_yz[y];
+        flipped_yz[z] = !flipped_yz[z];
+        auto flipped_xy = up;
+        flipped_xy[x] = !flipped_xy[x];
+        flipped_xy[y] = !flipped_xy[y];
+        auto flipped_xz = up;
+        flipped_xz[x] = !flipped_xz[x];
+        flipped_xz[z] = !flipped_xz[z];
+        return { { { m0, m1, z, up }, { m1, m2, y, up }, { m2, m3, y, up },
+            { m3, m4, x, flipped_yz }, { m4, m5, x, flipped_yz },
+            { m5, m6, y, flipped_xy }, { m6, m7, y, flipped_xy },
+            { m7, m8, z, flipped_xz } } };
+    }
+
+    template < geode::index_t dimension >
+    void hilbert_sort_range(
+        absl::Span< const geode::Point< dimension > > points,
+        const HilbertRange< dimension >& range )
+    {
+        const auto nb_elements =
+            static_cast< geode::index_t >( range.end - range.begin );
+        if( nb_elements <= 1 )
+        {
+            return;
+        }
+        const auto sub_ranges = split_range( points, range );
+        if( nb_elements < PARALLEL_THRESHOLD )
+        {
+            for( const auto& sub_range : sub_ranges )
+            {
+                hilbert_sort_range( points, sub_range );
+            }
+            return;
+        }
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 },
+                static_cast< geode::index_t >( sub_ranges.size() ) ),
+            [&points, &sub_ranges]( geode::index_t r ) {
+                hilbert_sort_range( points, sub_ranges[r] );
+            } );
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    std::vector< index_t > hilbert_sort(
+        absl::Span< const Point< dimension > > points )
+    {
+        std::vector< index_t > sorted( points.size() );
+        absl::c_iota( sorted, 0 );
+        std::array< bool, dimension > up;
+        up.fill( true );
+        const HilbertRange< dimension > range{ sorted.begin(), sorted.end(), 0,
+            up };
+        hilbert_sort_range( points, range );
+        return sorted;
+    }
+
+    template std::vector< index_t > opengeode_geometry_api hilbert_sort(
+        absl::Span< const Point2D > );
+
+    template std::vector< index_t > opengeode_geometry_api hilbert_sort(
+        absl::Span< const Point3D > );
+} // namespace geode
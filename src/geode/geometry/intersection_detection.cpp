@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/intersection_detection.h>
+
+#include <algorithm>
+
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/predicates.h>
+
+namespace
+{
+    bool opposite( geode::Side side0, geode::Side side1 )
+    {
+        return ( side0 == geode::Side::positive
+                   && side1 == geode::Side::negative )
+               || ( side0 == geode::Side::negative
+                    && side1 == geode::Side::positive );
+    }
+
+    bool strictly_same_side( geode::Side side0,
+        geode::Side side1,
+        geode::Side side2 )
+    {
+        return side0 != geode::Side::zero && side0 == side1 && side1 == side2;
+    }
+
+    geode::Point2D project( const geode::Point3D& point, geode::index_t axis )
+    {
+        return { { point.value( ( axis + 1 ) % 3 ),
+            point.value( ( axis + 2 ) % 3 ) } };
+    }
+
+    /*!
+     * Find an axis along which the triangle projection is not degenerate.
+     * @return NO_ID if the triangle is degenerate
+     */
+    geode::index_t projection_axis( const geode::Point3D& a,
+        const geode::Point3D& b,
+        const geode::Point3D& c )
+    {
+        for( const auto axis : geode::Range{ 3 } )
+        {
+            if( geode::orient2d( project( a, axis ), project( b, axis ),
+                    project( c, axis ) )
+                != geode::Side::zero )
+            {
+                return axis;
+            }
+        }
+        return geode::NO_ID;
+    }
+
+    bool point_in_box_2d( const geode::Point2D& point,
+        const geode::Point2D& a,
+        const geode::Point2D& b )
+    {
+        for( const auto d : geode::Range{ 2 } )
+        {
+            if( point.value( d ) < std::min( a.value( d ), b.value( d ) )
+                || point.value( d ) > std::max( a.value( d ), b.value( d ) ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool segment_segment_intersection_detection_2d( const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c,
+        const geode::Point2D& d )
+    {
+        const auto c_side = geode::orient2d( a, b, c );
+        const auto d_side = geode::orient2d( a, b, d );
+        const auto a_side = geode::orient2d( c, d, a );
+        const auto b_side = geode::orient2d( c, d, b );
+        if( opposite( c_side, d_side ) && opposite( a_side, b_side ) )
+        {
+            return true;
+        }
+        return ( c_side == geode::Side::zero && point_in_box_2d( c, a, b ) )
+               || ( d_side == geode::Side::zero && point_in_box_2d( d, a, b ) )
+               || ( a_side == geode::Side::zero && point_in_box_2d( a, c, d ) )
+               || ( b_side == geode::Side::zero
+                    && point_in_box_2d( b, c, d ) );
+    }
+
+    bool point_triangle_intersection_detection_2d( const geode::Point2D& point,
+        const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c )
+    {
+        const auto side_ab = geode::orient2d( a, b, point );
+        const auto side_bc = geode::orient2d( b, c, point );
+        const auto side_ca = geode::orient2d( c, a, point );
+        return !opposite( side_ab, side_bc ) && !opposite( side_bc, side_ca )
+               && !opposite( side_ca, side_ab );
+    }
+
+    bool segment_triangle_intersection_detection_2d( const geode::Point2D& s,
+        const geode::Point2D& t,
+        const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c )
+    {
+        return point_triangle_intersection_detection_2d( s, a, b, c )
+               || point_triangle_intersection_detection_2d( t, a, b, c )
+               || segment_segment_intersection_detection_2d( s, t, a, b )
+               || segment_segment_intersection_detection_2d( s, t, b, c )
+               || segment_segment_intersection_detection_2d( s, t, c, a );
+    }
+
+    bool segment_triangle_intersection_detection( const geode::Point3D& s,
+        const geode::Point3D& t,
+        const geode::Point3D& a,
+        const geode::Point3D& b,
+        const geode::Point3D& c,
+        geode::index_t axis )
+    {
+        const auto s_side = geode::orient3d( a, b, c, s );
+        const auto t_side = geode::orient3d( a, b, c, t );
+        if( s_side == t_side && s_side != geode::Side::zero )
+        {
+            return false;
+        }
+        if( s_side == geode::Side::zero && t_side == geode::Side::zero )
+        {
+            return segment_triangle_intersection_detection_2d(
+                project( s, axis ), project( t, axis ), project( a, axis ),
+                project( b, axis ), project( c, axis ) );
+        }
+        // The segment crosses the triangle plane: the intersection point is
+        // in the triangle if the segment line does not strictly pass on
+        // both sides of the triangle edges
+        const auto side_ab = geode::orient3d( s, t, a, b );
+        const auto side_bc = geode::orient3d( s, t, b, c );
+        const auto side_ca = geode::orient3d( s, t, c, a );
+        return !opposite( side_ab, side_bc ) && !opposite( side_bc, side_ca )
+               && !opposite( side_ca, side_ab );
+    }
+} // namespace
+
+namespace geode
+{
+    bool segment_triangle_intersection_detection(
+        const Segment3D& segment, const Triangle3D& triangle )
+    {
+        const auto& a = triangle.vertices()[0].get();
+        const auto& b = triangle.vertices()[1].get();
+        const auto& c = triangle.vertices()[2].get();
+        const auto axis = projection_axis( a, b, c );
+        if( axis == NO_ID )
+        {
+            return false;
+        }
+        return ::segment_triangle_intersection_detection(
+            segment.vertices()[0], segment.vertices()[1], a, b, c, axis );
+    }
+
+    bool triangle_triangle_intersection_detection(
+        const Triangle3D& triangle0, const Triangle3D& triangle1 )
+    {
+        const auto& p0 = triangle0.vertices()[0].get();
+        const auto& p1 = triangle0.vertices()[1].get();
+        const auto& p2 = triangle0.vertices()[2].get();
+        const auto& q0 = triangle1.vertices()[0].get();
+        const auto& q1 = triangle1.vertices()[1].get();
+        const auto& q2 = triangle1.vertices()[2].get();
+        const auto axis0 = projection_axis( p0, p1, p2 );
+        const auto axis1 = projection_axis( q0, q1, q2 );
+        if( axis0 == NO_ID || axis1 == NO_ID )
+        {
+            return false;
+        }
+        const auto q0_side = orient3d( p0, p1, p2, q0 );
+        const auto q1_side = orient3d( p0, p1, p2, q1 );
+        const auto q2_side = orient3d( p0, p1, p2, q2 );
+        if( strictly_same_side( q0_side, q1_side, q2_side ) )
+        {
+            return false;
+        }
+        if( q0_side == Side::zero && q1_side == Side::zero
+            && q2_side == Side::zero )
+        {
+            const auto p0_2d = project( p0, axis0 );
+            const auto p1_2d = project( p1, axis0 );
+            const auto p2_2d = project( p2, axis0 );
+            const auto q0_2d = project( q0, axis0 );
+            const auto q1_2d = project( q1, axis0 );
+            const auto q2_2d = project( q2, axis0 );
+            return segment_triangle_intersection_detection_2d(
+                       p0_2d, p1_2d, q0_2d, q1_2d, q2_2d )
+                   || segment_triangle_intersection_detection_2d(
+                       p1_2d, p2_2d, q0_2d, q1_2d, q2_2d )
+                   || segment_triangle_intersection_detection_2d(
+                       p2_2d, p0_2d, q0_2d, q1_2d, q2_2d )
+                   || point_triangle_intersection_detection_2d(
+                       q0_2d, p0_2d, p1_2d, p2_2d );
+        }
+        if( strictly_same_side( orient3d( q0, q1, q2, p0 ),
+                orient3d( q0, q1, q2, p1 ), orient3d( q0, q1, q2, p2 ) ) )
+        {
+            return false;
+        }
+        // Non coplanar triangles intersect along a segment whose extremities
+        // are on the edges of one of the triangles
+        return ::segment_triangle_intersection_detection(
+                   p0, p1, q0, q1, q2, axis1 )
+               || ::segment_triangle_intersection_detection(
+                   p1, p2, q0, q1, q2, axis1 )
+               || ::segment_triangle_intersection_detection(
+                   p2, p0, q0, q1, q2, axis1 )
+               || ::segment_triangle_intersection_detection(
+                   q0, q1, p0, p1, p2, axis0 )
+               || ::segment_triangle_intersection_detection(
+                   q1, q2, p0, p1, p2, axis0 )
+               || ::segment_triangle_intersection_detection(
+                   q2, q0, p0, p1, p2, axis0 );
+    }
+} // namespace geode
@@ -23,7 +23,9 @@
 
 #include <geode/geometry/nn_search.h>
 
+#include <fstream>
 #include <numeric>
+#include <vector>
 
 #include <absl/algorithm/container.h>
 
@@ -31,18 +33,191 @@
 
 #include <nanoflann.hpp>
 
+#include <geode/basic/attribute.h>
 #include <geode/basic/pimpl_impl.h>
 
+#include <geode/geometry/bitsery_archive.h>
+#include <geode/geometry/detail/geometry_checksum.h>
+
+namespace
+{
+    /*!
+     * Write or read a nanoflann kd-tree as built by buildIndex(): the index
+     * permutation in bulk then the nodes in depth-first order.
+     * Reading allocates the nodes in the tree pool, as nanoflann loadIndex().
+     */
+    template < typename Archive >
+    struct KDTreeSerializer;
+
+    template < typename Adapter, typename Context >
+    struct KDTreeSerializer< bitsery::Serializer< Adapter, Context > >
+    {
+        using Archive = bitsery::Serializer< Adapter, Context >;
+
+        template < typename KDTree >
+        static void process( Archive& archive, KDTree& tree )
+        {
+            const uint64_t leaf_max_size = tree.m_leaf_max_size;
+            archive.value8b( leaf_max_size );
+            for( const auto& interval : tree.root_bbox )
+            {
+                archive.value8b( interval.low );
+                archive.value8b( interval.high );
+            }
+            geode::detail::BulkValuesSerializer< Archive >::process(
+                archive, tree.vind );
+            const bool has_root = tree.root_node != nullptr;
+            archive.value1b( has_root );
+            if( has_root )
+            {
+                process_node( archive, *tree.root_node );
+            }
+        }
+
+    private:
+        template < typename Node >
+        static void process_node( Archive& archive, const Node& node )
+        {
+            const bool is_leaf = node.child1 == nullptr;
+            archive.value1b( is_leaf );
+            if( is_leaf )
+            {
+                auto left = node.node_type.lr.left;
+                auto right = node.node_type.lr.right;
+                geode::serialize_index( archive, left );
+                geode::serialize_index( archive, right );
+                return;
+            }
+            const int32_t divfeat = node.node_type.sub.divfeat;
+            archive.value4b( divfeat );
+            archive.value8b( node.node_type.sub.divlow );
+            archive.value8b( node.node_type.sub.divhigh );
+            process_node( archive, *node.child1 );
+            process_node( archive, *node.child2 );
+        }
+    };
+
+    template < typename Adapter, typename Context >
+    struct KDTreeSerializer< bitsery::Deserializer< Adapter, Context > >
+    {
+        using Archive = bitsery::Deserializer< Adapter, Context >;
+
+        template < typename KDTree >
+        static void process( Archive& archive, KDTree& tree )
+        {
+            tree.freeIndex( tree );
+            uint64_t leaf_max_size{ 0 };
+            archive.value8b( leaf_max_size );
+            tree.m_leaf_max_size = leaf_max_size;
+            for( auto& interval : tree.root_bbox )
+            {
+                archive.value8b( interval.low );
+                archive.value8b( interval.high );
+            }
+            geode::detail::BulkValuesSerializer< Archive >::process(
+                archive, tree.vind );
+            tree.m_size = tree.vind.size();
+            tree.m_size_at_index_build = tree.m_size;
+            bool has_root{ false };
+            archive.value1b( has_root );
+            if( has_root )
+            {
+                tree.root_node = read_node( archive, tree );
+            }
+        }
+
+    private:
+        /*!
+         * Nodes are read with an explicit stack of the children left to
+         * read, so that a corrupted input cannot overflow the call stack.
+         * Each node checks the archive state before being linked, so that a
+         * truncated input stops the reading.
+         */
+        template < typename KDTree >
+        static typename KDTree::Node* read_node(
+            Archive& archive, KDTree& tree )
+        {
+            using Node = typename KDTree::Node;
+            Node* root{ nullptr };
+            std::vector< Node** > to_read{ &root };
+            while( !to_read.empty() )
+            {
+                auto* slot = to_read.back();
+                to_read.pop_back();
+                auto* node = tree.pool.template allocate< Node >();
+                node->child1 = nullptr;
+                node->child2 = nullptr;
+                bool is_leaf{ false };
+                archive.value1b( is_leaf );
+                check_archive( archive );
+                if( is_leaf )
+                {
+                    geode::index_t left;
+                    geode::index_t right;
+                    geode::serialize_index( archive, left );
+                    geode::serialize_index( archive, right );
+                    check_archive( archive );
+                    OPENGEODE_EXCEPTION( left <= right && right <= tree.m_size,
+                        "[NNSearch::load] Wrong kd-tree leaf range" );
+                    node->node_type.lr.left = left;
+                    node->node_type.lr.right = right;
+                    *slot = node;
+                    continue;
+                }
+                int32_t divfeat{ 0 };
+                archive.value4b( divfeat );
+                archive.value8b( node->node_type.sub.divlow );
+                archive.value8b( node->node_type.sub.divhigh );
+                check_archive( archive );
+                OPENGEODE_EXCEPTION( divfeat >= 0 && divfeat < tree.dim,
+                    "[NNSearch::load] Wrong kd-tree split dimension" );
+                node->node_type.sub.divfeat = divfeat;
+                *slot = node;
+                // child1 is stored first: push it last
+                to_read.push_back( &node->child2 );
+                to_read.push_back( &node->child1 );
+            }
+            return root;
+        }
+
+        static void check_archive( Archive& archive )
+        {
+            OPENGEODE_EXCEPTION(
+                archive.adapter().error() == bitsery::ReaderError::NoError,
+                "[NNSearch::load] Truncated or corrupted kd-tree" );
+        }
+    };
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
     class NNSearch< dimension >::Impl
     {
     public:
+        Impl() : nn_tree_{ dimension, cloud_ } {}
+
         explicit Impl( std::vector< Point< dimension > > points )
             : cloud_{ std::move( points ) }, nn_tree_{ dimension, cloud_ }
         {
             nn_tree_.buildIndex();
+            checksum_ = compute_checksum( cloud_.points );
+        }
+
+        static uint64_t compute_checksum(
+            absl::Span< const Point< dimension > > points )
+        {
+            detail::GeometryChecksum checksum;
+            for( const auto& point : points )
+            {
+                checksum.add_point( point );
+            }
+            return checksum.value();
+        }
+
+        uint64_t checksum() const
+        {
+            return checksum_;
         }
 
         const Point< dimension >& point( const index_t index ) const
@@ -83,6 +258,30 @@ namespace geode
         }
 
     private:
+        friend class bitsery::Access;
+        template < typename Archive >
+        void serialize( Archive& archive )
+        {
+            archive.ext( *this, DefaultGrowable< Archive, Impl >{},
+                []( Archive& archive, Impl& impl ) {
+                    archive.value8b( impl.checksum_ );
+                    detail::BulkValuesSerializer< Archive >::process(
+                        archive, impl.cloud_.points );
+                    KDTreeSerializer< Archive >::process(
+                        archive, impl.nn_tree_ );
+                    const auto nb_points = impl.nb_points();
+                    OPENGEODE_EXCEPTION(
+                        impl.nn_tree_.vind.size() == nb_points,
+                        "[NNSearch::serialize] Wrong number of points in "
+                        "kd-tree" );
+                    for( const auto p : impl.nn_tree_.vind )
+                    {
+                        OPENGEODE_EXCEPTION( p < nb_points,
+                            "[NNSearch::serialize] Wrong point index" );
+                    }
+                } );
+        }
+
         std::array< double, dimension > copy(
             const Point< dimension >& point ) const
         {
@@ -121,13 +320,14 @@ namespace geode
         };
 
     private:
-        const PointCloud cloud_;
+        PointCloud cloud_;
         nanoflann::KDTreeSingleIndexAdaptor<
             nanoflann::L2_Simple_Adaptor< double, PointCloud >,
             PointCloud,
             dimension,
             index_t >
             nn_tree_;
+        uint64_t checksum_{ detail::GeometryChecksum{}.value() };
     };
 
     template < index_t dimension >
@@ -136,11 +336,34 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    NNSearch< dimension >::NNSearch() // NOLINT
+    {
+    }
+
     template < index_t dimension >
     NNSearch< dimension >::~NNSearch() // NOLINT
     {
     }
 
+    template < index_t dimension >
+    bool NNSearch< dimension >::is_built_from(
+        absl::Span< const Point< dimension > > points ) const
+    {
+        return points.size() == nb_points()
+               && Impl::compute_checksum( points ) == impl_->checksum();
+    }
+
+    template < index_t dimension >
+    template < typename Archive >
+    void NNSearch< dimension >::serialize( Archive& archive )
+    {
+        archive.ext( *this, DefaultGrowable< Archive, NNSearch >{},
+            []( Archive& archive, NNSearch& search ) {
+                archive.object( search.impl_ );
+            } );
+    }
+
     template < index_t dimension >
     const Point< dimension >& NNSearch< dimension >::point(
         index_t index ) const
@@ -222,6 +445,83 @@ namespace geode
         return { std::move( mapping ), std::move( unique_points ) };
     }
 
+    template < index_t dimension >
+    void save_nn_search(
+        const NNSearch< dimension >& search, std::ostream& stream )
+    {
+        TContext context{};
+        register_basic_serialize_pcontext( std::get< 0 >( context ) );
+        register_geometry_serialize_pcontext( std::get< 0 >( context ) );
+        Serializer archive{ context, stream };
+        archive.object( search );
+        archive.adapter().flush();
+        OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
+            "[save_nn_search] Error while writing NNSearch" );
+    }
+
+    template < index_t dimension >
+    void save_nn_search(
+        const NNSearch< dimension >& search, absl::string_view filename )
+    {
+        std::ofstream file{ std::string{ filename }, std::ofstream::binary };
+        OPENGEODE_EXCEPTION(
+            file.good(), "[save_nn_search] Cannot create file: ", filename );
+        save_nn_search( search, file );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< NNSearch< dimension > > load_nn_search(
+        std::istream& stream )
+    {
+        std::unique_ptr< NNSearch< dimension > > search{
+            new NNSearch< dimension >
+        };
+        TContext context{};
+        register_basic_deserialize_pcontext( std::get< 0 >( context ) );
+        register_geometry_deserialize_pcontext( std::get< 0 >( context ) );
+        Deserializer archive{ context, stream };
+        archive.object( *search );
+        const auto& adapter = archive.adapter();
+        OPENGEODE_EXCEPTION( adapter.error() == bitsery::ReaderError::NoError
+                                 && std::get< 1 >( context ).isValid(),
+            "[load_nn_search] Error while reading NNSearch" );
+        return search;
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< NNSearch< dimension > > load_nn_search(
+        absl::string_view filename )
+    {
+        std::ifstream file{ std::string{ filename }, std::ifstream::binary };
+        OPENGEODE_EXCEPTION(
+            file.good(), "[load_nn_search] Cannot open file: ", filename );
+        auto search = load_nn_search< dimension >( file );
+        OPENGEODE_EXCEPTION(
+            file.peek() == std::ifstream::traits_type::eof(),
+            "[load_nn_search] Unexpected data at the end of file: ",
+            filename );
+        return search;
+    }
+
     template class opengeode_geometry_api NNSearch< 2 >;
+    SERIALIZE_BITSERY_ARCHIVE( opengeode_geometry_api, NNSearch< 2 > );
+    template void opengeode_geometry_api save_nn_search(
+        const NNSearch< 2 >&, std::ostream& );
+    template void opengeode_geometry_api save_nn_search(
+        const NNSearch< 2 >&, absl::string_view );
+    template std::unique_ptr< NNSearch< 2 > > opengeode_geometry_api
+        load_nn_search( std::istream& );
+    template std::unique_ptr< NNSearch< 2 > > opengeode_geometry_api
+        load_nn_search( absl::string_view );
+
     template class opengeode_geometry_api NNSearch< 3 >;
+    SERIALIZE_BITSERY_ARCHIVE( opengeode_geometry_api, NNSearch< 3 > );
+    template void opengeode_geometry_api save_nn_search(
+        const NNSearch< 3 >&, std::ostream& );
+    template void opengeode_geometry_api save_nn_search(
+        const NNSearch< 3 >&, absl::string_view );
+    template std::unique_ptr< NNSearch< 3 > > opengeode_geometry_api
+        load_nn_search( std::istream& );
+    template std::unique_ptr< NNSearch< 3 > > opengeode_geometry_api
+        load_nn_search( absl::string_view );
 } // namespace geode
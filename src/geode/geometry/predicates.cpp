@@ -0,0 +1,572 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/predicates.h>
+
+#include <cmath>
+#include <limits>
+
+#include <absl/container/fixed_array.h>
+#include <absl/container/inlined_vector.h>
+
+#include <geode/geometry/point.h>
+
+namespace
+{
+    // Error bounds of the floating point evaluations, from J. R. Shewchuk,
+    // Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+    // Predicates, 1997.
+    constexpr double EPSILON{ 0.5 * std::numeric_limits< double >::epsilon() };
+    constexpr double ORIENT2D_BOUND{ ( 3. + 16. * EPSILON ) * EPSILON };
+    constexpr double ORIENT3D_BOUND{ ( 7. + 56. * EPSILON ) * EPSILON };
+    constexpr double INCIRCLE_BOUND{ ( 10. + 96. * EPSILON ) * EPSILON };
+    constexpr double INSPHERE_BOUND{ ( 16. + 224. * EPSILON ) * EPSILON };
+    // 2^27 + 1, used to split a double into two non-overlapping halves
+    constexpr double SPLITTER{ 134217729. };
+
+    struct FilteredDeterminant
+    {
+        double value;
+        double error_bound;
+    };
+
+    geode::Side opposite( geode::Side side )
+    {
+        if( side == geode::Side::positive )
+        {
+            return geode::Side::negative;
+        }
+        if( side == geode::Side::negative )
+        {
+            return geode::Side::positive;
+        }
+        return geode::Side::zero;
+    }
+
+    template < typename ExactSide >
+    geode::Side filtered_side(
+        const FilteredDeterminant& determinant, const ExactSide& exact_side )
+    {
+        if( determinant.value > determinant.error_bound )
+        {
+            return geode::Side::positive;
+        }
+        if( -determinant.value > determinant.error_bound )
+        {
+            return geode::Side::negative;
+        }
+        if( determinant.error_bound == 0 )
+        {
+            return geode::Side::zero;
+        }
+        return exact_side();
+    }
+
+    /*!
+     * Floating point expansion: a sum of non-overlapping doubles sorted by
+     * increasing magnitude, representing a real number exactly.
+     * Zero components are eliminated, so expansions of exactly computed
+     * values stay short and cheap to combine.
+     */
+    class Expansion
+    {
+    public:
+        Expansion() = default;
+
+        static Expansion difference( double a, double b )
+        {
+            const auto x = a - b;
+            const auto b_virtual = a - x;
+            const auto a_virtual = x + b_virtual;
+            const auto y = ( a - a_virtual ) + ( b_virtual - b );
+            Expansion result;
+            result.push( y );
+            result.push( x );
+            return result;
+        }
+
+        Expansion operator+( const Expansion& other ) const
+        {
+            auto result = *this;
+            for( const auto component : other.components_ )
+            {
+                result.add( component );
+            }
+            return result;
+        }
+
+        Expansion operator-( const Expansion& other ) const
+        {
+            auto result = *this;
+            for( const auto component : other.components_ )
+            {
+                result.add( -component );
+            }
+            return result;
+        }
+
+        Expansion operator*( const Expansion& other ) const
+        {
+            Expansion result;
+            for( const auto factor : other.components_ )
+            {
+                for( const auto component : components_ )
+                {
+                    double high;
+                    double low;
+                    two_product( component, factor, high, low );
+                    result.add( low );
+                    result.add( high );
+                }
+            }
+            return result;
+        }
+
+        geode::Side side() const
+        {
+            if( components_.empty() )
+            {
+                return geode::Side::zero;
+            }
+            return components_.back() > 0 ? geode::Side::positive
+                                           : geode::Side::negative;
+        }
+
+    private:
+        void push( double component )
+        {
+            if( component != 0 )
+            {
+                components_.push_back( component );
+            }
+        }
+
+        void add( double value )
+        {
+            Components result;
+            auto sum = value;
+            for( const auto component : components_ )
+            {
+                const auto x = sum + component;
+                const auto b_virtual = x - sum;
+                const auto a_virtual = x - b_virtual;
+                const auto y =
+                    ( sum - a_virtual ) + ( component - b_virtual );
+                if( y != 0 )
+                {
+                    result.push_back( y );
+                }
+                sum = x;
+            }
+            if( sum != 0 )
+            {
+                result.push_back( sum );
+            }
+            components_ = std::move( result );
+        }
+
+        static void split( double a, double& high, double& low )
+        {
+            const auto c = SPLITTER * a;
+            high = c - ( c - a );
+            low = a - high;
+        }
+
+        static void two_product( double a, double b, double& x, double& y )
+        {
+            x = a * b;
+            double a_high;
+            double a_low;
+            double b_high;
+            double b_low;
+            split( a, a_high, a_low );
+            split( b, b_high, b_low );
+            const auto error = x - a_high * b_high - a_low * b_high
+                               - a_high * b_low;
+            y = a_low * b_low - error;
+        }
+
+    private:
+        using Components = absl::InlinedVector< double, 16 >;
+        Components components_;
+    };
+
+    inline FilteredDeterminant orient2d_determinant( const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c )
+    {
+        const auto left =
+            ( a.value( 0 ) - c.value( 0 ) ) * ( b.value( 1 ) - c.value( 1 ) );
+        const auto right =
+            ( a.value( 1 ) - c.value( 1 ) ) * ( b.value( 0 ) - c.value( 0 ) );
+        return { left - right,
+            ORIENT2D_BOUND * ( std::fabs( left ) + std::fabs( right ) ) };
+    }
+
+    geode::Side orient2d_exact( const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c )
+    {
+        const auto acx = Expansion::difference( a.value( 0 ), c.value( 0 ) );
+        const auto acy = Expansion::difference( a.value( 1 ), c.value( 1 ) );
+        const auto bcx = Expansion::difference( b.value( 0 ), c.value( 0 ) );
+        const auto bcy = Expansion::difference( b.value( 1 ), c.value( 1 ) );
+        return ( acx * bcy - acy * bcx ).side();
+    }
+
+    inline FilteredDeterminant orient3d_determinant( const geode::Point3D& a,
+        const geode::Point3D& b,
+        const geode::Point3D& c,
+        const geode::Point3D& d )
+    {
+        const auto adx = a.value( 0 ) - d.value( 0 );
+        const auto ady = a.value( 1 ) - d.value( 1 );
+        const auto adz = a.value( 2 ) - d.value( 2 );
+        const auto bdx = b.value( 0 ) - d.value( 0 );
+        const auto bdy = b.value( 1 ) - d.value( 1 );
+        const auto bdz = b.value( 2 ) - d.value( 2 );
+        const auto cdx = c.value( 0 ) - d.value( 0 );
+        const auto cdy = c.value( 1 ) - d.value( 1 );
+        const auto cdz = c.value( 2 ) - d.value( 2 );
+        const auto bdxcdy = bdx * cdy;
+        const auto cdxbdy = cdx * bdy;
+        const auto cdxady = cdx * ady;
+        const auto adxcdy = adx * cdy;
+        const auto adxbdy = adx * bdy;
+        const auto bdxady = bdx * ady;
+        const auto determinant = adz * ( bdxcdy - cdxbdy )
+                                 + bdz * ( cdxady - adxcdy )
+                                 + cdz * ( adxbdy - bdxady );
+        const auto permanent =
+            ( std::fabs( bdxcdy ) + std::fabs( cdxbdy ) ) * std::fabs( adz )
+            + ( std::fabs( cdxady ) + std::fabs( adxcdy ) ) * std::fabs( bdz )
+            + ( std::fabs( adxbdy ) + std::fabs( bdxady ) ) * std::fabs( cdz );
+        // The determinant is evaluated relatively to d, which reverses its
+        // sign compared to tetra_signed_volume
+        return { -determinant, ORIENT3D_BOUND * permanent };
+    }
+
+    geode::Side orient3d_exact( const geode::Point3D& a,
+        const geode::Point3D& b,
+        const geode::Point3D& c,
+        const geode::Point3D& d )
+    {
+        const auto adx = Expansion::difference( a.value( 0 ), d.value( 0 ) );
+        const auto ady = Expansion::difference( a.value( 1 ), d.value( 1 ) );
+        const auto adz = Expansion::difference( a.value( 2 ), d.value( 2 ) );
+        const auto bdx = Expansion::difference( b.value( 0 ), d.value( 0 ) );
+        const auto bdy = Expansion::difference( b.value( 1 ), d.value( 1 ) );
+        const auto bdz = Expansion::difference( b.value( 2 ), d.value( 2 ) );
+        const auto cdx = Expansion::difference( c.value( 0 ), d.value( 0 ) );
+        const auto cdy = Expansion::difference( c.value( 1 ), d.value( 1 ) );
+        const auto cdz = Expansion::difference( c.value( 2 ), d.value( 2 ) );
+        const auto determinant = adz * ( bdx * cdy - cdx * bdy )
+                                 + bdz * ( cdx * ady - adx * cdy )
+                                 + cdz * ( adx * bdy - bdx * ady );
+        return opposite( determinant.side() );
+    }
+
+    inline FilteredDeterminant incircle_determinant( const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c,
+        const geode::Point2D& d )
+    {
+        const auto adx = a.value( 0 ) - d.value( 0 );
+        const auto ady = a.value( 1 ) - d.value( 1 );
+        const auto bdx = b.value( 0 ) - d.value( 0 );
+        const auto bdy = b.value( 1 ) - d.value( 1 );
+        const auto cdx = c.value( 0 ) - d.value( 0 );
+        const auto cdy = c.value( 1 ) - d.value( 1 );
+        const auto bdxcdy = bdx * cdy;
+        const auto cdxbdy = cdx * bdy;
+        const auto alift = adx * adx + ady * ady;
+        const auto cdxady = cdx * ady;
+        const auto adxcdy = adx * cdy;
+        const auto blift = bdx * bdx + bdy * bdy;
+        const auto adxbdy = adx * bdy;
+        const auto bdxady = bdx * ady;
+        const auto clift = cdx * cdx + cdy * cdy;
+        const auto determinant = alift * ( bdxcdy - cdxbdy )
+                                 + blift * ( cdxady - adxcdy )
+                                 + clift * ( adxbdy - bdxady );
+        const auto permanent =
+            ( std::fabs( bdxcdy ) + std::fabs( cdxbdy ) ) * alift
+            + ( std::fabs( cdxady ) + std::fabs( adxcdy ) ) * blift
+            + ( std::fabs( adxbdy ) + std::fabs( bdxady ) ) * clift;
+        return { determinant, INCIRCLE_BOUND * permanent };
+    }
+
+    geode::Side incircle_exact( const geode::Point2D& a,
+        const geode::Point2D& b,
+        const geode::Point2D& c,
+        const geode::Point2D& d )
+    {
+        const auto adx = Expansion::difference( a.value( 0 ), d.value( 0 ) );
+        const auto ady = Expansion::difference( a.value( 1 ), d.value( 1 ) );
+        const auto bdx = Expansion::difference( b.value( 0 ), d.value( 0 ) );
+        const auto bdy = Expansion::difference( b.value( 1 ), d.value( 1 ) );
+        const auto cdx = Expansion::difference( c.value( 0 ), d.value( 0 ) );
+        const auto cdy = Expansion::difference( c.value( 1 ), d.value( 1 ) );
+        const auto alift = adx * adx + ady * ady;
+        const auto blift = bdx * bdx + bdy * bdy;
+        const auto clift = cdx * cdx + cdy * cdy;
+        const auto determinant = alift * ( bdx * cdy - cdx * bdy )
+                                 + blift * ( cdx * ady - adx * cdy )
+                                 + clift * ( adx * bdy - bdx * ady );
+        return determinant.side();
+    }
+
+    inline FilteredDeterminant insphere_determinant( const geode::Point3D& a,
+        const geode::Point3D& b,
+        const geode::Point3D& c,
+        const geode::Point3D& d,
+        const geode::Point3D& e )
+    {
+        const auto aex = a.value( 0 ) - e.value( 0 );
+        const auto aey = a.value( 1 ) - e.value( 1 );
+        const auto aez = a.value( 2 ) - e.value( 2 );
+        const auto bex = b.value( 0 ) - e.value( 0 );
+        const auto bey = b.value( 1 ) - e.value( 1 );
+        const auto bez = b.value( 2 ) - e.value( 2 );
+        const auto cex = c.value( 0 ) - e.value( 0 );
+        const auto cey = c.value( 1 ) - e.value( 1 );
+        const auto cez = c.value( 2 ) - e.value( 2 );
+        const auto dex = d.value( 0 ) - e.value( 0 );
+        const auto dey = d.value( 1 ) - e.value( 1 );
+        const auto dez = d.value( 2 ) - e.value( 2 );
+        const auto aexbey = aex * bey;
+        const auto bexaey = bex * aey;
+        const auto bexcey = bex * cey;
+        const auto cexbey = cex * bey;
+        const auto cexdey = cex * dey;
+        const auto dexcey = dex * cey;
+        const auto dexaey = dex * aey;
+        const auto aexdey = aex * dey;
+        const auto aexcey = aex * cey;
+        const auto cexaey = cex * aey;
+        const auto bexdey = bex * dey;
+        const auto dexbey = dex * bey;
+        const auto ab = aexbey - bexaey;
+        const auto bc = bexcey - cexbey;
+        const auto cd = cexdey - dexcey;
+        const auto da = dexaey - aexdey;
+        const auto ac = aexcey - cexaey;
+        const auto bd = bexdey - dexbey;
+        const auto abc = aez * bc - bez * ac + cez * ab;
+        const auto bcd = bez * cd - cez * bd + dez * bc;
+        const auto cda = cez * da + dez * ac + aez * cd;
+        const auto dab = dez * ab + aez * bd + bez * da;
+        const auto alift = aex * aex + aey * aey + aez * aez;
+        const auto blift = bex * bex + bey * bey + bez * bez;
+        const auto clift = cex * cex + cey * cey + cez * cez;
+        const auto dlift = dex * dex + dey * dey + dez * dez;
+        const auto determinant =
+            ( dlift * abc - clift * dab ) + ( blift * cda - alift * bcd );
+        const auto ab_plus = std::fabs( aexbey ) + std::fabs( bexaey );
+        const auto bc_plus = std::fabs( bexcey ) + std::fabs( cexbey );
+        const auto cd_plus = std::fabs( cexdey ) + std::fabs( dexcey );
+        const auto da_plus = std::fabs( dexaey ) + std::fabs( aexdey );
+        const auto ac_plus = std::fabs( aexcey ) + std::fabs( cexaey );
+        const auto bd_plus = std::fabs( bexdey ) + std::fabs( dexbey );
+        const auto aez_plus = std::fabs( aez );
+        const auto bez_plus = std::fabs( bez );
+        const auto cez_plus = std::fabs( cez );
+        const auto dez_plus = std::fabs( dez );
+        const auto permanent =
+            ( cd_plus * bez_plus + bd_plus * cez_plus + bc_plus * dez_plus )
+                * alift
+            + ( da_plus * cez_plus + ac_plus * dez_plus + cd_plus * aez_plus )
+                  * blift
+            + ( ab_plus * dez_plus + bd_plus * aez_plus + da_plus * bez_plus )
+                  * clift
+            + ( bc_plus * aez_plus + ac_plus * bez_plus + ab_plus * cez_plus )
+                  * dlift;
+        // Same sign reversal than orient3d_determinant
+        return { -determinant, INSPHERE_BOUND * permanent };
+    }
+
+    geode::Side insphere_exact( const geode::Point3D& a,
+        const geode::Point3D& b,
+        const geode::Point3D& c,
+        const geode::Point3D& d,
+        const geode::Point3D& e )
+    {
+        const auto aex = Expansion::difference( a.value( 0 ), e.value( 0 ) );
+        const auto aey = Expansion::difference( a.value( 1 ), e.value( 1 ) );
+        const auto aez = Expansion::difference( a.value( 2 ), e.value( 2 ) );
+        const auto bex = Expansion::difference( b.value( 0 ), e.value( 0 ) );
+        const auto bey = Expansion::difference( b.value( 1 ), e.value( 1 ) );
+        const auto bez = Expansion::difference( b.value( 2 ), e.value( 2 ) );
+        const auto cex = Expansion::difference( c.value( 0 ), e.value( 0 ) );
+        const auto cey = Expansion::difference( c.value( 1 ), e.value( 1 ) );
+        const auto cez = Expansion::difference( c.value( 2 ), e.value( 2 ) );
+        const auto dex = Expansion::difference( d.value( 0 ), e.value( 0 ) );
+        const auto dey = Expansion::difference( d.value( 1 ), e.value( 1 ) );
+        const auto dez = Expansion::difference( d.value( 2 ), e.value( 2 ) );
+        const auto ab = aex * bey - bex * aey;
+        const auto bc = bex * cey - cex * bey;
+        const auto cd = cex * dey - dex * cey;
+        const auto da = dex * aey - aex * dey;
+        const auto ac = aex * cey - cex * aey;
+        const auto bd = bex * dey - dex * bey;
+        const auto abc = aez * bc - bez * ac + cez * ab;
+        const auto bcd = bez * cd - cez * bd + dez * bc;
+        const auto cda = cez * da + dez * ac + aez * cd;
+        const auto dab = dez * ab + aez * bd + bez * da;
+        const auto alift = aex * aex + aey * aey + aez * aez;
+        const auto blift = bex * bex + bey * bey + bez * bez;
+        const auto clift = cex * cex + cey * cey + cez * cez;
+        const auto dlift = dex * dex + dey * dey + dez * dez;
+        const auto determinant =
+            ( dlift * abc - clift * dab ) + ( blift * cda - alift * bcd );
+        return opposite( determinant.side() );
+    }
+} // namespace
+
+namespace geode
+{
+    Side orient2d( const Point2D& a, const Point2D& b, const Point2D& c )
+    {
+        return filtered_side( orient2d_determinant( a, b, c ),
+            [&a, &b, &c] { return orient2d_exact( a, b, c ); } );
+    }
+
+    Side orient3d( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        const Point3D& d )
+    {
+        return filtered_side( orient3d_determinant( a, b, c, d ),
+            [&a, &b, &c, &d] { return orient3d_exact( a, b, c, d ); } );
+    }
+
+    Side incircle( const Point2D& a,
+        const Point2D& b,
+        const Point2D& c,
+        const Point2D& d )
+    {
+        return filtered_side( incircle_determinant( a, b, c, d ),
+            [&a, &b, &c, &d] { return incircle_exact( a, b, c, d ); } );
+    }
+
+    Side insphere( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        const Point3D& d,
+        const Point3D& e )
+    {
+        return filtered_side( insphere_determinant( a, b, c, d, e ),
+            [&a, &b, &c, &d, &e] { return insphere_exact( a, b, c, d, e ); } );
+    }
+
+    void orient2d( const Point2D& a,
+        const Point2D& b,
+        absl::Span< const Point2D > points,
+        absl::Span< Side > sides )
+    {
+        OPENGEODE_EXCEPTION( sides.size() >= points.size(),
+            "[orient2d] Output span is too small" );
+        const auto nb_points = points.size();
+        absl::FixedArray< FilteredDeterminant > determinants( nb_points );
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            determinants[p] = orient2d_determinant( a, b, points[p] );
+        }
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            sides[p] = filtered_side( determinants[p], [&a, &b, &points, p] {
+                return orient2d_exact( a, b, points[p] );
+            } );
+        }
+    }
+
+    void orient3d( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        absl::Span< const Point3D > points,
+        absl::Span< Side > sides )
+    {
+        OPENGEODE_EXCEPTION( sides.size() >= points.size(),
+            "[orient3d] Output span is too small" );
+        const auto nb_points = points.size();
+        absl::FixedArray< FilteredDeterminant > determinants( nb_points );
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            determinants[p] = orient3d_determinant( a, b, c, points[p] );
+        }
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            sides[p] =
+                filtered_side( determinants[p], [&a, &b, &c, &points, p] {
+                    return orient3d_exact( a, b, c, points[p] );
+                } );
+        }
+    }
+
+    void incircle( const Point2D& a,
+        const Point2D& b,
+        const Point2D& c,
+        absl::Span< const Point2D > points,
+        absl::Span< Side > sides )
+    {
+        OPENGEODE_EXCEPTION( sides.size() >= points.size(),
+            "[incircle] Output span is too small" );
+        const auto nb_points = points.size();
+        absl::FixedArray< FilteredDeterminant > determinants( nb_points );
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            determinants[p] = incircle_determinant( a, b, c, points[p] );
+        }
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            sides[p] =
+                filtered_side( determinants[p], [&a, &b, &c, &points, p] {
+                    return incircle_exact( a, b, c, points[p] );
+                } );
+        }
+    }
+
+    void insphere( const Point3D& a,
+        const Point3D& b,
+        const Point3D& c,
+        const Point3D& d,
+        absl::Span< const Point3D > points,
+        absl::Span< Side > sides )
+    {
+        OPENGEODE_EXCEPTION( sides.size() >= points.size(),
+            "[insphere] Output span is too small" );
+        const auto nb_points = points.size();
+        absl::FixedArray< FilteredDeterminant > determinants( nb_points );
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            determinants[p] = insphere_determinant( a, b, c, d, points[p] );
+        }
+        for( size_t p = 0; p < nb_points; p++ )
+        {
+            sides[p] =
+                filtered_side( determinants[p], [&a, &b, &c, &d, &points, p] {
+                    return insphere_exact( a, b, c, d, points[p] );
+                } );
+        }
+    }
+} // namespace geode
@@ -60,6 +60,12 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    void OpenGeodePointSetBuilder< dimension >::do_permute_vertices(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template class opengeode_mesh_api OpenGeodePointSetBuilder< 2 >;
     template class opengeode_mesh_api OpenGeodePointSetBuilder< 3 >;
 } // namespace geode
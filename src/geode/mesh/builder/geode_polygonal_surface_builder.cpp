@@ -100,6 +100,13 @@ namespace geode
         geode_polygonal_surface_->remove_polygons( to_delete, {} );
     }
 
+    template < index_t dimension >
+    void OpenGeodePolygonalSurfaceBuilder< dimension >::do_permute_polygons(
+        absl::Span< const index_t > permutation )
+    {
+        geode_polygonal_surface_->permute_polygons( permutation, {} );
+    }
+
     template class opengeode_mesh_api OpenGeodePolygonalSurfaceBuilder< 2 >;
     template class opengeode_mesh_api OpenGeodePolygonalSurfaceBuilder< 3 >;
 } // namespace geode
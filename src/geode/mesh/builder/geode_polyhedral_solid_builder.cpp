@@ -102,5 +102,12 @@ namespace geode
         geode_polyhedral_solid_->remove_polyhedra( to_delete, {} );
     }
 
+    template < index_t dimension >
+    void OpenGeodePolyhedralSolidBuilder< dimension >::do_permute_polyhedra(
+        absl::Span< const index_t > permutation )
+    {
+        geode_polyhedral_solid_->permute_polyhedra( permutation, {} );
+    }
+
     template class opengeode_mesh_api OpenGeodePolyhedralSolidBuilder< 3 >;
 } // namespace geode
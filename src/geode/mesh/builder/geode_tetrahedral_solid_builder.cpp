@@ -108,5 +108,11 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    void OpenGeodeTetrahedralSolidBuilder< dimension >::do_permute_polyhedra(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template class opengeode_mesh_api OpenGeodeTetrahedralSolidBuilder< 3 >;
 } // namespace geode
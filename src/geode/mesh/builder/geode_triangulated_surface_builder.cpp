@@ -107,6 +107,12 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    void OpenGeodeTriangulatedSurfaceBuilder< dimension >::do_permute_polygons(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template class opengeode_mesh_api OpenGeodeTriangulatedSurfaceBuilder< 2 >;
     template class opengeode_mesh_api OpenGeodeTriangulatedSurfaceBuilder< 3 >;
 } // namespace geode
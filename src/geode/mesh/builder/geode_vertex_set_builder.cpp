@@ -40,4 +40,9 @@ namespace geode
         const std::vector< bool >& /*unused*/ )
     {
     }
+
+    void OpenGeodeVertexSetBuilder::do_permute_vertices(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
 } // namespace geode
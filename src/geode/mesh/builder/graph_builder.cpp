@@ -27,6 +27,7 @@
 
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/detail/mapping_after_deletion.h>
+#include <geode/basic/detail/permutation.h>
 
 #include <geode/mesh/builder/mesh_builder_factory.h>
 #include <geode/mesh/core/graph.h>
@@ -129,6 +130,20 @@ namespace geode
         do_delete_curve_vertices( to_delete );
     }
 
+    void GraphBuilder::do_permute_vertices(
+        absl::Span< const index_t > permutation )
+    {
+        const auto old2new = detail::old2new_permutation( permutation );
+        for( const auto e : Range{ graph_->nb_edges() } )
+        {
+            for( const auto v : Range{ 2 } )
+            {
+                const EdgeVertex id{ e, v };
+                do_set_edge_vertex( id, old2new[graph_->edge_vertex( id )] );
+            }
+        }
+    }
+
     std::vector< index_t > GraphBuilder::delete_edges(
         const std::vector< bool >& to_delete )
     {
@@ -97,7 +97,7 @@ namespace geode
 
     template < index_t dimension >
     void PolygonalSurfaceViewBuilder< dimension >::do_create_polygon(
-        absl::Span< const unsigned int > )
+        absl::Span< const index_t > )
     {
     }
 
@@ -107,6 +107,12 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    void PolygonalSurfaceViewBuilder< dimension >::do_permute_polygons(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template < index_t dimension >
     void PolygonalSurfaceViewBuilder< dimension >::add_viewed_vertex(
         index_t vertex_id )
@@ -121,6 +127,13 @@ namespace geode
         polygonal_surface_view_->add_viewed_polygon( polygon_id, {} );
     }
 
+    template < index_t dimension >
+    void PolygonalSurfaceViewBuilder< dimension >::add_viewed_polygons(
+        absl::Span< const index_t > polygon_ids )
+    {
+        polygonal_surface_view_->add_viewed_polygons( polygon_ids, {} );
+    }
+
     template class opengeode_mesh_api PolygonalSurfaceViewBuilder< 2 >;
     template class opengeode_mesh_api PolygonalSurfaceViewBuilder< 3 >;
 } // namespace geode
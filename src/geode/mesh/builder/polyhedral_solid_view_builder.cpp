@@ -109,6 +109,12 @@ namespace geode
         // polyhedral_solid_view_->remove_polyhedra( to_delete, {} );
     }
 
+    template < index_t dimension >
+    void PolyhedralSolidViewBuilder< dimension >::do_permute_polyhedra(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template < index_t dimension >
     void PolyhedralSolidViewBuilder< dimension >::add_viewed_vertex(
         index_t vertex_id )
@@ -123,5 +129,12 @@ namespace geode
         polyhedral_solid_view_->add_viewed_polyhedron( polyhedron_id, {} );
     }
 
+    template < index_t dimension >
+    void PolyhedralSolidViewBuilder< dimension >::add_viewed_polyhedra(
+        absl::Span< const index_t > polyhedron_ids )
+    {
+        polyhedral_solid_view_->add_viewed_polyhedra( polyhedron_ids, {} );
+    }
+
     template class opengeode_mesh_api PolyhedralSolidViewBuilder< 3 >;
 } // namespace geode
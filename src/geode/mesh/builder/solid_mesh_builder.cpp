@@ -24,6 +24,7 @@
 #include <geode/mesh/builder/solid_mesh_builder.h>
 
 #include <geode/basic/attribute_manager.h>
+#include <geode/basic/detail/permutation.h>
 
 #include <geode/geometry/point.h>
 
@@ -190,6 +191,7 @@ namespace geode
     void SolidMeshBuilder< dimension >::set_polyhedron_vertex(
         const PolyhedronVertex& polyhedron_vertex, index_t vertex_id )
     {
+        set_metrics_dirty();
         const auto polyhedron_vertex_id =
             solid_mesh_->polyhedron_vertex( polyhedron_vertex );
         if( polyhedron_vertex_id != NO_ID )
@@ -306,6 +308,7 @@ namespace geode
         absl::Span< const index_t > vertices,
         absl::Span< const std::vector< index_t > > facets )
     {
+        set_metrics_dirty();
         const auto added_polyhedron = solid_mesh_->nb_polyhedra();
         solid_mesh_->polyhedron_attribute_manager().resize(
             added_polyhedron + 1 );
@@ -430,6 +433,12 @@ namespace geode
             std::move( edge_vertices ), {} );
     }
 
+    template < index_t dimension >
+    void SolidMeshBuilder< dimension >::set_metrics_dirty()
+    {
+        solid_mesh_->set_metrics_dirty( {} );
+    }
+
     template < index_t dimension >
     void SolidMeshBuilder< dimension >::do_delete_vertices(
         const std::vector< bool >& to_delete )
@@ -441,6 +450,25 @@ namespace geode
         do_delete_solid_vertices( to_delete );
     }
 
+    template < index_t dimension >
+    void SolidMeshBuilder< dimension >::do_permute_vertices(
+        absl::Span< const index_t > permutation )
+    {
+        const auto old2new = detail::old2new_permutation( permutation );
+        for( const auto p : Range{ solid_mesh_->nb_polyhedra() } )
+        {
+            for( const auto v :
+                Range{ solid_mesh_->nb_polyhedron_vertices( p ) } )
+            {
+                const PolyhedronVertex id{ p, v };
+                do_set_polyhedron_vertex(
+                    id, old2new[solid_mesh_->polyhedron_vertex( id )] );
+            }
+        }
+        update_facet_vertices( old2new );
+        update_edge_vertices( old2new );
+    }
+
     template < index_t dimension >
     void SolidMeshBuilder< dimension >::set_polyhedron_adjacent(
         const PolyhedronFacet& polyhedron_facet, index_t adjacent_id )
@@ -603,6 +631,29 @@ namespace geode
         return old2new;
     }
 
+    template < index_t dimension >
+    std::vector< index_t > SolidMeshBuilder< dimension >::reorder_polyhedra(
+        absl::Span< const index_t > permutation )
+    {
+        const auto old2new = detail::old2new_permutation( permutation );
+        solid_mesh_->polyhedron_attribute_manager().permute_elements(
+            permutation );
+        do_permute_polyhedra( permutation );
+        update_polyhedron_adjacencies( *solid_mesh_, *this, old2new );
+        for( const auto v : Range{ solid_mesh_->nb_vertices() } )
+        {
+            if( const auto polyhedron_vertex =
+                    solid_mesh_->polyhedron_around_vertex( v ) )
+            {
+                associate_polyhedron_vertex_to_vertex(
+                    { old2new[polyhedron_vertex->polyhedron_id],
+                        polyhedron_vertex->vertex_id },
+                    v );
+            }
+        }
+        return old2new;
+    }
+
     template < index_t dimension >
     void SolidMeshBuilder< dimension >::remove_polyhedra_facets(
         const std::vector< bool >& to_delete )
@@ -727,6 +778,7 @@ namespace geode
         OPENGEODE_ASSERT( vertex_id < solid_mesh_->nb_vertices(),
             "[SolidMeshBuilder::set_point] Accessing a vertex that does "
             "not exist" );
+        set_metrics_dirty();
         do_set_point( vertex_id, std::move( point ) );
     }
 
@@ -24,6 +24,7 @@
 #include <geode/mesh/builder/surface_mesh_builder.h>
 
 #include <geode/basic/attribute_manager.h>
+#include <geode/basic/detail/permutation.h>
 
 #include <geode/geometry/point.h>
 
@@ -186,6 +187,7 @@ namespace geode
     index_t SurfaceMeshBuilder< dimension >::create_polygon(
         absl::Span< const index_t > vertices )
     {
+        set_metrics_dirty();
         const auto added_polygon = surface_mesh_->nb_polygons();
         surface_mesh_->polygon_attribute_manager().resize( added_polygon + 1 );
         for( const auto v : Indices{ vertices } )
@@ -232,10 +234,17 @@ namespace geode
             std::move( edge_vertices ), {} );
     }
 
+    template < index_t dimension >
+    void SurfaceMeshBuilder< dimension >::set_metrics_dirty()
+    {
+        surface_mesh_->set_metrics_dirty( {} );
+    }
+
     template < index_t dimension >
     void SurfaceMeshBuilder< dimension >::replace_vertex(
         index_t old_vertex_id, index_t new_vertex_id )
     {
+        set_metrics_dirty();
         const auto polygons_around =
             surface_mesh_->polygons_around_vertex( old_vertex_id );
         disassociate_polygon_vertex_to_vertex( old_vertex_id );
@@ -257,6 +266,7 @@ namespace geode
     void SurfaceMeshBuilder< dimension >::set_polygon_vertex(
         const PolygonVertex& polygon_vertex, index_t vertex_id )
     {
+        set_metrics_dirty();
         const auto polygon_vertex_id =
             surface_mesh_->polygon_vertex( polygon_vertex );
         const auto previous_id = surface_mesh_->polygon_vertex(
@@ -341,6 +351,24 @@ namespace geode
         do_delete_surface_vertices( to_delete );
     }
 
+    template < index_t dimension >
+    void SurfaceMeshBuilder< dimension >::do_permute_vertices(
+        absl::Span< const index_t > permutation )
+    {
+        const auto old2new = detail::old2new_permutation( permutation );
+        for( const auto p : Range{ surface_mesh_->nb_polygons() } )
+        {
+            for( const auto v :
+                Range{ surface_mesh_->nb_polygon_vertices( p ) } )
+            {
+                const PolygonVertex id{ p, v };
+                do_set_polygon_vertex(
+                    id, old2new[surface_mesh_->polygon_vertex( id )] );
+            }
+        }
+        update_edge_vertices( old2new );
+    }
+
     template < index_t dimension >
     void SurfaceMeshBuilder< dimension >::set_polygon_adjacent(
         const PolygonEdge& polygon_edge, index_t adjacent_id )
@@ -467,6 +495,29 @@ namespace geode
         return old2new;
     }
 
+    template < index_t dimension >
+    std::vector< index_t > SurfaceMeshBuilder< dimension >::reorder_polygons(
+        absl::Span< const index_t > permutation )
+    {
+        const auto old2new = detail::old2new_permutation( permutation );
+        surface_mesh_->polygon_attribute_manager().permute_elements(
+            permutation );
+        do_permute_polygons( permutation );
+        update_polygon_adjacencies( *surface_mesh_, *this, old2new );
+        for( const auto v : Range{ surface_mesh_->nb_vertices() } )
+        {
+            if( const auto polygon_vertex =
+                    surface_mesh_->polygon_around_vertex( v ) )
+            {
+                associate_polygon_vertex_to_vertex(
+                    { old2new[polygon_vertex->polygon_id],
+                        polygon_vertex->vertex_id },
+                    v );
+            }
+        }
+        return old2new;
+    }
+
     template < index_t dimension >
     std::vector< index_t >
         SurfaceMeshBuilder< dimension >::delete_isolated_vertices()
@@ -520,6 +571,7 @@ namespace geode
         OPENGEODE_ASSERT( vertex_id < surface_mesh_->nb_vertices(),
             "[SurfaceMeshBuilder::set_point] Accessing a vertex that does "
             "not exist" );
+        set_metrics_dirty();
         do_set_point( vertex_id, std::move( point ) );
     }
 
@@ -117,6 +117,7 @@ namespace geode
     index_t TetrahedralSolidBuilder< dimension >::create_tetrahedron(
         const std::array< index_t, 4 >& vertices )
     {
+        this->set_metrics_dirty();
         const auto added_tetra = tetrahedral_solid_->nb_polyhedra();
         tetrahedral_solid_->polyhedron_attribute_manager().resize(
             added_tetra + 1 );
@@ -147,6 +148,7 @@ namespace geode
     index_t TetrahedralSolidBuilder< dimension >::create_tetrahedra(
         index_t nb )
     {
+        this->set_metrics_dirty();
         const auto added_tetra = tetrahedral_solid_->nb_polyhedra();
         tetrahedral_solid_->polyhedron_attribute_manager().resize(
             added_tetra + nb );
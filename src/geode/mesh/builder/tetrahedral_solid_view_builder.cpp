@@ -102,6 +102,12 @@ namespace geode
         // tetrahedral_solid_view_->remove_polyhedra( to_delete, {} );
     }
 
+    template < index_t dimension >
+    void TetrahedralSolidViewBuilder< dimension >::do_permute_polyhedra(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template < index_t dimension >
     void TetrahedralSolidViewBuilder< dimension >::add_viewed_vertex(
         index_t vertex_id )
@@ -116,6 +122,13 @@ namespace geode
         tetrahedral_solid_view_->add_viewed_tetrahedron( tetrahedron_id, {} );
     }
 
+    template < index_t dimension >
+    void TetrahedralSolidViewBuilder< dimension >::add_viewed_tetrahedra(
+        absl::Span< const index_t > tetrahedron_ids )
+    {
+        tetrahedral_solid_view_->add_viewed_tetrahedra( tetrahedron_ids, {} );
+    }
+
     template < index_t dimension >
     void TetrahedralSolidViewBuilder< dimension >::do_create_facets(
         const std::array< index_t, 4 >& /*unused*/ )
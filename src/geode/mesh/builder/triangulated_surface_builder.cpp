@@ -65,6 +65,7 @@ namespace geode
     index_t TriangulatedSurfaceBuilder< dimension >::create_triangle(
         const std::array< index_t, 3 >& vertices )
     {
+        this->set_metrics_dirty();
         const auto added_triangle = triangulated_surface_->nb_polygons();
         triangulated_surface_->polygon_attribute_manager().resize(
             added_triangle + 1 );
@@ -87,6 +88,7 @@ namespace geode
     index_t TriangulatedSurfaceBuilder< dimension >::create_triangles(
         index_t nb )
     {
+        this->set_metrics_dirty();
         const auto added_triangle = triangulated_surface_->nb_polygons();
         triangulated_surface_->polygon_attribute_manager().resize(
             added_triangle + nb );
@@ -114,6 +114,12 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    void TriangulatedSurfaceViewBuilder< dimension >::do_permute_polygons(
+        absl::Span< const index_t > /*unused*/ )
+    {
+    }
+
     template < index_t dimension >
     void TriangulatedSurfaceViewBuilder< dimension >::add_viewed_vertex(
         index_t vertex_id )
@@ -128,6 +134,13 @@ namespace geode
         triangulated_surface_view_->add_viewed_triangle( triangle_id, {} );
     }
 
+    template < index_t dimension >
+    void TriangulatedSurfaceViewBuilder< dimension >::add_viewed_triangles(
+        absl::Span< const index_t > triangle_ids )
+    {
+        triangulated_surface_view_->add_viewed_triangles( triangle_ids, {} );
+    }
+
     template class opengeode_mesh_api TriangulatedSurfaceViewBuilder< 2 >;
     template class opengeode_mesh_api TriangulatedSurfaceViewBuilder< 3 >;
 } // namespace geode
@@ -24,6 +24,7 @@
 #include <geode/mesh/builder/vertex_set_builder.h>
 
 #include <geode/basic/attribute_manager.h>
+#include <geode/basic/detail/permutation.h>
 
 #include <geode/mesh/builder/mesh_builder_factory.h>
 #include <geode/mesh/core/vertex_set.h>
@@ -67,6 +68,11 @@ namespace geode
         return first_added_vertex;
     }
 
+    index_t VertexSetBuilder::nb_vertices() const
+    {
+        return vertex_set_->nb_vertices();
+    }
+
     std::vector< index_t > VertexSetBuilder::delete_vertices(
         const std::vector< bool >& to_delete )
     {
@@ -74,4 +80,12 @@ namespace geode
         do_delete_vertices( to_delete );
         return detail::mapping_after_deletion( to_delete );
     }
+
+    std::vector< index_t > VertexSetBuilder::reorder_vertices(
+        absl::Span< const index_t > permutation )
+    {
+        vertex_set_->vertex_attribute_manager().permute_elements( permutation );
+        do_permute_vertices( permutation );
+        return detail::old2new_permutation( permutation );
+    }
 } // namespace geode
@@ -49,6 +49,18 @@ namespace geode
             polygon_ptr_.emplace_back( 0 );
         }
 
+        MemoryUsage storage_memory_usage() const
+        {
+            using Storage = AttributeHeapMemory< std::vector< index_t > >;
+            MemoryUsage usage{ "polygon_storage", 0 };
+            usage.add_child(
+                "polygon_vertices", Storage::size( polygon_vertices_ ) );
+            usage.add_child(
+                "polygon_adjacents", Storage::size( polygon_adjacents_ ) );
+            usage.add_child( "polygon_ptr", Storage::size( polygon_ptr_ ) );
+            return usage;
+        }
+
         index_t get_polygon_vertex( const PolygonVertex& polygon_vertex ) const
         {
             return polygon_vertices_[starting_index( polygon_vertex.polygon_id )
@@ -127,6 +139,32 @@ namespace geode
                 polygon_adjacents_.begin() + index, polygon_adjacents_.end() );
         }
 
+        void permute_polygons( absl::Span< const index_t > permutation )
+        {
+            std::vector< index_t > vertices;
+            vertices.reserve( polygon_vertices_.size() );
+            std::vector< index_t > adjacents;
+            adjacents.reserve( polygon_adjacents_.size() );
+            std::vector< index_t > ptr;
+            ptr.reserve( polygon_ptr_.size() );
+            ptr.emplace_back( 0 );
+            for( const auto p : permutation )
+            {
+                const auto begin = starting_index( p );
+                const auto end = starting_index( p + 1 );
+                vertices.insert( vertices.end(),
+                    polygon_vertices_.begin() + begin,
+                    polygon_vertices_.begin() + end );
+                adjacents.insert( adjacents.end(),
+                    polygon_adjacents_.begin() + begin,
+                    polygon_adjacents_.begin() + end );
+                ptr.push_back( ptr.back() + end - begin );
+            }
+            polygon_vertices_ = std::move( vertices );
+            polygon_adjacents_ = std::move( adjacents );
+            polygon_ptr_ = std::move( ptr );
+        }
+
     private:
         Impl() = default;
 
@@ -135,12 +173,9 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, Impl >{},
                 []( Archive& archive, Impl& impl ) {
-                    archive.container4b( impl.polygon_vertices_,
-                        impl.polygon_vertices_.max_size() );
-                    archive.container4b( impl.polygon_adjacents_,
-                        impl.polygon_adjacents_.max_size() );
-                    archive.container4b(
-                        impl.polygon_ptr_, impl.polygon_ptr_.max_size() );
+                    serialize_indices( archive, impl.polygon_vertices_ );
+                    serialize_indices( archive, impl.polygon_adjacents_ );
+                    serialize_indices( archive, impl.polygon_ptr_ );
                     archive.ext(
                         impl, bitsery::ext::BaseClass<
                                   detail::PointsImpl< dimension > >{} );
@@ -177,6 +212,14 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    MemoryUsage OpenGeodePolygonalSurface< dimension >::memory_usage() const
+    {
+        auto usage = PolygonalSurface< dimension >::memory_usage();
+        usage.add_child( "polygon_storage", impl_->storage_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     const Point< dimension >& OpenGeodePolygonalSurface< dimension >::get_point(
         index_t vertex_id ) const
@@ -249,6 +292,13 @@ namespace geode
         impl_->remove_polygons( to_delete );
     }
 
+    template < index_t dimension >
+    void OpenGeodePolygonalSurface< dimension >::permute_polygons(
+        absl::Span< const index_t > permutation, OGPolygonalSurfaceKey )
+    {
+        impl_->permute_polygons( permutation );
+    }
+
     template < index_t dimension >
     void OpenGeodePolygonalSurface< dimension >::set_polygon_adjacent(
         const PolygonEdge& polygon_edge,
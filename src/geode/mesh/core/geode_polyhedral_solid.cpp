@@ -51,6 +51,25 @@ namespace geode
             polyhedron_adjacent_ptr_.emplace_back( 0 );
         }
 
+        MemoryUsage storage_memory_usage() const
+        {
+            using Storage = AttributeHeapMemory< std::vector< index_t > >;
+            MemoryUsage usage{ "polyhedron_storage", 0 };
+            usage.add_child( "polyhedron_vertices",
+                Storage::size( polyhedron_vertices_ ) );
+            usage.add_child( "polyhedron_vertex_ptr",
+                Storage::size( polyhedron_vertex_ptr_ ) );
+            usage.add_child(
+                "polyhedron_facets", Storage::size( polyhedron_facets_ ) );
+            usage.add_child( "polyhedron_facet_ptr",
+                Storage::size( polyhedron_facet_ptr_ ) );
+            usage.add_child( "polyhedron_adjacents",
+                Storage::size( polyhedron_adjacents_ ) );
+            usage.add_child( "polyhedron_adjacent_ptr",
+                Storage::size( polyhedron_adjacent_ptr_ ) );
+            return usage;
+        }
+
         index_t get_polyhedron_vertex(
             const PolyhedronVertex& polyhedron_vertex ) const
         {
@@ -210,6 +229,52 @@ namespace geode
                 polyhedron_facets_.end() );
         }
 
+        void permute_polyhedra( absl::Span< const index_t > permutation )
+        {
+            std::vector< index_t > vertices;
+            vertices.reserve( polyhedron_vertices_.size() );
+            std::vector< index_t > vertex_ptr;
+            vertex_ptr.reserve( polyhedron_vertex_ptr_.size() );
+            vertex_ptr.emplace_back( 0 );
+            std::vector< index_t > facets;
+            facets.reserve( polyhedron_facets_.size() );
+            std::vector< index_t > facet_ptr;
+            facet_ptr.reserve( polyhedron_facet_ptr_.size() );
+            facet_ptr.emplace_back( 0 );
+            std::vector< index_t > adjacents;
+            adjacents.reserve( polyhedron_adjacents_.size() );
+            std::vector< index_t > adjacent_ptr;
+            adjacent_ptr.reserve( polyhedron_adjacent_ptr_.size() );
+            adjacent_ptr.emplace_back( 0 );
+            for( const auto p : permutation )
+            {
+                vertices.insert( vertices.end(),
+                    polyhedron_vertices_.begin() + starting_vertex_index( p ),
+                    polyhedron_vertices_.begin()
+                        + starting_vertex_index( p + 1 ) );
+                vertex_ptr.push_back( vertices.size() );
+                for( const auto facet_id :
+                    Range{ starting_adjacent_index( p ),
+                        starting_adjacent_index( p + 1 ) } )
+                {
+                    facets.insert( facets.end(),
+                        polyhedron_facets_.begin()
+                            + starting_facet_index( facet_id ),
+                        polyhedron_facets_.begin()
+                            + starting_facet_index( facet_id + 1 ) );
+                    facet_ptr.push_back( facets.size() );
+                    adjacents.push_back( polyhedron_adjacents_[facet_id] );
+                }
+                adjacent_ptr.push_back( adjacents.size() );
+            }
+            polyhedron_vertices_ = std::move( vertices );
+            polyhedron_vertex_ptr_ = std::move( vertex_ptr );
+            polyhedron_facets_ = std::move( facets );
+            polyhedron_facet_ptr_ = std::move( facet_ptr );
+            polyhedron_adjacents_ = std::move( adjacents );
+            polyhedron_adjacent_ptr_ = std::move( adjacent_ptr );
+        }
+
     private:
         Impl() = default;
 
@@ -218,18 +283,12 @@ namespace geode
         {
             archive.ext( *this, DefaultGrowable< Archive, Impl >{},
                 []( Archive& archive, Impl& impl ) {
-                    archive.container4b( impl.polyhedron_vertices_,
-                        impl.polyhedron_vertices_.max_size() );
-                    archive.container4b( impl.polyhedron_vertex_ptr_,
-                        impl.polyhedron_vertex_ptr_.max_size() );
-                    archive.container4b( impl.polyhedron_facets_,
-                        impl.polyhedron_facets_.max_size() );
-                    archive.container4b( impl.polyhedron_facet_ptr_,
-                        impl.polyhedron_facet_ptr_.max_size() );
-                    archive.container4b( impl.polyhedron_adjacents_,
-                        impl.polyhedron_adjacents_.max_size() );
-                    archive.container4b( impl.polyhedron_adjacent_ptr_,
-                        impl.polyhedron_adjacent_ptr_.max_size() );
+                    serialize_indices( archive, impl.polyhedron_vertices_ );
+                    serialize_indices( archive, impl.polyhedron_vertex_ptr_ );
+                    serialize_indices( archive, impl.polyhedron_facets_ );
+                    serialize_indices( archive, impl.polyhedron_facet_ptr_ );
+                    serialize_indices( archive, impl.polyhedron_adjacents_ );
+                    serialize_indices( archive, impl.polyhedron_adjacent_ptr_ );
                     archive.ext(
                         impl, bitsery::ext::BaseClass<
                                   detail::PointsImpl< dimension > >{} );
@@ -287,6 +346,14 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    MemoryUsage OpenGeodePolyhedralSolid< dimension >::memory_usage() const
+    {
+        auto usage = PolyhedralSolid< dimension >::memory_usage();
+        usage.add_child( "polyhedron_storage", impl_->storage_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     const Point< dimension >& OpenGeodePolyhedralSolid< dimension >::get_point(
         index_t vertex_id ) const
@@ -371,6 +438,13 @@ namespace geode
         impl_->remove_polyhedra( to_delete );
     }
 
+    template < index_t dimension >
+    void OpenGeodePolyhedralSolid< dimension >::permute_polyhedra(
+        absl::Span< const index_t > permutation, OGPolyhedralSolidKey )
+    {
+        impl_->permute_polyhedra( permutation );
+    }
+
     template < index_t dimension >
     void OpenGeodePolyhedralSolid< dimension >::add_polyhedron(
         absl::Span< const index_t > vertices,
@@ -212,6 +212,13 @@ namespace geode
         return impl_->edge_attribute_manager();
     }
 
+    MemoryUsage Graph::memory_usage() const
+    {
+        auto usage = VertexSet::memory_usage();
+        usage.add_child( "edges", edge_attribute_manager().memory_usage() );
+        return usage;
+    }
+
     template < typename Archive >
     void Graph::serialize( Archive& archive )
     {
@@ -38,8 +38,10 @@ namespace geode
     {
     public:
         Impl( PolygonalSurfaceView< dimension >& surface_view,
-            const PolygonalSurface< dimension >& surface )
-            : detail::SurfaceMeshViewImpl< dimension >( surface_view, surface )
+            const PolygonalSurface< dimension >& surface,
+            MeshViewMapping mapping )
+            : detail::SurfaceMeshViewImpl< dimension >(
+                surface_view, surface, mapping )
         {
         }
     };
@@ -47,7 +49,14 @@ namespace geode
     template < index_t dimension >
     PolygonalSurfaceView< dimension >::PolygonalSurfaceView(
         const PolygonalSurface< dimension >& surface )
-        : impl_( *this, surface )
+        : PolygonalSurfaceView( surface, MeshViewMapping::sparse )
+    {
+    }
+
+    template < index_t dimension >
+    PolygonalSurfaceView< dimension >::PolygonalSurfaceView(
+        const PolygonalSurface< dimension >& surface, MeshViewMapping mapping )
+        : impl_( *this, surface, mapping )
     {
     }
 
@@ -63,6 +72,14 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    MemoryUsage PolygonalSurfaceView< dimension >::memory_usage() const
+    {
+        auto usage = PolygonalSurface< dimension >::memory_usage();
+        usage.add_child( "view_mappings", impl_->view_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     index_t PolygonalSurfaceView< dimension >::viewed_vertex(
         index_t vertex_id ) const
@@ -113,6 +130,13 @@ namespace geode
         return impl_->add_viewed_polygon( polygon_id );
     }
 
+    template < index_t dimension >
+    void PolygonalSurfaceView< dimension >::add_viewed_polygons(
+        absl::Span< const index_t > polygon_ids, PolygonalSurfaceViewKey )
+    {
+        impl_->add_viewed_polygons( polygon_ids );
+    }
+
     template < index_t dimension >
     index_t PolygonalSurfaceView< dimension >::get_nb_polygon_vertices(
         index_t polygon_id ) const
@@ -38,8 +38,10 @@ namespace geode
     {
     public:
         Impl( PolyhedralSolidView< dimension >& solid_view,
-            const PolyhedralSolid< dimension >& solid )
-            : detail::SolidMeshViewImpl< dimension >( solid_view, solid )
+            const PolyhedralSolid< dimension >& solid,
+            MeshViewMapping mapping )
+            : detail::SolidMeshViewImpl< dimension >(
+                solid_view, solid, mapping )
         {
         }
     };
@@ -47,7 +49,14 @@ namespace geode
     template < index_t dimension >
     PolyhedralSolidView< dimension >::PolyhedralSolidView(
         const PolyhedralSolid< dimension >& solid )
-        : impl_( *this, solid )
+        : PolyhedralSolidView( solid, MeshViewMapping::sparse )
+    {
+    }
+
+    template < index_t dimension >
+    PolyhedralSolidView< dimension >::PolyhedralSolidView(
+        const PolyhedralSolid< dimension >& solid, MeshViewMapping mapping )
+        : impl_( *this, solid, mapping )
     {
     }
 
@@ -63,6 +72,14 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    MemoryUsage PolyhedralSolidView< dimension >::memory_usage() const
+    {
+        auto usage = PolyhedralSolid< dimension >::memory_usage();
+        usage.add_child( "view_mappings", impl_->view_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     index_t PolyhedralSolidView< dimension >::viewed_vertex(
         index_t vertex_id ) const
@@ -113,6 +130,13 @@ namespace geode
         return impl_->add_viewed_polyhedron( polyhedron_id );
     }
 
+    template < index_t dimension >
+    void PolyhedralSolidView< dimension >::add_viewed_polyhedra(
+        absl::Span< const index_t > polyhedron_ids, PolyhedralSolidViewKey )
+    {
+        impl_->add_viewed_polyhedra( polyhedron_ids );
+    }
+
     template < index_t dimension >
     index_t PolyhedralSolidView< dimension >::get_nb_polyhedron_vertices(
         index_t polyhedron_id ) const
@@ -24,6 +24,7 @@
 #include <geode/mesh/core/regular_grid.h>
 
 #include <absl/container/inlined_vector.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/bitsery_archive.h>
@@ -206,7 +207,7 @@ namespace geode
                 []( Archive& archive, Impl& impl ) {
                     archive.object( impl.cell_attribute_manager_ );
                     archive.object( impl.origin_ );
-                    archive.container4b( impl.cells_number_ );
+                    serialize_indices( archive, impl.cells_number_ );
                     archive.container8b( impl.cells_size_ );
                 } );
         }
@@ -331,6 +332,14 @@ namespace geode
         return impl_->cell_attribute_manager();
     }
 
+    template < index_t dimension >
+    MemoryUsage RegularGrid< dimension >::memory_usage() const
+    {
+        MemoryUsage usage{ absl::StrCat( "RegularGrid", dimension, "D" ), 0 };
+        usage.add_child( "cells", cell_attribute_manager().memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void RegularGrid< dimension >::serialize( Archive& archive )
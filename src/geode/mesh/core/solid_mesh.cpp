@@ -38,6 +38,7 @@
 #include <geode/mesh/builder/solid_mesh_builder.h>
 #include <geode/mesh/core/bitsery_archive.h>
 #include <geode/mesh/core/detail/facet_storage.h>
+#include <geode/mesh/core/detail/vertices_bounding_box.h>
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polyhedral_solid.h>
 
@@ -338,6 +339,16 @@ namespace geode
             return Edges::facet_attribute_manager();
         }
 
+        MemoryUsage facets_memory_usage() const
+        {
+            return Facets::memory_usage();
+        }
+
+        MemoryUsage edges_memory_usage() const
+        {
+            return Edges::memory_usage();
+        }
+
         void overwrite_facets( const Facets& from )
         {
             Facets::overwrite( from );
@@ -348,6 +359,21 @@ namespace geode
             Edges::overwrite( from );
         }
 
+        bool is_metric_dirty( index_t metric_id ) const
+        {
+            return ( dirty_metrics_ & ( index_t{ 1 } << metric_id ) ) != 0;
+        }
+
+        void set_metric_clean( index_t metric_id ) const
+        {
+            dirty_metrics_ &= ~( index_t{ 1 } << metric_id );
+        }
+
+        void set_metrics_dirty()
+        {
+            dirty_metrics_ = ~index_t{ 0 };
+        }
+
     private:
         void convert_attribute_to_abseil()
         {
@@ -450,6 +476,7 @@ namespace geode
         mutable AttributeManager polyhedron_attribute_manager_;
         std::shared_ptr< VariableAttribute< PolyhedronVertex > >
             polyhedron_around_vertex_;
+        mutable index_t dirty_metrics_{ ~index_t{ 0 } };
     };
 
     template < index_t dimension >
@@ -1151,6 +1178,17 @@ namespace geode
         return impl_->polyhedron_attribute_manager();
     }
 
+    template < index_t dimension >
+    MemoryUsage SolidMesh< dimension >::memory_usage() const
+    {
+        auto usage = VertexSet::memory_usage();
+        usage.add_child(
+            "polyhedra", polyhedron_attribute_manager().memory_usage() );
+        usage.add_child( "facets", impl_->facets_memory_usage() );
+        usage.add_child( "edges", impl_->edges_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     const Point< dimension >& SolidMesh< dimension >::point(
         index_t vertex_id ) const
@@ -1183,12 +1221,25 @@ namespace geode
     template < index_t dimension >
     BoundingBox< dimension > SolidMesh< dimension >::bounding_box() const
     {
-        BoundingBox< dimension > box;
-        for( const auto p : Range{ nb_vertices() } )
-        {
-            box.add_point( point( p ) );
-        }
-        return box;
+        return detail::vertices_bounding_box( *this );
+    }
+
+    template < index_t dimension >
+    bool SolidMesh< dimension >::is_metric_dirty( index_t metric_id ) const
+    {
+        return impl_->is_metric_dirty( metric_id );
+    }
+
+    template < index_t dimension >
+    void SolidMesh< dimension >::set_metric_clean( index_t metric_id ) const
+    {
+        impl_->set_metric_clean( metric_id );
+    }
+
+    template < index_t dimension >
+    void SolidMesh< dimension >::set_metrics_dirty( SolidMeshKey )
+    {
+        impl_->set_metrics_dirty();
     }
 
     template class opengeode_mesh_api SolidMesh< 3 >;
@@ -38,6 +38,7 @@
 
 #include <geode/mesh/builder/surface_mesh_builder.h>
 #include <geode/mesh/core/detail/facet_storage.h>
+#include <geode/mesh/core/detail/vertices_bounding_box.h>
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polygonal_surface.h>
 
@@ -224,12 +225,32 @@ namespace geode
             return facet_attribute_manager();
         }
 
+        MemoryUsage edges_memory_usage() const
+        {
+            return this->memory_usage();
+        }
+
         void overwrite_edges(
             const detail::FacetStorage< std::array< index_t, 2 > >& from )
         {
             this->overwrite( from );
         }
 
+        bool is_metric_dirty( index_t metric_id ) const
+        {
+            return ( dirty_metrics_ & ( index_t{ 1 } << metric_id ) ) != 0;
+        }
+
+        void set_metric_clean( index_t metric_id ) const
+        {
+            dirty_metrics_ &= ~( index_t{ 1 } << metric_id );
+        }
+
+        void set_metrics_dirty()
+        {
+            dirty_metrics_ = ~index_t{ 0 };
+        }
+
     private:
         Impl() = default;
 
@@ -251,6 +272,7 @@ namespace geode
         mutable AttributeManager polygon_attribute_manager_;
         std::shared_ptr< VariableAttribute< PolygonVertex > >
             polygon_around_vertex_;
+        mutable index_t dirty_metrics_{ ~index_t{ 0 } };
     };
 
     template < index_t dimension >
@@ -731,6 +753,16 @@ namespace geode
         return impl_->polygon_attribute_manager();
     }
 
+    template < index_t dimension >
+    MemoryUsage SurfaceMesh< dimension >::memory_usage() const
+    {
+        auto usage = VertexSet::memory_usage();
+        usage.add_child(
+            "polygons", polygon_attribute_manager().memory_usage() );
+        usage.add_child( "edges", impl_->edges_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     const Point< dimension >& SurfaceMesh< dimension >::point(
         index_t vertex_id ) const
@@ -753,12 +785,25 @@ namespace geode
     template < index_t dimension >
     BoundingBox< dimension > SurfaceMesh< dimension >::bounding_box() const
     {
-        BoundingBox< dimension > box;
-        for( const auto p : Range{ nb_vertices() } )
-        {
-            box.add_point( point( p ) );
-        }
-        return box;
+        return detail::vertices_bounding_box( *this );
+    }
+
+    template < index_t dimension >
+    bool SurfaceMesh< dimension >::is_metric_dirty( index_t metric_id ) const
+    {
+        return impl_->is_metric_dirty( metric_id );
+    }
+
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::set_metric_clean( index_t metric_id ) const
+    {
+        impl_->set_metric_clean( metric_id );
+    }
+
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::set_metrics_dirty( SurfaceMeshKey )
+    {
+        impl_->set_metrics_dirty();
     }
 
     template < index_t dimension >
@@ -38,8 +38,10 @@ namespace geode
     {
     public:
         Impl( TetrahedralSolidView< dimension >& solid_view,
-            const TetrahedralSolid< dimension >& solid )
-            : detail::SolidMeshViewImpl< dimension >( solid_view, solid )
+            const TetrahedralSolid< dimension >& solid,
+            MeshViewMapping mapping )
+            : detail::SolidMeshViewImpl< dimension >(
+                solid_view, solid, mapping )
         {
         }
     };
@@ -47,7 +49,14 @@ namespace geode
     template < index_t dimension >
     TetrahedralSolidView< dimension >::TetrahedralSolidView(
         const TetrahedralSolid< dimension >& solid )
-        : impl_( *this, solid )
+        : TetrahedralSolidView( solid, MeshViewMapping::sparse )
+    {
+    }
+
+    template < index_t dimension >
+    TetrahedralSolidView< dimension >::TetrahedralSolidView(
+        const TetrahedralSolid< dimension >& solid, MeshViewMapping mapping )
+        : impl_( *this, solid, mapping )
     {
     }
 
@@ -63,6 +72,14 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    MemoryUsage TetrahedralSolidView< dimension >::memory_usage() const
+    {
+        auto usage = TetrahedralSolid< dimension >::memory_usage();
+        usage.add_child( "view_mappings", impl_->view_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     index_t TetrahedralSolidView< dimension >::viewed_vertex(
         index_t vertex_id ) const
@@ -113,6 +130,13 @@ namespace geode
         return impl_->add_viewed_polyhedron( polyhedron_id );
     }
 
+    template < index_t dimension >
+    void TetrahedralSolidView< dimension >::add_viewed_tetrahedra(
+        absl::Span< const index_t > tetrahedron_ids, TetrahedralSolidViewKey )
+    {
+        impl_->add_viewed_polyhedra( tetrahedron_ids );
+    }
+
     template < index_t dimension >
     index_t TetrahedralSolidView< dimension >::get_polyhedron_facet(
         const PolyhedronFacet& polyhedron_facet ) const
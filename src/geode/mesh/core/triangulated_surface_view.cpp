@@ -38,8 +38,10 @@ namespace geode
     {
     public:
         Impl( TriangulatedSurfaceView< dimension >& surface_view,
-            const TriangulatedSurface< dimension >& surface )
-            : detail::SurfaceMeshViewImpl< dimension >( surface_view, surface )
+            const TriangulatedSurface< dimension >& surface,
+            MeshViewMapping mapping )
+            : detail::SurfaceMeshViewImpl< dimension >(
+                surface_view, surface, mapping )
         {
         }
     };
@@ -47,7 +49,15 @@ namespace geode
     template < index_t dimension >
     TriangulatedSurfaceView< dimension >::TriangulatedSurfaceView(
         const TriangulatedSurface< dimension >& surface )
-        : impl_( *this, surface )
+        : TriangulatedSurfaceView( surface, MeshViewMapping::sparse )
+    {
+    }
+
+    template < index_t dimension >
+    TriangulatedSurfaceView< dimension >::TriangulatedSurfaceView(
+        const TriangulatedSurface< dimension >& surface,
+        MeshViewMapping mapping )
+        : impl_( *this, surface, mapping )
     {
     }
 
@@ -63,6 +73,14 @@ namespace geode
     {
     }
 
+    template < index_t dimension >
+    MemoryUsage TriangulatedSurfaceView< dimension >::memory_usage() const
+    {
+        auto usage = TriangulatedSurface< dimension >::memory_usage();
+        usage.add_child( "view_mappings", impl_->view_memory_usage() );
+        return usage;
+    }
+
     template < index_t dimension >
     index_t TriangulatedSurfaceView< dimension >::viewed_vertex(
         index_t vertex_id ) const
@@ -113,6 +131,13 @@ namespace geode
         return impl_->add_viewed_polygon( triangle_id );
     }
 
+    template < index_t dimension >
+    void TriangulatedSurfaceView< dimension >::add_viewed_triangles(
+        absl::Span< const index_t > triangle_ids, TriangulatedSurfaceViewKey )
+    {
+        impl_->add_viewed_polygons( triangle_ids );
+    }
+
     template < index_t dimension >
     index_t TriangulatedSurfaceView< dimension >::get_polygon_edge(
         const PolygonEdge& polygon_edge ) const
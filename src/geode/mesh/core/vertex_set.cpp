@@ -85,6 +85,14 @@ namespace geode
         return impl_->vertex_attribute_manager();
     }
 
+    MemoryUsage VertexSet::memory_usage() const
+    {
+        MemoryUsage usage{ impl_name().get(), 0 };
+        usage.add_child(
+            "vertices", vertex_attribute_manager().memory_usage() );
+        return usage;
+    }
+
     template < typename Archive >
     void VertexSet::serialize( Archive& archive )
     {
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/core/detail/vertices_bounding_box.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/geometry/bounding_box.h>
+
+#include <geode/mesh/core/solid_mesh.h>
+#include <geode/mesh/core/surface_mesh.h>
+
+namespace geode
+{
+    namespace detail
+    {
+        template < index_t dimension, template < index_t > class Mesh >
+        BoundingBox< dimension > vertices_bounding_box(
+            const Mesh< dimension >& mesh )
+        {
+            static constexpr index_t CHUNK_SIZE{ 4096 };
+            const auto nb_vertices = mesh.nb_vertices();
+            const auto nb_chunks =
+                ( nb_vertices + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+            std::vector< BoundingBox< dimension > > boxes( nb_chunks );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [&mesh, &boxes, nb_vertices]( index_t chunk ) {
+                    const auto end =
+                        std::min( nb_vertices, ( chunk + 1 ) * CHUNK_SIZE );
+                    for( auto v = chunk * CHUNK_SIZE; v < end; v++ )
+                    {
+                        boxes[chunk].add_point( mesh.point( v ) );
+                    }
+                } );
+            BoundingBox< dimension > box;
+            for( const auto& chunk_box : boxes )
+            {
+                box.add_box( chunk_box );
+            }
+            return box;
+        }
+
+        template BoundingBox< 2 > vertices_bounding_box(
+            const SurfaceMesh< 2 >& );
+        template BoundingBox< 3 > vertices_bounding_box(
+            const SurfaceMesh< 3 >& );
+        template BoundingBox< 3 > vertices_bounding_box(
+            const SolidMesh< 3 >& );
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/aabb_solid_helpers.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <absl/container/fixed_array.h>
+
+#include <async++.h>
+
+#include <geode/geometry/aabb.h>
+#include <geode/geometry/barycentric_coordinates.h>
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/bounding_box.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/predicates.h>
+#include <geode/geometry/signed_mensuration.h>
+
+#include <geode/mesh/core/solid_mesh.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+
+namespace
+{
+    geode::Tetra mesh_tetra(
+        const geode::TetrahedralSolid3D& mesh, geode::index_t tetrahedron )
+    {
+        return { mesh.point( mesh.polyhedron_vertex( { tetrahedron, 0 } ) ),
+            mesh.point( mesh.polyhedron_vertex( { tetrahedron, 1 } ) ),
+            mesh.point( mesh.polyhedron_vertex( { tetrahedron, 2 } ) ),
+            mesh.point( mesh.polyhedron_vertex( { tetrahedron, 3 } ) ) };
+    }
+
+    double facet_signed_volume( const geode::TetrahedralSolid3D& mesh,
+        const geode::PolyhedronFacet& facet,
+        const geode::Point3D& point )
+    {
+        return geode::tetra_signed_volume(
+            { mesh.point( mesh.polyhedron_facet_vertex( { facet, 0 } ) ),
+                mesh.point( mesh.polyhedron_facet_vertex( { facet, 1 } ) ),
+                mesh.point( mesh.polyhedron_facet_vertex( { facet, 2 } ) ),
+                point } );
+    }
+
+    geode::Side facet_side( const geode::TetrahedralSolid3D& mesh,
+        const geode::PolyhedronFacet& facet,
+        const geode::Point3D& point )
+    {
+        return geode::orient3d(
+            mesh.point( mesh.polyhedron_facet_vertex( { facet, 0 } ) ),
+            mesh.point( mesh.polyhedron_facet_vertex( { facet, 1 } ) ),
+            mesh.point( mesh.polyhedron_facet_vertex( { facet, 2 } ) ),
+            point );
+    }
+
+    class ContainingTetrahedron
+    {
+    public:
+        ContainingTetrahedron( const geode::TetrahedralSolid3D& mesh,
+            const geode::Point3D& query,
+            double tolerance )
+            : mesh_( mesh ), query_( query ), tolerance_( tolerance )
+        {
+        }
+
+        void operator()( geode::index_t tetrahedron )
+        {
+            if( best_depth_ > 0 )
+            {
+                // Strictly inside a tetrahedron of a valid mesh: no other
+                // tetrahedron can contain the point
+                return;
+            }
+            const auto tetra = mesh_tetra( mesh_, tetrahedron );
+            if( std::fabs( geode::tetra_signed_volume( tetra ) )
+                <= geode::global_epsilon3 )
+            {
+                return;
+            }
+            const auto coordinates =
+                geode::tetra_barycentric_coordinates( query_, tetra );
+            const auto depth =
+                *std::min_element( coordinates.begin(), coordinates.end() );
+            if( depth < -tolerance_ || depth <= best_depth_ )
+            {
+                return;
+            }
+            best_depth_ = depth;
+            location_.polyhedron = tetrahedron;
+            location_.barycentric_coordinates = coordinates;
+        }
+
+        absl::optional< geode::PolyhedronLocation > location() const
+        {
+            if( location_.polyhedron == geode::NO_ID )
+            {
+                return absl::nullopt;
+            }
+            return location_;
+        }
+
+    private:
+        const geode::TetrahedralSolid3D& mesh_;
+        const geode::Point3D& query_;
+        const double tolerance_;
+        double best_depth_{ std::numeric_limits< double >::lowest() };
+        geode::PolyhedronLocation location_;
+    };
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    AABBTree< dimension > create_aabb_tree(
+        const SolidMesh< dimension >& mesh )
+    {
+        absl::FixedArray< BoundingBox< dimension > > box_vector(
+            mesh.nb_polyhedra() );
+        async::parallel_for( async::irange( index_t{ 0 }, mesh.nb_polyhedra() ),
+            [&box_vector, &mesh]( index_t p ) {
+                for( const auto v : Range{ mesh.nb_polyhedron_vertices( p ) } )
+                {
+                    box_vector[p].add_point(
+                        mesh.point( mesh.polyhedron_vertex( { p, v } ) ) );
+                }
+            } );
+        return AABBTree< dimension >{ box_vector };
+    }
+
+    absl::optional< PolyhedronLocation > containing_polyhedron(
+        const AABBTree3D& tree,
+        const TetrahedralSolid3D& mesh,
+        const Point3D& point,
+        double tolerance )
+    {
+        OPENGEODE_EXCEPTION( tree.nb_bboxes() == mesh.nb_polyhedra(),
+            "[containing_polyhedron] AABBTree should be built on the given "
+            "mesh" );
+        if( tree.nb_bboxes() == 0 )
+        {
+            return absl::nullopt;
+        }
+        ContainingTetrahedron action{ mesh, point, tolerance };
+        BoundingBox3D box;
+        box.add_point( point );
+        tree.compute_bbox_element_bbox_intersections( box, action );
+        return action.location();
+    }
+
+    std::vector< absl::optional< PolyhedronLocation > > containing_polyhedra(
+        const AABBTree3D& tree,
+        const TetrahedralSolid3D& mesh,
+        absl::Span< const Point3D > points,
+        double tolerance )
+    {
+        OPENGEODE_EXCEPTION( tree.nb_bboxes() == mesh.nb_polyhedra(),
+            "[containing_polyhedra] AABBTree should be built on the given "
+            "mesh" );
+        std::vector< absl::optional< PolyhedronLocation > > locations(
+            points.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, points.size() ),
+            [&locations, &tree, &mesh, &points, tolerance]( size_t p ) {
+                locations[p] =
+                    containing_polyhedron( tree, mesh, points[p], tolerance );
+            } );
+        return locations;
+    }
+
+    TetrahedralSolidLocator::TetrahedralSolidLocator(
+        const TetrahedralSolid3D& mesh,
+        const AABBTree3D& tree,
+        index_t max_steps )
+        : mesh_( mesh ), tree_( tree ), max_steps_( max_steps )
+    {
+        OPENGEODE_EXCEPTION( tree.nb_bboxes() == mesh.nb_polyhedra(),
+            "[TetrahedralSolidLocator] AABBTree should be built on the given "
+            "mesh" );
+    }
+
+    absl::optional< PolyhedronLocation > TetrahedralSolidLocator::locate(
+        const Point3D& point, Hint& hint, double tolerance ) const
+    {
+        absl::optional< PolyhedronLocation > location;
+        if( hint.tetrahedron < mesh_.nb_polyhedra() )
+        {
+            location = walk( point, hint.tetrahedron, tolerance );
+        }
+        if( !location )
+        {
+            location = containing_polyhedron( tree_, mesh_, point, tolerance );
+        }
+        if( location )
+        {
+            hint.tetrahedron = location->polyhedron;
+        }
+        return location;
+    }
+
+    absl::optional< PolyhedronLocation > TetrahedralSolidLocator::walk(
+        const Point3D& point, index_t start, double tolerance ) const
+    {
+        auto current = start;
+        for( const auto step : Range{ max_steps_ } )
+        {
+            std::array< double, 4 > volumes;
+            double total_volume{ 0 };
+            for( const auto f : Range{ 4 } )
+            {
+                volumes[f] =
+                    facet_signed_volume( mesh_, { current, f }, point );
+                total_volume += volumes[f];
+            }
+            if( std::fabs( total_volume ) <= global_epsilon3 )
+            {
+                return absl::nullopt;
+            }
+            // Rotate the first tested facet to avoid cycling, and only cross
+            // facets that exactly separate the point from the tetrahedron
+            const auto outside =
+                total_volume > 0 ? Side::negative : Side::positive;
+            index_t exit{ NO_ID };
+            for( const auto i : Range{ 4 } )
+            {
+                const auto f = ( step + i ) % 4;
+                if( volumes[f] / total_volume < -tolerance
+                    && facet_side( mesh_, { current, f }, point ) == outside )
+                {
+                    exit = f;
+                    break;
+                }
+            }
+            if( exit == NO_ID )
+            {
+                PolyhedronLocation location;
+                location.polyhedron = current;
+                location.barycentric_coordinates =
+                    tetra_barycentric_coordinates(
+                        point, mesh_tetra( mesh_, current ) );
+                return location;
+            }
+            const auto adjacent =
+                mesh_.polyhedron_adjacent( { current, exit } );
+            if( !adjacent )
+            {
+                return absl::nullopt;
+            }
+            current = adjacent.value();
+        }
+        return absl::nullopt;
+    }
+
+    template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
+        const SolidMesh3D& );
+} // namespace geode
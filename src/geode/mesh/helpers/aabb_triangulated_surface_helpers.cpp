@@ -33,6 +33,7 @@
 
 #include <geode/geometry/aabb.h>
 #include <geode/geometry/basic_objects.h>
+#include <geode/geometry/batch_distance.h>
 #include <geode/geometry/distance.h>
 #include <geode/geometry/point.h>
 #include <geode/geometry/vector.h>
@@ -68,6 +69,25 @@ namespace geode
             query, Triangle< dimension >{ v0, v1, v2 } );
     }
 
+    template < index_t dimension >
+    void DistanceToTriangles< dimension >::operator()(
+        const Point< dimension >& query,
+        absl::Span< const index_t > boxes,
+        absl::Span< double > distances ) const
+    {
+        TriangleBatch< dimension > triangles;
+        triangles.resize( static_cast< index_t >( boxes.size() ) );
+        for( const auto b : Range{ boxes.size() } )
+        {
+            for( const auto v : Range{ 3 } )
+            {
+                triangles.set_vertex( b, v,
+                    mesh_.point( mesh_.polygon_vertex( { boxes[b], v } ) ) );
+            }
+        }
+        point_triangles_distances( query, triangles, distances );
+    }
+
     template opengeode_mesh_api AABBTree2D create_aabb_tree< 2 >(
         const TriangulatedSurface2D& );
     template opengeode_mesh_api AABBTree3D create_aabb_tree< 3 >(
@@ -75,5 +95,7 @@ namespace geode
 
     template class opengeode_mesh_api DistanceToTriangle< 2 >;
     template class opengeode_mesh_api DistanceToTriangle< 3 >;
+    template class opengeode_mesh_api DistanceToTriangles< 2 >;
+    template class opengeode_mesh_api DistanceToTriangles< 3 >;
 
 } // namespace geode
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/mesh_metrics.h>
+
+#include <absl/strings/str_cat.h>
+
+#include <async++.h>
+
+#include <geode/basic/attribute_manager.h>
+
+#include <geode/geometry/point.h>
+#include <geode/geometry/vector.h>
+
+#include <geode/mesh/core/solid_mesh.h>
+#include <geode/mesh/core/surface_mesh.h>
+
+namespace
+{
+    /*!
+     * Cached metric: its identifier in the mesh dirty flags, unique per mesh
+     * type, and its attribute name.
+     */
+    struct Metric
+    {
+        Metric( geode::index_t id_in, absl::string_view name_in )
+            : id( id_in ),
+              name( absl::StrCat( geode::metric_attribute_prefix, name_in ) )
+        {
+        }
+
+        geode::index_t id;
+        std::string name;
+    };
+
+    const Metric POLYGON_AREA{ 0, "polygon_area" };
+    const Metric POLYGON_BARYCENTER{ 1, "polygon_barycenter" };
+    const Metric SURFACE_EDGE_LENGTH{ 2, "edge_length" };
+
+    const Metric POLYHEDRON_BARYCENTER{ 0, "polyhedron_barycenter" };
+    const Metric FACET_NORMAL{ 1, "facet_normal" };
+    const Metric SOLID_EDGE_LENGTH{ 2, "edge_length" };
+
+    /*!
+     * Return the cached metric if it is up to date, otherwise compute it in
+     * parallel over all the elements and cache it.
+     */
+    template < typename T, typename Mesh, typename Computer >
+    std::shared_ptr< geode::VariableAttribute< T > > cached_metric(
+        const Mesh& mesh,
+        geode::AttributeManager& manager,
+        const Metric& metric,
+        const Computer& compute )
+    {
+        const auto exists = manager.attribute_exists( metric.name );
+        auto attribute = manager.find_or_create_attribute<
+            geode::VariableAttribute, T >( metric.name, T{} );
+        if( !exists || mesh.is_metric_dirty( metric.id ) )
+        {
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, manager.nb_elements() ),
+                [&attribute, &compute]( geode::index_t e ) {
+                    attribute->set_value( e, compute( e ) );
+                } );
+            mesh.set_metric_clean( metric.id );
+        }
+        return attribute;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > polygon_areas(
+        const SurfaceMesh< dimension >& mesh )
+    {
+        return cached_metric< double >( mesh,
+            mesh.polygon_attribute_manager(), POLYGON_AREA,
+            [&mesh]( index_t p ) { return mesh.polygon_area( p ); } );
+    }
+
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< Point< dimension > > >
+        polygon_barycenters( const SurfaceMesh< dimension >& mesh )
+    {
+        return cached_metric< Point< dimension > >( mesh,
+            mesh.polygon_attribute_manager(), POLYGON_BARYCENTER,
+            [&mesh]( index_t p ) { return mesh.polygon_barycenter( p ); } );
+    }
+
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > edge_lengths(
+        const SurfaceMesh< dimension >& mesh )
+    {
+        return cached_metric< double >( mesh, mesh.edge_attribute_manager(),
+            SURFACE_EDGE_LENGTH,
+            [&mesh]( index_t e ) { return mesh.edge_length( e ); } );
+    }
+
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > edge_lengths(
+        const SolidMesh< dimension >& mesh )
+    {
+        return cached_metric< double >( mesh, mesh.edge_attribute_manager(),
+            SOLID_EDGE_LENGTH,
+            [&mesh]( index_t e ) { return mesh.edge_length( e ); } );
+    }
+
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< Point< dimension > > >
+        polyhedron_barycenters( const SolidMesh< dimension >& mesh )
+    {
+        return cached_metric< Point< dimension > >( mesh,
+            mesh.polyhedron_attribute_manager(), POLYHEDRON_BARYCENTER,
+            [&mesh]( index_t p ) { return mesh.polyhedron_barycenter( p ); } );
+    }
+
+    std::shared_ptr< VariableAttribute< Point3D > > facet_normals(
+        const SolidMesh3D& mesh )
+    {
+        return cached_metric< Point3D >( mesh,
+            mesh.facet_attribute_manager(), FACET_NORMAL,
+            [&mesh]( index_t f ) { return mesh.facet_normal( f ); } );
+    }
+
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api polygon_areas( const SurfaceMesh2D& );
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api polygon_areas( const SurfaceMesh3D& );
+    template std::shared_ptr< VariableAttribute< Point2D > >
+        opengeode_mesh_api polygon_barycenters( const SurfaceMesh2D& );
+    template std::shared_ptr< VariableAttribute< Point3D > >
+        opengeode_mesh_api polygon_barycenters( const SurfaceMesh3D& );
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api edge_lengths( const SurfaceMesh2D& );
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api edge_lengths( const SurfaceMesh3D& );
+
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api edge_lengths( const SolidMesh3D& );
+    template std::shared_ptr< VariableAttribute< Point3D > >
+        opengeode_mesh_api polyhedron_barycenters( const SolidMesh3D& );
+} // namespace geode
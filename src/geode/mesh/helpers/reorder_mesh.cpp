@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/reorder_mesh.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include <absl/algorithm/container.h>
+
+#include <async++.h>
+
+#include <geode/geometry/hilbert_sort.h>
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/core/solid_mesh.h>
+#include <geode/mesh/core/surface_mesh.h>
+
+namespace
+{
+    template < geode::index_t dimension, typename Mesh >
+    std::vector< geode::index_t > vertex_ordering( const Mesh& mesh )
+    {
+        std::vector< geode::Point< dimension > > points( mesh.nb_vertices() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_vertices() ),
+            [&points, &mesh]( geode::index_t v ) {
+                points[v] = mesh.point( v );
+            } );
+        return geode::hilbert_sort< dimension >( points );
+    }
+
+    template < geode::index_t dimension >
+    std::vector< geode::index_t > polygon_ordering(
+        const geode::SurfaceMesh< dimension >& surface )
+    {
+        std::vector< geode::Point< dimension > > barycenters(
+            surface.nb_polygons() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, surface.nb_polygons() ),
+            [&barycenters, &surface]( geode::index_t p ) {
+                barycenters[p] = surface.polygon_barycenter( p );
+            } );
+        return geode::hilbert_sort< dimension >( barycenters );
+    }
+
+    template < typename Mesh >
+    std::vector< geode::index_t > cuthill_mckee_ordering( const Mesh& mesh )
+    {
+        const auto nb_vertices = mesh.nb_vertices();
+        std::vector< geode::index_t > degrees( nb_vertices, 0 );
+        for( const auto e : geode::Range{ mesh.nb_edges() } )
+        {
+            for( const auto v : mesh.edge_vertices( e ) )
+            {
+                degrees[v]++;
+            }
+        }
+        std::vector< geode::index_t > ptr( nb_vertices + 1, 0 );
+        std::partial_sum( degrees.begin(), degrees.end(), ptr.begin() + 1 );
+        std::vector< geode::index_t > neighbors( ptr.back() );
+        std::vector< geode::index_t > filled( ptr.begin(), ptr.end() - 1 );
+        for( const auto e : geode::Range{ mesh.nb_edges() } )
+        {
+            const auto& vertices = mesh.edge_vertices( e );
+            neighbors[filled[vertices[0]]++] = vertices[1];
+            neighbors[filled[vertices[1]]++] = vertices[0];
+        }
+        const auto by_degree = [&degrees](
+                                   geode::index_t v0, geode::index_t v1 ) {
+            return degrees[v0] < degrees[v1];
+        };
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_vertices ),
+            [&neighbors, &ptr, &by_degree]( geode::index_t v ) {
+                std::sort( neighbors.begin() + ptr[v],
+                    neighbors.begin() + ptr[v + 1], by_degree );
+            } );
+
+        std::vector< geode::index_t > starts( nb_vertices );
+        absl::c_iota( starts, 0 );
+        absl::c_stable_sort( starts, by_degree );
+        std::vector< bool > visited( nb_vertices, false );
+        std::vector< geode::index_t > ordering;
+        ordering.reserve( nb_vertices );
+        for( const auto start : starts )
+        {
+            if( visited[start] )
+            {
+                continue;
+            }
+            visited[start] = true;
+            ordering.push_back( start );
+            for( auto head = ordering.size() - 1; head < ordering.size();
+                 head++ )
+            {
+                const auto v = ordering[head];
+                for( const auto n : geode::Range{ ptr[v], ptr[v + 1] } )
+                {
+                    const auto neighbor = neighbors[n];
+                    if( !visited[neighbor] )
+                    {
+                        visited[neighbor] = true;
+                        ordering.push_back( neighbor );
+                    }
+                }
+            }
+        }
+        absl::c_reverse( ordering );
+        return ordering;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    std::vector< index_t > hilbert_vertex_ordering(
+        const SurfaceMesh< dimension >& surface )
+    {
+        return vertex_ordering< dimension >( surface );
+    }
+
+    std::vector< index_t > hilbert_vertex_ordering( const SolidMesh3D& solid )
+    {
+        return vertex_ordering< 3 >( solid );
+    }
+
+    template < index_t dimension >
+    std::vector< index_t > hilbert_polygon_ordering(
+        const SurfaceMesh< dimension >& surface )
+    {
+        return polygon_ordering( surface );
+    }
+
+    std::vector< index_t > hilbert_polyhedron_ordering(
+        const SolidMesh3D& solid )
+    {
+        std::vector< Point3D > barycenters( solid.nb_polyhedra() );
+        async::parallel_for(
+            async::irange( index_t{ 0 }, solid.nb_polyhedra() ),
+            [&barycenters, &solid]( index_t p ) {
+                barycenters[p] = solid.polyhedron_barycenter( p );
+            } );
+        return hilbert_sort< 3 >( barycenters );
+    }
+
+    template < index_t dimension >
+    std::vector< index_t > reverse_cuthill_mckee_vertex_ordering(
+        const SurfaceMesh< dimension >& surface )
+    {
+        return cuthill_mckee_ordering( surface );
+    }
+
+    std::vector< index_t > reverse_cuthill_mckee_vertex_ordering(
+        const SolidMesh3D& solid )
+    {
+        return cuthill_mckee_ordering( solid );
+    }
+
+    template std::vector< index_t > opengeode_mesh_api hilbert_vertex_ordering(
+        const SurfaceMesh2D& );
+    template std::vector< index_t > opengeode_mesh_api hilbert_vertex_ordering(
+        const SurfaceMesh3D& );
+
+    template std::vector< index_t > opengeode_mesh_api
+        hilbert_polygon_ordering( const SurfaceMesh2D& );
+    template std::vector< index_t > opengeode_mesh_api
+        hilbert_polygon_ordering( const SurfaceMesh3D& );
+
+    template std::vector< index_t > opengeode_mesh_api
+        reverse_cuthill_mckee_vertex_ordering( const SurfaceMesh2D& );
+    template std::vector< index_t > opengeode_mesh_api
+        reverse_cuthill_mckee_vertex_ordering( const SurfaceMesh3D& );
+} // namespace geode
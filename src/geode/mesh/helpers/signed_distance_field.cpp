@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/signed_distance_field.h>
+
+#include <cmath>
+#include <limits>
+
+#include <async++.h>
+
+#include <geode/basic/attribute_manager.h>
+
+#include <geode/geometry/aabb.h>
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/bounding_box.h>
+#include <geode/geometry/distance.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/vector.h>
+
+#include <geode/mesh/core/regular_grid.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/helpers/aabb_triangulated_surface_helpers.h>
+
+namespace
+{
+    /*!
+     * Regular set of points where the distance is evaluated, indexed like
+     * RegularGrid cells: x first, then y, then z.
+     */
+    struct SampleGrid
+    {
+        geode::index_t size() const
+        {
+            return counts[0] * counts[1] * counts[2];
+        }
+
+        geode::index_t index(
+            geode::index_t i, geode::index_t j, geode::index_t k ) const
+        {
+            return i + counts[0] * ( j + counts[1] * k );
+        }
+
+        geode::Point3D point(
+            geode::index_t i, geode::index_t j, geode::index_t k ) const
+        {
+            return origin
+                   + geode::Point3D{ { i * spacing[0], j * spacing[1],
+                       k * spacing[2] } };
+        }
+
+        geode::Point3D origin;
+        std::array< geode::index_t, 3 > counts;
+        std::array< double, 3 > spacing;
+    };
+
+    class NearTriangle
+    {
+    public:
+        void operator()( geode::index_t /*unused*/ )
+        {
+            found_ = true;
+        }
+
+        bool found() const
+        {
+            return found_;
+        }
+
+    private:
+        bool found_{ false };
+    };
+
+    /*!
+     * Signed distance to a closed surface. The sign is given by the angle
+     * weighted pseudo normal of the closest feature (triangle, edge or
+     * vertex), which is robust when the closest point is on an edge or a
+     * vertex.
+     */
+    class SignedDistance
+    {
+    public:
+        explicit SignedDistance( const geode::TriangulatedSurface3D& surface )
+            : surface_( surface ),
+              tree_( geode::create_aabb_tree( surface ) ),
+              distance_( surface ),
+              triangle_normals_( surface.nb_polygons() ),
+              edge_normals_( surface.nb_edges() ),
+              vertex_normals_( surface.nb_vertices() )
+        {
+            compute_pseudo_normals();
+        }
+
+        double operator()( const geode::Point3D& query ) const
+        {
+            geode::index_t triangle;
+            geode::Point3D nearest;
+            double distance;
+            std::tie( triangle, nearest, distance ) =
+                tree_.closest_element_box( query, distance_ );
+            const geode::Vector3D direction{ nearest, query };
+            return direction.dot( pseudo_normal( triangle, nearest ) ) < 0
+                       ? -distance
+                       : distance;
+        }
+
+        bool is_near( const geode::Point3D& query, double band ) const
+        {
+            const geode::Point3D offset{ { band, band, band } };
+            geode::BoundingBox3D box;
+            box.add_point( query - offset );
+            box.add_point( query + offset );
+            NearTriangle action;
+            tree_.compute_bbox_element_bbox_intersections( box, action );
+            return action.found();
+        }
+
+    private:
+        void compute_pseudo_normals()
+        {
+            for( const auto t : geode::Range{ surface_.nb_polygons() } )
+            {
+                std::array< geode::index_t, 3 > vertices;
+                for( const auto v : geode::Range{ 3 } )
+                {
+                    vertices[v] = surface_.polygon_vertex( { t, v } );
+                }
+                const auto& p0 = surface_.point( vertices[0] );
+                const auto& p1 = surface_.point( vertices[1] );
+                const auto& p2 = surface_.point( vertices[2] );
+                const auto normal =
+                    geode::Vector3D{ p0, p1 }.cross( { p0, p2 } );
+                const auto length = normal.length();
+                if( length <= geode::global_epsilon2 )
+                {
+                    continue;
+                }
+                triangle_normals_[t] = normal / length;
+                for( const auto v : geode::Range{ 3 } )
+                {
+                    const auto& corner = surface_.point( vertices[v] );
+                    const auto next =
+                        geode::Vector3D{ corner,
+                            surface_.point( vertices[( v + 1 ) % 3] ) }
+                            .normalize();
+                    const auto previous =
+                        geode::Vector3D{ corner,
+                            surface_.point( vertices[( v + 2 ) % 3] ) }
+                            .normalize();
+                    const auto cosine =
+                        std::max( -1., std::min( 1., next.dot( previous ) ) );
+                    vertex_normals_[vertices[v]] =
+                        vertex_normals_[vertices[v]]
+                        + triangle_normals_[t] * std::acos( cosine );
+                    const auto edge = surface_.polygon_edge( { t, v } );
+                    edge_normals_[edge] =
+                        edge_normals_[edge] + triangle_normals_[t];
+                }
+            }
+        }
+
+        const geode::Vector3D& pseudo_normal(
+            geode::index_t triangle, const geode::Point3D& nearest ) const
+        {
+            for( const auto v : geode::Range{ 3 } )
+            {
+                const auto vertex =
+                    surface_.polygon_vertex( { triangle, v } );
+                if( surface_.point( vertex ).inexact_equal(
+                        nearest, geode::global_epsilon ) )
+                {
+                    return vertex_normals_[vertex];
+                }
+            }
+            for( const auto e : geode::Range{ 3 } )
+            {
+                const auto& p0 = surface_.point(
+                    surface_.polygon_vertex( { triangle, e } ) );
+                const auto& p1 = surface_.point(
+                    surface_.polygon_vertex( { triangle, ( e + 1 ) % 3 } ) );
+                if( std::get< 0 >( geode::point_segment_distance(
+                        nearest, geode::Segment3D{ p0, p1 } ) )
+                    <= geode::global_epsilon )
+                {
+                    return edge_normals_[surface_.polygon_edge(
+                        { triangle, e } )];
+                }
+            }
+            return triangle_normals_[triangle];
+        }
+
+    private:
+        const geode::TriangulatedSurface3D& surface_;
+        geode::AABBTree3D tree_;
+        geode::DistanceToTriangle< 3 > distance_;
+        std::vector< geode::Vector3D > triangle_normals_;
+        std::vector< geode::Vector3D > edge_normals_;
+        std::vector< geode::Vector3D > vertex_normals_;
+    };
+
+    void check_narrow_band( const SampleGrid& samples, double narrow_band )
+    {
+        if( narrow_band <= 0 )
+        {
+            return;
+        }
+        const auto max_spacing = std::max(
+            std::max( samples.spacing[0], samples.spacing[1] ),
+            samples.spacing[2] );
+        OPENGEODE_EXCEPTION( narrow_band >= 2 * max_spacing,
+            "[compute_signed_distances] Narrow band should be at least twice "
+            "the largest cell size" );
+    }
+
+    /*!
+     * Give +/- narrow_band to the samples that were not evaluated.
+     * Signs are flooded from evaluated samples farther from the surface than
+     * the sample spacing: their neighbors cannot be on the other side of the
+     * surface. Regions without such a sample get the sign of one evaluation.
+     */
+    void propagate_signs( const SampleGrid& samples,
+        const SignedDistance& distance,
+        double narrow_band,
+        std::vector< double >& values )
+    {
+        const auto max_spacing = std::max(
+            std::max( samples.spacing[0], samples.spacing[1] ),
+            samples.spacing[2] );
+        std::vector< geode::index_t > to_flood;
+        const auto flood = [&samples, &values, &to_flood, narrow_band] {
+            while( !to_flood.empty() )
+            {
+                const auto id = to_flood.back();
+                to_flood.pop_back();
+                const auto i = id % samples.counts[0];
+                const auto j = ( id / samples.counts[0] ) % samples.counts[1];
+                const auto k = id / ( samples.counts[0] * samples.counts[1] );
+                const std::array< geode::index_t, 3 > index{ { i, j, k } };
+                for( const auto d : geode::Range{ 3 } )
+                {
+                    for( const auto offset : { -1, 1 } )
+                    {
+                        auto neighbor = index;
+                        if( ( offset < 0 && index[d] == 0 )
+                            || ( offset > 0
+                                 && index[d] + 1 == samples.counts[d] ) )
+                        {
+                            continue;
+                        }
+                        neighbor[d] += offset;
+                        const auto neighbor_id = samples.index(
+                            neighbor[0], neighbor[1], neighbor[2] );
+                        if( std::isnan( values[neighbor_id] ) )
+                        {
+                            values[neighbor_id] =
+                                std::copysign( narrow_band, values[id] );
+                            to_flood.push_back( neighbor_id );
+                        }
+                    }
+                }
+            }
+        };
+        for( const auto id : geode::Range{ samples.size() } )
+        {
+            if( !std::isnan( values[id] )
+                && std::fabs( values[id] ) >= max_spacing )
+            {
+                to_flood.push_back( id );
+            }
+        }
+        flood();
+        for( const auto k : geode::Range{ samples.counts[2] } )
+        {
+            for( const auto j : geode::Range{ samples.counts[1] } )
+            {
+                for( const auto i : geode::Range{ samples.counts[0] } )
+                {
+                    const auto id = samples.index( i, j, k );
+                    if( std::isnan( values[id] ) )
+                    {
+                        values[id] = std::copysign(
+                            narrow_band, distance( samples.point( i, j, k ) ) );
+                        to_flood.push_back( id );
+                        flood();
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector< double > compute_signed_distances( const SampleGrid& samples,
+        const geode::TriangulatedSurface3D& surface,
+        double narrow_band )
+    {
+        OPENGEODE_EXCEPTION( surface.nb_polygons() > 0,
+            "[compute_signed_distances] Surface should have triangles" );
+        check_narrow_band( samples, narrow_band );
+        std::vector< double > values(
+            samples.size(), std::numeric_limits< double >::quiet_NaN() );
+        const SignedDistance distance{ surface };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, samples.counts[2] ),
+            [&samples, &distance, &values, narrow_band]( geode::index_t k ) {
+                for( const auto j : geode::Range{ samples.counts[1] } )
+                {
+                    for( const auto i : geode::Range{ samples.counts[0] } )
+                    {
+                        const auto point = samples.point( i, j, k );
+                        if( narrow_band > 0
+                            && !distance.is_near( point, narrow_band ) )
+                        {
+                            continue;
+                        }
+                        values[samples.index( i, j, k )] = distance( point );
+                    }
+                }
+            } );
+        if( narrow_band > 0 )
+        {
+            propagate_signs( samples, distance, narrow_band, values );
+        }
+        return values;
+    }
+} // namespace
+
+namespace geode
+{
+    std::shared_ptr< VariableAttribute< double > >
+        compute_cell_signed_distances( const RegularGrid3D& grid,
+            const TriangulatedSurface3D& surface,
+            absl::string_view attribute_name,
+            double narrow_band )
+    {
+        SampleGrid samples;
+        samples.origin = grid.origin();
+        for( const auto d : Range{ 3 } )
+        {
+            samples.counts[d] = grid.nb_cells( d );
+            samples.spacing[d] = grid.cell_size( d );
+            samples.origin.set_value(
+                d, samples.origin.value( d ) + samples.spacing[d] / 2. );
+        }
+        const auto values =
+            compute_signed_distances( samples, surface, narrow_band );
+        auto attribute = grid.cell_attribute_manager()
+                             .find_or_create_attribute< VariableAttribute,
+                                 double >( attribute_name, 0 );
+        for( const auto c : Range{ grid.nb_cells() } )
+        {
+            attribute->set_value( c, values[c] );
+        }
+        return attribute;
+    }
+
+    std::vector< double > compute_node_signed_distances(
+        const RegularGrid3D& grid,
+        const TriangulatedSurface3D& surface,
+        double narrow_band )
+    {
+        SampleGrid samples;
+        samples.origin = grid.origin();
+        for( const auto d : Range{ 3 } )
+        {
+            samples.counts[d] = grid.nb_cells( d ) + 1;
+            samples.spacing[d] = grid.cell_size( d );
+        }
+        return compute_signed_distances( samples, surface, narrow_band );
+    }
+} // namespace geode
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/surface_intersections.h>
+
+#include <algorithm>
+
+#include <absl/container/fixed_array.h>
+
+#include <async++.h>
+
+#include <geode/geometry/aabb.h>
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/intersection_detection.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/predicates.h>
+
+#include <geode/mesh/core/triangulated_surface.h>
+
+namespace
+{
+    geode::Triangle3D mesh_triangle(
+        const geode::TriangulatedSurface3D& mesh, geode::index_t triangle )
+    {
+        return { mesh.point( mesh.polygon_vertex( { triangle, 0 } ) ),
+            mesh.point( mesh.polygon_vertex( { triangle, 1 } ) ),
+            mesh.point( mesh.polygon_vertex( { triangle, 2 } ) ) };
+    }
+
+    geode::Point2D project( const geode::Point3D& point, geode::index_t axis )
+    {
+        return { { point.value( ( axis + 1 ) % 3 ),
+            point.value( ( axis + 2 ) % 3 ) } };
+    }
+
+    /*!
+     * Find the side of a point relatively to a segment, in the first
+     * projection where it is not collinear with the segment.
+     */
+    geode::Side projected_side( const geode::Point3D& s0,
+        const geode::Point3D& s1,
+        const geode::Point3D& point,
+        geode::index_t& axis )
+    {
+        for( axis = 0; axis < 3; axis++ )
+        {
+            const auto side = geode::orient2d( project( s0, axis ),
+                project( s1, axis ), project( point, axis ) );
+            if( side != geode::Side::zero )
+            {
+                return side;
+            }
+        }
+        return geode::Side::zero;
+    }
+
+    bool is_degenerate( const geode::Triangle3D& triangle )
+    {
+        geode::index_t axis;
+        return projected_side( triangle.vertices()[0], triangle.vertices()[1],
+                   triangle.vertices()[2], axis )
+               == geode::Side::zero;
+    }
+
+    /*!
+     * Two triangles sharing an edge intersect elsewhere only if they are
+     * coplanar and folded onto each other.
+     */
+    bool edge_adjacent_triangles_intersect( const geode::Point3D& s0,
+        const geode::Point3D& s1,
+        const geode::Point3D& apex0,
+        const geode::Point3D& apex1 )
+    {
+        if( geode::orient3d( s0, s1, apex0, apex1 ) != geode::Side::zero )
+        {
+            return false;
+        }
+        geode::index_t axis;
+        const auto side0 = projected_side( s0, s1, apex0, axis );
+        return side0
+               == geode::orient2d( project( s0, axis ), project( s1, axis ),
+                   project( apex1, axis ) );
+    }
+
+    bool triangles_intersect(
+        const geode::Triangle3D& triangle0, const geode::Triangle3D& triangle1 )
+    {
+        if( is_degenerate( triangle0 ) || is_degenerate( triangle1 ) )
+        {
+            return false;
+        }
+        const auto& vertices0 = triangle0.vertices();
+        const auto& vertices1 = triangle1.vertices();
+        std::array< geode::index_t, 3 > shared;
+        shared.fill( geode::NO_ID );
+        geode::index_t nb_shared{ 0 };
+        for( const auto v0 : geode::Range{ 3 } )
+        {
+            for( const auto v1 : geode::Range{ 3 } )
+            {
+                if( vertices0[v0].get() == vertices1[v1].get() )
+                {
+                    shared[v0] = v1;
+                    nb_shared++;
+                }
+            }
+        }
+        if( nb_shared == 0 )
+        {
+            return geode::triangle_triangle_intersection_detection(
+                triangle0, triangle1 );
+        }
+        if( nb_shared == 3 )
+        {
+            return true;
+        }
+        if( nb_shared == 1 )
+        {
+            const auto v0 = static_cast< geode::index_t >( std::distance(
+                shared.begin(), std::find_if( shared.begin(), shared.end(),
+                                    []( geode::index_t v ) {
+                                        return v != geode::NO_ID;
+                                    } ) ) );
+            const auto v1 = shared[v0];
+            const geode::Segment3D opposite0{ vertices0[( v0 + 1 ) % 3],
+                vertices0[( v0 + 2 ) % 3] };
+            const geode::Segment3D opposite1{ vertices1[( v1 + 1 ) % 3],
+                vertices1[( v1 + 2 ) % 3] };
+            return geode::segment_triangle_intersection_detection(
+                       opposite0, triangle1 )
+                   || geode::segment_triangle_intersection_detection(
+                       opposite1, triangle0 );
+        }
+        const auto apex0 = static_cast< geode::index_t >( std::distance(
+            shared.begin(),
+            std::find( shared.begin(), shared.end(), geode::NO_ID ) ) );
+        const auto apex1 = 3 - shared[( apex0 + 1 ) % 3]
+                           - shared[( apex0 + 2 ) % 3];
+        return edge_adjacent_triangles_intersect( vertices0[( apex0 + 1 ) % 3],
+            vertices0[( apex0 + 2 ) % 3], vertices0[apex0], vertices1[apex1] );
+    }
+
+    class CandidatePairs
+    {
+    public:
+        void operator()( geode::index_t triangle0, geode::index_t triangle1 )
+        {
+            pairs_.emplace_back( triangle0, triangle1 );
+        }
+
+        std::vector< std::pair< geode::index_t, geode::index_t > >& pairs()
+        {
+            return pairs_;
+        }
+
+    private:
+        std::vector< std::pair< geode::index_t, geode::index_t > > pairs_;
+    };
+
+    std::vector< std::pair< geode::index_t, geode::index_t > >
+        intersecting_pairs( const geode::TriangulatedSurface3D& surface0,
+            const geode::TriangulatedSurface3D& surface1,
+            absl::Span< const std::pair< geode::index_t, geode::index_t > >
+                candidates )
+    {
+        absl::FixedArray< bool > intersect( candidates.size() );
+        async::parallel_for( async::irange( size_t{ 0 }, candidates.size() ),
+            [&surface0, &surface1, &candidates, &intersect]( size_t p ) {
+                intersect[p] = triangles_intersect(
+                    mesh_triangle( surface0, candidates[p].first ),
+                    mesh_triangle( surface1, candidates[p].second ) );
+            } );
+        std::vector< std::pair< geode::index_t, geode::index_t > >
+            intersections;
+        for( const auto p : geode::Range{ candidates.size() } )
+        {
+            if( intersect[p] )
+            {
+                intersections.push_back( candidates[p] );
+            }
+        }
+        std::sort( intersections.begin(), intersections.end() );
+        return intersections;
+    }
+} // namespace
+
+namespace geode
+{
+    std::vector< std::pair< index_t, index_t > >
+        triangulated_surface_self_intersections(
+            const TriangulatedSurface3D& surface, const AABBTree3D& tree )
+    {
+        OPENGEODE_EXCEPTION( tree.nb_bboxes() == surface.nb_polygons(),
+            "[triangulated_surface_self_intersections] AABBTree should be "
+            "built on the given surface" );
+        CandidatePairs candidates;
+        tree.compute_self_element_bbox_intersections( candidates );
+        for( auto& pair : candidates.pairs() )
+        {
+            if( pair.first > pair.second )
+            {
+                std::swap( pair.first, pair.second );
+            }
+        }
+        return intersecting_pairs( surface, surface, candidates.pairs() );
+    }
+
+    std::vector< std::pair< index_t, index_t > >
+        triangulated_surfaces_intersections(
+            const TriangulatedSurface3D& surface1,
+            const AABBTree3D& tree1,
+            const TriangulatedSurface3D& surface2,
+            const AABBTree3D& tree2 )
+    {
+        OPENGEODE_EXCEPTION( tree1.nb_bboxes() == surface1.nb_polygons()
+                                 && tree2.nb_bboxes() == surface2.nb_polygons(),
+            "[triangulated_surfaces_intersections] AABBTrees should be "
+            "built on the given surfaces" );
+        CandidatePairs candidates;
+        tree1.compute_other_element_bbox_intersections( tree2, candidates );
+        return intersecting_pairs( surface1, surface2, candidates.pairs() );
+    }
+} // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/edged_curve_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/edged_curve.h>
 #include <geode/mesh/core/mesh_factory.h>
 
@@ -36,7 +38,7 @@ namespace geode
         {
             auto edged_curve = EdgedCurve< dimension >::create( impl );
             auto input = EdgedCurveInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), *edged_curve,
+                to_string( extension_from_filename( filename ) ), *edged_curve,
                 filename );
             input->read();
             return edged_curve;
@@ -59,6 +61,49 @@ namespace geode
             filename );
     }
 
+    template < index_t dimension >
+    std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            auto edged_curve = EdgedCurve< dimension >::create( impl );
+            auto input = EdgedCurveInputFactory< dimension >::create(
+                to_string( extension ), *edged_curve, extension );
+            input->set_stream( stream );
+            input->read();
+            return edged_curve;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load EdgedCurve from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
+        std::istream& stream, absl::string_view extension )
+    {
+        return load_edged_curve< dimension >(
+            MeshFactory::default_impl(
+                EdgedCurve< dimension >::type_name_static() ),
+            stream, extension );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< EdgedCurve< dimension > > load_edged_curve(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_edged_curve< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     EdgedCurveInput< dimension >::EdgedCurveInput(
         EdgedCurve< dimension >& edged_curve, absl::string_view filename )
@@ -76,6 +121,21 @@ namespace geode
     template std::unique_ptr< EdgedCurve< 3 > >
         opengeode_mesh_api load_edged_curve( absl::string_view );
 
+    template std::unique_ptr< EdgedCurve< 2 > > opengeode_mesh_api
+        load_edged_curve( const MeshImpl&, std::istream&, absl::string_view );
+    template std::unique_ptr< EdgedCurve< 3 > > opengeode_mesh_api
+        load_edged_curve( const MeshImpl&, std::istream&, absl::string_view );
+
+    template std::unique_ptr< EdgedCurve< 2 > > opengeode_mesh_api
+        load_edged_curve( std::istream&, absl::string_view );
+    template std::unique_ptr< EdgedCurve< 3 > > opengeode_mesh_api
+        load_edged_curve( std::istream&, absl::string_view );
+
+    template std::unique_ptr< EdgedCurve< 2 > > opengeode_mesh_api
+        load_edged_curve( absl::Span< const char >, absl::string_view );
+    template std::unique_ptr< EdgedCurve< 3 > > opengeode_mesh_api
+        load_edged_curve( absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api EdgedCurveInput< 2 >;
     template class opengeode_mesh_api EdgedCurveInput< 3 >;
 } // namespace geode
@@ -34,7 +34,7 @@ namespace geode
         try
         {
             const auto output = EdgedCurveOutputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), edged_curve,
+                to_string( extension_from_filename( filename ) ), edged_curve,
                 filename );
             output->write();
         }
@@ -46,6 +46,29 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_edged_curve(
+        const EdgedCurve< dimension >& edged_curve,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output = EdgedCurveOutputFactory< dimension >::create(
+                to_string( extension ), edged_curve, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save EdgedCurve in stream with extension: ",
+                extension
+            };
+        }
+    }
+
     template < index_t dimension >
     EdgedCurveOutput< dimension >::EdgedCurveOutput(
         const EdgedCurve< dimension >& edged_curve, absl::string_view filename )
@@ -58,6 +81,11 @@ namespace geode
     template void opengeode_mesh_api save_edged_curve(
         const EdgedCurve< 3 >&, absl::string_view );
 
+    template void opengeode_mesh_api save_edged_curve(
+        const EdgedCurve< 2 >&, std::ostream&, absl::string_view );
+    template void opengeode_mesh_api save_edged_curve(
+        const EdgedCurve< 3 >&, std::ostream&, absl::string_view );
+
     template class opengeode_mesh_api EdgedCurveOutput< 2 >;
     template class opengeode_mesh_api EdgedCurveOutput< 3 >;
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/graph_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/graph.h>
 
 namespace geode
@@ -32,7 +34,8 @@ namespace geode
         try
         {
             auto input = GraphInputFactory::create(
-                extension_from_filename( filename ).data(), graph, filename );
+                to_string( extension_from_filename( filename ) ), graph,
+                filename );
             input->read();
         }
         catch( const OpenGeodeException& e )
@@ -43,6 +46,33 @@ namespace geode
         }
     }
 
+    void load_graph(
+        Graph& graph, std::istream& stream, absl::string_view extension )
+    {
+        try
+        {
+            auto input = GraphInputFactory::create(
+                to_string( extension ), graph, extension );
+            input->set_stream( stream );
+            input->read();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load Graph from stream with extension: ", extension
+            };
+        }
+    }
+
+    void load_graph( Graph& graph,
+        absl::Span< const char > buffer,
+        absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        load_graph( graph, stream, extension );
+    }
+
     GraphInput::GraphInput( Graph& graph, absl::string_view filename )
         : VertexSetInput( graph, filename ), graph_( graph )
     {
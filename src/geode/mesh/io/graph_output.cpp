@@ -32,7 +32,8 @@ namespace geode
         try
         {
             const auto output = GraphOutputFactory::create(
-                extension_from_filename( filename ).data(), graph, filename );
+                to_string( extension_from_filename( filename ) ), graph,
+                filename );
             output->write();
         }
         catch( const OpenGeodeException& e )
@@ -42,6 +43,26 @@ namespace geode
         }
     }
 
+    void save_graph( const Graph& graph,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output = GraphOutputFactory::create(
+                to_string( extension ), graph, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save Graph in stream with extension: ", extension
+            };
+        }
+    }
+
     GraphOutput::GraphOutput( const Graph& graph, absl::string_view filename )
         : VertexSetOutput( graph, filename ), graph_( graph )
     {
@@ -21,6 +21,7 @@
  *
  */
 
+#include <geode/mesh/io/input.h>
 #include <geode/mesh/io/output.h>
 
 namespace geode
@@ -29,4 +30,48 @@ namespace geode
     {
         return filename.substr( filename.find_last_of( '.' ) + 1 );
     }
+
+    void Input::set_stream( std::istream& stream )
+    {
+        OPENGEODE_EXCEPTION( is_stream_supported(),
+            "[Input::set_stream] Reading from a stream is not supported for "
+            "extension: ",
+            extension_from_filename( filename() ) );
+        stream_ = &stream;
+    }
+
+    std::istream& Input::stream()
+    {
+        if( !stream_ )
+        {
+            file_.reset( new std::ifstream{
+                to_string( filename() ), std::ifstream::binary } );
+            OPENGEODE_EXCEPTION( file_->good(),
+                "[Input::stream] Cannot open file: ", filename() );
+            stream_ = file_.get();
+        }
+        return *stream_;
+    }
+
+    void Output::set_stream( std::ostream& stream )
+    {
+        OPENGEODE_EXCEPTION( is_stream_supported(),
+            "[Output::set_stream] Writing into a stream is not supported for "
+            "extension: ",
+            extension_from_filename( filename() ) );
+        stream_ = &stream;
+    }
+
+    std::ostream& Output::stream() const
+    {
+        if( !stream_ )
+        {
+            file_.reset( new std::ofstream{
+                to_string( filename() ), std::ofstream::binary } );
+            OPENGEODE_EXCEPTION( file_->good(),
+                "[Output::stream] Cannot create file: ", filename() );
+            stream_ = file_.get();
+        }
+        return *stream_;
+    }
 } // namespace geode
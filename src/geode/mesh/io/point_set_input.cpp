@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/point_set_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/point_set.h>
 
@@ -36,7 +38,7 @@ namespace geode
         {
             auto point_set = PointSet< dimension >::create( impl );
             auto input = PointSetInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), *point_set,
+                to_string( extension_from_filename( filename ) ), *point_set,
                 filename );
             input->read();
             return point_set;
@@ -59,6 +61,49 @@ namespace geode
             filename );
     }
 
+    template < index_t dimension >
+    std::unique_ptr< PointSet< dimension > > load_point_set(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            auto point_set = PointSet< dimension >::create( impl );
+            auto input = PointSetInputFactory< dimension >::create(
+                to_string( extension ), *point_set, extension );
+            input->set_stream( stream );
+            input->read();
+            return point_set;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load PointSet from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PointSet< dimension > > load_point_set(
+        std::istream& stream, absl::string_view extension )
+    {
+        return load_point_set< dimension >(
+            MeshFactory::default_impl(
+                PointSet< dimension >::type_name_static() ),
+            stream, extension );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PointSet< dimension > > load_point_set(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_point_set< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     PointSetInput< dimension >::PointSetInput(
         PointSet< dimension >& point_set, absl::string_view filename )
@@ -76,6 +121,21 @@ namespace geode
     template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api load_point_set(
         absl::string_view );
 
+    template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api
+        load_point_set( const MeshImpl&, std::istream&, absl::string_view );
+    template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api
+        load_point_set( const MeshImpl&, std::istream&, absl::string_view );
+
+    template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api
+        load_point_set( std::istream&, absl::string_view );
+    template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api
+        load_point_set( std::istream&, absl::string_view );
+
+    template std::unique_ptr< PointSet< 2 > > opengeode_mesh_api
+        load_point_set( absl::Span< const char >, absl::string_view );
+    template std::unique_ptr< PointSet< 3 > > opengeode_mesh_api
+        load_point_set( absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api PointSetInput< 2 >;
     template class opengeode_mesh_api PointSetInput< 3 >;
 } // namespace geode
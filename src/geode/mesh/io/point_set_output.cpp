@@ -34,7 +34,7 @@ namespace geode
         try
         {
             const auto output = PointSetOutputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), point_set,
+                to_string( extension_from_filename( filename ) ), point_set,
                 filename );
             output->write();
         }
@@ -46,6 +46,29 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_point_set(
+        const PointSet< dimension >& point_set,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output = PointSetOutputFactory< dimension >::create(
+                to_string( extension ), point_set, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save PointSet in stream with extension: ",
+                extension
+            };
+        }
+    }
+
     template < index_t dimension >
     PointSetOutput< dimension >::PointSetOutput(
         const PointSet< dimension >& point_set, absl::string_view filename )
@@ -58,6 +81,11 @@ namespace geode
     template void opengeode_mesh_api save_point_set(
         const PointSet< 3 >&, absl::string_view );
 
+    template void opengeode_mesh_api save_point_set(
+        const PointSet< 2 >&, std::ostream&, absl::string_view );
+    template void opengeode_mesh_api save_point_set(
+        const PointSet< 3 >&, std::ostream&, absl::string_view );
+
     template class opengeode_mesh_api PointSetOutput< 2 >;
     template class opengeode_mesh_api PointSetOutput< 3 >;
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/polygonal_surface_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polygonal_surface.h>
 
@@ -37,8 +39,8 @@ namespace geode
             auto polygonal_surface =
                 PolygonalSurface< dimension >::create( impl );
             auto input = PolygonalSurfaceInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), *polygonal_surface,
-                filename );
+                to_string( extension_from_filename( filename ) ),
+                *polygonal_surface, filename );
             input->read();
             return polygonal_surface;
         }
@@ -61,6 +63,50 @@ namespace geode
             filename );
     }
 
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            auto polygonal_surface =
+                PolygonalSurface< dimension >::create( impl );
+            auto input = PolygonalSurfaceInputFactory< dimension >::create(
+                to_string( extension ), *polygonal_surface, extension );
+            input->set_stream( stream );
+            input->read();
+            return polygonal_surface;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load PolygonalSurface from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        std::istream& stream, absl::string_view extension )
+    {
+        return load_polygonal_surface< dimension >(
+            MeshFactory::default_impl(
+                PolygonalSurface< dimension >::type_name_static() ),
+            stream, extension );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolygonalSurface< dimension > > load_polygonal_surface(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_polygonal_surface< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     PolygonalSurfaceInput< dimension >::PolygonalSurfaceInput(
         PolygonalSurface< dimension >& polygonal_surface,
@@ -80,6 +126,23 @@ namespace geode
     template std::unique_ptr< PolygonalSurface< 3 > >
         opengeode_mesh_api load_polygonal_surface( absl::string_view );
 
+    template std::unique_ptr< PolygonalSurface< 2 > > opengeode_mesh_api
+        load_polygonal_surface(
+            const MeshImpl&, std::istream&, absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 3 > > opengeode_mesh_api
+        load_polygonal_surface(
+            const MeshImpl&, std::istream&, absl::string_view );
+
+    template std::unique_ptr< PolygonalSurface< 2 > > opengeode_mesh_api
+        load_polygonal_surface( std::istream&, absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 3 > > opengeode_mesh_api
+        load_polygonal_surface( std::istream&, absl::string_view );
+
+    template std::unique_ptr< PolygonalSurface< 2 > > opengeode_mesh_api
+        load_polygonal_surface( absl::Span< const char >, absl::string_view );
+    template std::unique_ptr< PolygonalSurface< 3 > > opengeode_mesh_api
+        load_polygonal_surface( absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api PolygonalSurfaceInput< 2 >;
     template class opengeode_mesh_api PolygonalSurfaceInput< 3 >;
 } // namespace geode
@@ -36,7 +36,7 @@ namespace geode
         {
             const auto output =
                 PolygonalSurfaceOutputFactory< dimension >::create(
-                    extension_from_filename( filename ).data(),
+                    to_string( extension_from_filename( filename ) ),
                     polygonal_surface, filename );
             output->write();
         }
@@ -48,6 +48,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_polygonal_surface(
+        const PolygonalSurface< dimension >& polygonal_surface,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output =
+                PolygonalSurfaceOutputFactory< dimension >::create(
+                    to_string( extension ), polygonal_surface, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save PolygonalSurface in stream with extension: ",
+                extension
+            };
+        }
+    }
+
     template < index_t dimension >
     PolygonalSurfaceOutput< dimension >::PolygonalSurfaceOutput(
         const PolygonalSurface< dimension >& polygonal_surface,
@@ -62,6 +86,11 @@ namespace geode
     template void opengeode_mesh_api save_polygonal_surface(
         const PolygonalSurface< 3 >&, absl::string_view );
 
+    template void opengeode_mesh_api save_polygonal_surface(
+        const PolygonalSurface< 2 >&, std::ostream&, absl::string_view );
+    template void opengeode_mesh_api save_polygonal_surface(
+        const PolygonalSurface< 3 >&, std::ostream&, absl::string_view );
+
     template class opengeode_mesh_api PolygonalSurfaceOutput< 2 >;
     template class opengeode_mesh_api PolygonalSurfaceOutput< 3 >;
 } // namespace geode
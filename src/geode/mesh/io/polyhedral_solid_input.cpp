@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/polyhedral_solid_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/polyhedral_solid.h>
 
@@ -37,8 +39,8 @@ namespace geode
             auto polyhedral_solid =
                 PolyhedralSolid< dimension >::create( impl );
             auto input = PolyhedralSolidInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), *polyhedral_solid,
-                filename );
+                to_string( extension_from_filename( filename ) ),
+                *polyhedral_solid, filename );
             input->read();
             return polyhedral_solid;
         }
@@ -60,6 +62,50 @@ namespace geode
             filename );
     }
 
+    template < index_t dimension >
+    std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            auto polyhedral_solid =
+                PolyhedralSolid< dimension >::create( impl );
+            auto input = PolyhedralSolidInputFactory< dimension >::create(
+                to_string( extension ), *polyhedral_solid, extension );
+            input->set_stream( stream );
+            input->read();
+            return polyhedral_solid;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load PolyhedralSolid from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
+        std::istream& stream, absl::string_view extension )
+    {
+        return load_polyhedral_solid< dimension >(
+            MeshFactory::default_impl(
+                PolyhedralSolid< dimension >::type_name_static() ),
+            stream, extension );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< PolyhedralSolid< dimension > > load_polyhedral_solid(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_polyhedral_solid< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     PolyhedralSolidInput< dimension >::PolyhedralSolidInput(
         PolyhedralSolid< dimension >& polyhedral_solid,
@@ -75,5 +121,15 @@ namespace geode
     template std::unique_ptr< PolyhedralSolid< 3 > >
         opengeode_mesh_api load_polyhedral_solid( absl::string_view );
 
+    template std::unique_ptr< PolyhedralSolid< 3 > > opengeode_mesh_api
+        load_polyhedral_solid(
+            const MeshImpl&, std::istream&, absl::string_view );
+
+    template std::unique_ptr< PolyhedralSolid< 3 > > opengeode_mesh_api
+        load_polyhedral_solid( std::istream&, absl::string_view );
+
+    template std::unique_ptr< PolyhedralSolid< 3 > > opengeode_mesh_api
+        load_polyhedral_solid( absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api PolyhedralSolidInput< 3 >;
 } // namespace geode
@@ -31,6 +31,7 @@
 #include <geode/mesh/core/geode_tetrahedral_solid.h>
 #include <geode/mesh/core/geode_triangulated_surface.h>
 #include <geode/mesh/core/geode_vertex_set.h>
+#include <geode/mesh/io/detail/geode_compact_triangulated_surface_input.h>
 #include <geode/mesh/io/detail/geode_edged_curve_input.h>
 #include <geode/mesh/io/detail/geode_graph_input.h>
 #include <geode/mesh/io/detail/geode_point_set_input.h>
@@ -78,5 +79,18 @@ namespace geode
         RegularGridInputFactory3D::register_creator<
             OpenGeodeRegularGridInput3D >(
             RegularGrid3D ::native_extension_static().data() );
+
+        for( const auto storage :
+            { PointStorage::single_precision, PointStorage::quantized } )
+        {
+            TriangulatedSurfaceInputFactory2D::register_creator<
+                OpenGeodeCompactTriangulatedSurfaceInput2D >(
+                detail::compact_triangulated_surface_extension< 2 >(
+                    storage ) );
+            TriangulatedSurfaceInputFactory3D::register_creator<
+                OpenGeodeCompactTriangulatedSurfaceInput3D >(
+                detail::compact_triangulated_surface_extension< 3 >(
+                    storage ) );
+        }
     }
 } // namespace geode
@@ -31,6 +31,7 @@
 #include <geode/mesh/core/geode_tetrahedral_solid.h>
 #include <geode/mesh/core/geode_triangulated_surface.h>
 #include <geode/mesh/core/geode_vertex_set.h>
+#include <geode/mesh/io/detail/geode_compact_triangulated_surface_output.h>
 #include <geode/mesh/io/detail/geode_edged_curve_output.h>
 #include <geode/mesh/io/detail/geode_graph_output.h>
 #include <geode/mesh/io/detail/geode_point_set_output.h>
@@ -55,6 +56,20 @@
     BITSERY_OUTPUT_MESH_REGISTER_2D( Mesh );                                   \
     BITSERY_OUTPUT_MESH_REGISTER_3D( Mesh )
 
+namespace
+{
+    template < geode::index_t dimension, geode::PointStorage storage >
+    void register_compact_triangulated_surface_output()
+    {
+        using Output =
+            geode::OpenGeodeCompactTriangulatedSurfaceOutput< dimension,
+                storage >;
+        geode::TriangulatedSurfaceOutputFactory< dimension >::
+            template register_creator< Output >(
+                Output::extension_static().data() );
+    }
+} // namespace
+
 namespace geode
 {
     void register_geode_mesh_output()
@@ -78,5 +93,14 @@ namespace geode
         RegularGridOutputFactory3D::register_creator<
             OpenGeodeRegularGridOutput3D >(
             RegularGrid3D ::native_extension_static().data() );
+
+        register_compact_triangulated_surface_output< 2,
+            PointStorage::single_precision >();
+        register_compact_triangulated_surface_output< 2,
+            PointStorage::quantized >();
+        register_compact_triangulated_surface_output< 3,
+            PointStorage::single_precision >();
+        register_compact_triangulated_surface_output< 3,
+            PointStorage::quantized >();
     }
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/regular_grid_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/regular_grid.h>
 
@@ -35,7 +37,7 @@ namespace geode
         try
         {
             auto input = RegularGridInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), filename );
+                to_string( extension_from_filename( filename ) ), filename );
             input->read();
             return input->regular_grid();
         }
@@ -47,6 +49,36 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
+        std::istream& stream, absl::string_view extension )
+    {
+        try
+        {
+            auto input = RegularGridInputFactory< dimension >::create(
+                to_string( extension ), extension );
+            input->set_stream( stream );
+            input->read();
+            return input->regular_grid();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load RegularGrid from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< RegularGrid< dimension > > load_regular_grid(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_regular_grid< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     RegularGridInput< dimension >::RegularGridInput(
         absl::string_view filename )
@@ -59,6 +91,16 @@ namespace geode
     template std::unique_ptr< RegularGrid< 3 > >
         opengeode_mesh_api load_regular_grid( absl::string_view );
 
+    template std::unique_ptr< RegularGrid< 2 > > opengeode_mesh_api
+        load_regular_grid( std::istream&, absl::string_view );
+    template std::unique_ptr< RegularGrid< 3 > > opengeode_mesh_api
+        load_regular_grid( std::istream&, absl::string_view );
+
+    template std::unique_ptr< RegularGrid< 2 > > opengeode_mesh_api
+        load_regular_grid( absl::Span< const char >, absl::string_view );
+    template std::unique_ptr< RegularGrid< 3 > > opengeode_mesh_api
+        load_regular_grid( absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api RegularGridInput< 2 >;
     template class opengeode_mesh_api RegularGridInput< 3 >;
 } // namespace geode
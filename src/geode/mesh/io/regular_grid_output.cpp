@@ -34,7 +34,7 @@ namespace geode
         try
         {
             const auto output = RegularGridOutputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), regular_grid,
+                to_string( extension_from_filename( filename ) ), regular_grid,
                 filename );
             output->write();
         }
@@ -46,6 +46,27 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_regular_grid( const RegularGrid< dimension >& regular_grid,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output = RegularGridOutputFactory< dimension >::create(
+                to_string( extension ), regular_grid, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save RegularGrid in stream with extension: ", extension
+            };
+        }
+    }
+
     template < index_t dimension >
     RegularGridOutput< dimension >::RegularGridOutput(
         const RegularGrid< dimension >& regular_grid,
@@ -59,6 +80,11 @@ namespace geode
     template void opengeode_mesh_api save_regular_grid(
         const RegularGrid< 3 >&, absl::string_view );
 
+    template void opengeode_mesh_api save_regular_grid(
+        const RegularGrid< 2 >&, std::ostream&, absl::string_view );
+    template void opengeode_mesh_api save_regular_grid(
+        const RegularGrid< 3 >&, std::ostream&, absl::string_view );
+
     template class opengeode_mesh_api RegularGridOutput< 2 >;
     template class opengeode_mesh_api RegularGridOutput< 3 >;
 } // namespace geode
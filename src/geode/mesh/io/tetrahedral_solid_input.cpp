@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/tetrahedral_solid_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/tetrahedral_solid.h>
 
@@ -37,8 +39,8 @@ namespace geode
             auto tetrahedral_solid =
                 TetrahedralSolid< dimension >::create( impl );
             auto input = TetrahedralSolidInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(), *tetrahedral_solid,
-                filename );
+                to_string( extension_from_filename( filename ) ),
+                *tetrahedral_solid, filename );
             input->read();
             return tetrahedral_solid;
         }
@@ -61,6 +63,50 @@ namespace geode
             filename );
     }
 
+    template < index_t dimension >
+    std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
+        const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            auto tetrahedral_solid =
+                TetrahedralSolid< dimension >::create( impl );
+            auto input = TetrahedralSolidInputFactory< dimension >::create(
+                to_string( extension ), *tetrahedral_solid, extension );
+            input->set_stream( stream );
+            input->read();
+            return tetrahedral_solid;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load TetrahedralSolid from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
+        std::istream& stream, absl::string_view extension )
+    {
+        return load_tetrahedral_solid< dimension >(
+            MeshFactory::default_impl(
+                TetrahedralSolid< dimension >::type_name_static() ),
+            stream, extension );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TetrahedralSolid< dimension > > load_tetrahedral_solid(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_tetrahedral_solid< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     TetrahedralSolidInput< dimension >::TetrahedralSolidInput(
         TetrahedralSolid< dimension >& tetrahedral_solid,
@@ -76,5 +122,15 @@ namespace geode
     template std::unique_ptr< TetrahedralSolid< 3 > >
         opengeode_mesh_api load_tetrahedral_solid( absl::string_view );
 
+    template std::unique_ptr< TetrahedralSolid< 3 > > opengeode_mesh_api
+        load_tetrahedral_solid(
+            const MeshImpl&, std::istream&, absl::string_view );
+
+    template std::unique_ptr< TetrahedralSolid< 3 > > opengeode_mesh_api
+        load_tetrahedral_solid( std::istream&, absl::string_view );
+
+    template std::unique_ptr< TetrahedralSolid< 3 > > opengeode_mesh_api
+        load_tetrahedral_solid( absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api TetrahedralSolidInput< 3 >;
 } // namespace geode
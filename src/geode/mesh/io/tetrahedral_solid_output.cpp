@@ -36,7 +36,7 @@ namespace geode
         {
             const auto output =
                 TetrahedralSolidOutputFactory< dimension >::create(
-                    extension_from_filename( filename ).data(),
+                    to_string( extension_from_filename( filename ) ),
                     tetrahedral_solid, filename );
             output->write();
         }
@@ -48,6 +48,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_tetrahedral_solid(
+        const TetrahedralSolid< dimension >& tetrahedral_solid,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output =
+                TetrahedralSolidOutputFactory< dimension >::create(
+                    to_string( extension ), tetrahedral_solid, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save TetrahedralSolid in stream with extension: ",
+                extension
+            };
+        }
+    }
+
     template < index_t dimension >
     TetrahedralSolidOutput< dimension >::TetrahedralSolidOutput(
         const TetrahedralSolid< dimension >& tetrahedral_solid,
@@ -60,5 +84,8 @@ namespace geode
     template void opengeode_mesh_api save_tetrahedral_solid(
         const TetrahedralSolid< 3 >&, absl::string_view );
 
+    template void opengeode_mesh_api save_tetrahedral_solid(
+        const TetrahedralSolid< 3 >&, std::ostream&, absl::string_view );
+
     template class opengeode_mesh_api TetrahedralSolidOutput< 3 >;
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/io/triangulated_surface_input.h>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/triangulated_surface.h>
 
@@ -38,7 +40,7 @@ namespace geode
             auto triangulated_surface =
                 TriangulatedSurface< dimension >::create( impl );
             auto input = TriangulatedSurfaceInputFactory< dimension >::create(
-                extension_from_filename( filename ).data(),
+                to_string( extension_from_filename( filename ) ),
                 *triangulated_surface, filename );
             input->read();
             return triangulated_surface;
@@ -62,6 +64,53 @@ namespace geode
             filename );
     }
 
+    template < index_t dimension >
+    std::unique_ptr< TriangulatedSurface< dimension > >
+        load_triangulated_surface(
+            const MeshImpl& impl,
+            std::istream& stream,
+            absl::string_view extension )
+    {
+        try
+        {
+            auto triangulated_surface =
+                TriangulatedSurface< dimension >::create( impl );
+            auto input = TriangulatedSurfaceInputFactory< dimension >::create(
+                to_string( extension ), *triangulated_surface, extension );
+            input->set_stream( stream );
+            input->read();
+            return triangulated_surface;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load TriangulatedSurface from stream with extension: ",
+                extension
+            };
+        }
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TriangulatedSurface< dimension > >
+        load_triangulated_surface(
+            std::istream& stream, absl::string_view extension )
+    {
+        return load_triangulated_surface< dimension >(
+            MeshFactory::default_impl(
+                TriangulatedSurface< dimension >::type_name_static() ),
+            stream, extension );
+    }
+
+    template < index_t dimension >
+    std::unique_ptr< TriangulatedSurface< dimension > >
+        load_triangulated_surface(
+            absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_triangulated_surface< dimension >( stream, extension );
+    }
+
     template < index_t dimension >
     TriangulatedSurfaceInput< dimension >::TriangulatedSurfaceInput(
         TriangulatedSurface< dimension >& triangulated_surface,
@@ -81,6 +130,25 @@ namespace geode
     template std::unique_ptr< TriangulatedSurface< 3 > >
         opengeode_mesh_api load_triangulated_surface( absl::string_view );
 
+    template std::unique_ptr< TriangulatedSurface< 2 > > opengeode_mesh_api
+        load_triangulated_surface(
+            const MeshImpl&, std::istream&, absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 3 > > opengeode_mesh_api
+        load_triangulated_surface(
+            const MeshImpl&, std::istream&, absl::string_view );
+
+    template std::unique_ptr< TriangulatedSurface< 2 > > opengeode_mesh_api
+        load_triangulated_surface( std::istream&, absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 3 > > opengeode_mesh_api
+        load_triangulated_surface( std::istream&, absl::string_view );
+
+    template std::unique_ptr< TriangulatedSurface< 2 > > opengeode_mesh_api
+        load_triangulated_surface(
+            absl::Span< const char >, absl::string_view );
+    template std::unique_ptr< TriangulatedSurface< 3 > > opengeode_mesh_api
+        load_triangulated_surface(
+            absl::Span< const char >, absl::string_view );
+
     template class opengeode_mesh_api TriangulatedSurfaceInput< 2 >;
     template class opengeode_mesh_api TriangulatedSurfaceInput< 3 >;
 } // namespace geode
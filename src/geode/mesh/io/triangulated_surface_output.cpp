@@ -36,7 +36,7 @@ namespace geode
         {
             const auto output =
                 TriangulatedSurfaceOutputFactory< dimension >::create(
-                    extension_from_filename( filename ).data(),
+                    to_string( extension_from_filename( filename ) ),
                     triangulated_surface, filename );
             output->write();
         }
@@ -49,6 +49,30 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void save_triangulated_surface(
+        const TriangulatedSurface< dimension >& triangulated_surface,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output =
+                TriangulatedSurfaceOutputFactory< dimension >::create(
+                    to_string( extension ), triangulated_surface, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save TriangulatedSurface in stream with extension: ",
+                extension
+            };
+        }
+    }
+
     template < index_t dimension >
     TriangulatedSurfaceOutput< dimension >::TriangulatedSurfaceOutput(
         const TriangulatedSurface< dimension >& triangulated_surface,
@@ -63,6 +87,11 @@ namespace geode
     template void opengeode_mesh_api save_triangulated_surface(
         const TriangulatedSurface< 3 >&, absl::string_view );
 
+    template void opengeode_mesh_api save_triangulated_surface(
+        const TriangulatedSurface< 2 >&, std::ostream&, absl::string_view );
+    template void opengeode_mesh_api save_triangulated_surface(
+        const TriangulatedSurface< 3 >&, std::ostream&, absl::string_view );
+
     template class opengeode_mesh_api TriangulatedSurfaceOutput< 2 >;
     template class opengeode_mesh_api TriangulatedSurfaceOutput< 3 >;
 } // namespace geode
@@ -25,6 +25,8 @@
 
 #include <fstream>
 
+#include <geode/basic/detail/memory_stream.h>
+
 #include <geode/mesh/core/bitsery_archive.h>
 #include <geode/mesh/core/mesh_factory.h>
 #include <geode/mesh/core/vertex_set.h>
@@ -45,7 +47,7 @@ namespace geode
         {
             auto vertex_set = VertexSet::create( impl );
             auto input = VertexSetInputFactory::create(
-                extension_from_filename( filename ).data(), *vertex_set,
+                to_string( extension_from_filename( filename ) ), *vertex_set,
                 filename );
             input->read();
             return vertex_set;
@@ -58,6 +60,44 @@ namespace geode
         }
     }
 
+    std::unique_ptr< VertexSet > load_vertex_set(
+        std::istream& stream, absl::string_view extension )
+    {
+        return load_vertex_set(
+            MeshFactory::default_impl( VertexSet::type_name_static() ),
+            stream, extension );
+    }
+
+    std::unique_ptr< VertexSet > load_vertex_set(
+        absl::Span< const char > buffer, absl::string_view extension )
+    {
+        detail::MemoryInputStream stream{ buffer };
+        return load_vertex_set( stream, extension );
+    }
+
+    std::unique_ptr< VertexSet > load_vertex_set( const MeshImpl& impl,
+        std::istream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            auto vertex_set = VertexSet::create( impl );
+            auto input = VertexSetInputFactory::create(
+                to_string( extension ), *vertex_set, extension );
+            input->set_stream( stream );
+            input->read();
+            return vertex_set;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load VertexSet from stream with extension: ",
+                extension
+            };
+        }
+    }
+
     VertexSetInput::VertexSetInput(
         VertexSet& vertex_set, absl::string_view filename )
         : Input( filename ), vertex_set_( vertex_set )
@@ -33,7 +33,7 @@ namespace geode
         try
         {
             const auto output = VertexSetOutputFactory::create(
-                extension_from_filename( filename ).data(), vertex_set,
+                to_string( extension_from_filename( filename ) ), vertex_set,
                 filename );
             output->write();
         }
@@ -45,6 +45,26 @@ namespace geode
         }
     }
 
+    void save_vertex_set( const VertexSet& vertex_set,
+        std::ostream& stream,
+        absl::string_view extension )
+    {
+        try
+        {
+            const auto output = VertexSetOutputFactory::create(
+                to_string( extension ), vertex_set, extension );
+            output->set_stream( stream );
+            output->write();
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot save VertexSet in stream with extension: ", extension
+            };
+        }
+    }
+
     VertexSetOutput::VertexSetOutput(
         const VertexSet& vertex_set, absl::string_view filename )
         : Output( filename ), vertex_set_( vertex_set )
@@ -23,6 +23,12 @@
 
 #include <geode/model/helpers/convert_model_meshes.h>
 
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include <async++.h>
+
 #include <geode/mesh/builder/surface_mesh_builder.h>
 #include <geode/mesh/core/solid_mesh.h>
 #include <geode/mesh/core/surface_mesh.h>
@@ -40,84 +46,134 @@
 
 namespace
 {
-    template < typename Model, typename Mesh >
-    absl::FixedArray< geode::index_t > save_unique_vertices( const Model& model,
-        const Mesh& mesh,
-        const geode::ComponentID& component_id )
+    template < typename Model >
+    std::vector< geode::index_t > save_unique_vertices(
+        const Model& model, const geode::ComponentID& component_id )
     {
-        const auto nb_vertices = mesh.nb_vertices();
-        absl::FixedArray< geode::index_t > unique_vertices( nb_vertices );
-        for( const auto v : geode::Range{ nb_vertices } )
-        {
-            unique_vertices[v] = model.unique_vertex( { component_id, v } );
-        }
-        return unique_vertices;
+        const auto unique_vertices = model.unique_vertices( component_id );
+        return { unique_vertices.begin(), unique_vertices.end() };
     }
 
-    template < typename Builder >
-    void set_unique_vertices( Builder& builder,
-        absl::Span< const geode::index_t > unique_vertices,
-        const geode::ComponentID& component_id )
+    /*!
+     * Convert the meshes of the given components concurrently.
+     * VertexIdentifier and component meshes are only updated afterwards,
+     * sequentially, since they are shared by all the components.
+     */
+    template < typename Component,
+        typename Model,
+        typename ConvertMesh,
+        typename UpdateMesh >
+    void convert_component_meshes( const Model& model,
+        absl::Span< const std::reference_wrapper< const Component > >
+            components,
+        const ConvertMesh& convert_mesh,
+        const UpdateMesh& update_mesh )
     {
-        for( const auto v : geode::Indices{ unique_vertices } )
+        using ConvertedMesh =
+            typename std::result_of< ConvertMesh( const Component& ) >::type;
+        const auto nb_components =
+            static_cast< geode::index_t >( components.size() );
+        std::vector< std::vector< geode::index_t > > unique_vertices(
+            nb_components );
+        std::vector< ConvertedMesh > meshes( nb_components );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, nb_components ),
+            [&model, &components, &convert_mesh, &unique_vertices, &meshes](
+                geode::index_t c ) {
+                const auto& component = components[c].get();
+                unique_vertices[c] =
+                    save_unique_vertices( model, component.component_id() );
+                meshes[c] = convert_mesh( component );
+            } );
+        for( const auto c : geode::Range{ nb_components } )
         {
-            builder.set_unique_vertex(
-                { component_id, v }, unique_vertices[v] );
+            update_mesh( components[c].get(), std::move( meshes[c] ),
+                unique_vertices[c] );
         }
     }
 
     template < geode::index_t dimension, typename Model, typename ModelBuilder >
     void do_convert_surfaces( Model& model, ModelBuilder& builder )
     {
+        std::vector<
+            std::reference_wrapper< const geode::Surface< dimension > > >
+            surfaces;
         for( const auto& surface : model.surfaces() )
         {
-            const auto& mesh = surface.mesh();
-            if( mesh.type_name()
+            if( surface.mesh().type_name()
                 == geode::TriangulatedSurface< dimension >::type_name_static() )
             {
                 continue;
             }
-            const auto unique_vertices =
-                save_unique_vertices( model, mesh, surface.component_id() );
-            auto tri_surface =
-                geode::convert_surface_mesh_into_triangulated_surface( mesh );
-            OPENGEODE_EXCEPTION( tri_surface,
-                "[convert_surface_meshes_into_triangulated_surfaces] Cannot "
-                "convert SurfaceMesh to TriangulatedSurface" );
-            builder.update_surface_mesh(
-                surface, std::move( tri_surface ).value() );
-            set_unique_vertices(
-                builder, unique_vertices, surface.component_id() );
+            surfaces.emplace_back( surface );
         }
+        convert_component_meshes< geode::Surface< dimension > >( model,
+            surfaces,
+            []( const geode::Surface< dimension >& surface ) {
+                return geode::convert_surface_mesh_into_triangulated_surface(
+                    surface.mesh() );
+            },
+            [&builder]( const geode::Surface< dimension >& surface,
+                absl::optional< std::unique_ptr<
+                    geode::TriangulatedSurface< dimension > > > tri_surface,
+                absl::Span< const geode::index_t > unique_vertices ) {
+                OPENGEODE_EXCEPTION( tri_surface,
+                    "[convert_surface_meshes_into_triangulated_surfaces] "
+                    "Cannot convert SurfaceMesh to TriangulatedSurface" );
+                builder.update_surface_mesh(
+                    surface, std::move( tri_surface ).value() );
+                builder.set_unique_vertices(
+                    surface.component_id(), unique_vertices );
+            } );
     }
 
-    template < typename Model, typename ModelBuilder >
+    template < geode::index_t dimension, typename Model, typename ModelBuilder >
     void do_triangulate_surfaces( Model& model, ModelBuilder& builder )
     {
+        std::vector<
+            std::reference_wrapper< const geode::Surface< dimension > > >
+            surfaces;
+        std::vector< std::unique_ptr< geode::SurfaceMeshBuilder< dimension > > >
+            mesh_builders;
         for( const auto& surface : model.surfaces() )
         {
-            const auto& mesh = surface.mesh();
-            geode::triangulate_surface_mesh(
-                mesh, *builder.surface_mesh_builder( surface.id() ) );
+            surfaces.emplace_back( surface );
+            mesh_builders.emplace_back(
+                builder.surface_mesh_builder( surface.id() ) );
         }
+        const auto nb_surfaces =
+            static_cast< geode::index_t >( surfaces.size() );
+        async::parallel_for( async::irange( geode::index_t{ 0 }, nb_surfaces ),
+            [&surfaces, &mesh_builders]( geode::index_t s ) {
+                geode::triangulate_surface_mesh(
+                    surfaces[s].get().mesh(), *mesh_builders[s] );
+            } );
     }
 
     void do_convert_blocks( geode::BRep& model, geode::BRepBuilder& builder )
     {
+        std::vector< std::reference_wrapper< const geode::Block3D > > blocks;
         for( const auto& block : model.blocks() )
         {
-            const auto& mesh = block.mesh();
-            const auto unique_vertices =
-                save_unique_vertices( model, mesh, block.component_id() );
-            auto tet_solid =
-                geode::convert_solid_mesh_into_tetrahedral_solid( mesh );
-            OPENGEODE_EXCEPTION( tet_solid,
-                "[convert_block_meshes_into_tetrahedral_solids] Cannot "
-                "convert SolidMesh to TetrahedralSolid" );
-            builder.update_block_mesh( block, std::move( tet_solid ).value() );
-            set_unique_vertices(
-                builder, unique_vertices, block.component_id() );
+            blocks.emplace_back( block );
         }
+        convert_component_meshes< geode::Block3D >( model, blocks,
+            []( const geode::Block3D& block ) {
+                return geode::convert_solid_mesh_into_tetrahedral_solid(
+                    block.mesh() );
+            },
+            [&builder]( const geode::Block3D& block,
+                absl::optional< std::unique_ptr< geode::TetrahedralSolid3D > >
+                    tet_solid,
+                absl::Span< const geode::index_t > unique_vertices ) {
+                OPENGEODE_EXCEPTION( tet_solid,
+                    "[convert_block_meshes_into_tetrahedral_solids] Cannot "
+                    "convert SolidMesh to TetrahedralSolid" );
+                builder.update_block_mesh(
+                    block, std::move( tet_solid ).value() );
+                builder.set_unique_vertices(
+                    block.component_id(), unique_vertices );
+            } );
     }
 } // namespace
 
@@ -144,12 +200,12 @@ namespace geode
     void triangulate_surface_meshes( BRep& brep )
     {
         BRepBuilder brep_builder{ brep };
-        do_triangulate_surfaces( brep, brep_builder );
+        do_triangulate_surfaces< 3 >( brep, brep_builder );
     }
 
     void triangulate_surface_meshes( Section& section )
     {
         SectionBuilder section_builder{ section };
-        do_triangulate_surfaces( section, section_builder );
+        do_triangulate_surfaces< 2 >( section, section_builder );
     }
 } // namespace geode
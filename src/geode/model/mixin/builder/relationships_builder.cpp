@@ -40,6 +40,12 @@ namespace geode
         relationships_.unregister_component( id, {} );
     }
 
+    void RelationshipsBuilder::unregister_components(
+        absl::Span< const uuid > ids )
+    {
+        relationships_.unregister_components( ids, {} );
+    }
+
     void RelationshipsBuilder::add_boundary_relation(
         const uuid& boundary, const uuid& incidence )
     {
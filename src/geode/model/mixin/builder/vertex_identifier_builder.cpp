@@ -56,6 +56,14 @@ namespace geode
             component_vertex_id, unique_vertex_id, {} );
     }
 
+    void VertexIdentifierBuilder::set_unique_vertices(
+        const ComponentID& component_id,
+        absl::Span< const index_t > unique_vertices )
+    {
+        vertex_identifier_.set_unique_vertices(
+            component_id, unique_vertices, {} );
+    }
+
     void VertexIdentifierBuilder::update_unique_vertices(
         const ComponentID& component_id, absl::Span< const index_t > old2new )
     {
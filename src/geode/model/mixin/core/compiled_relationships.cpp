@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/model/mixin/core/compiled_relationships.h>
+
+#include <algorithm>
+
+#include <geode/basic/range.h>
+
+namespace geode
+{
+    bool CompiledRelationships::Adjacency::contains(
+        index_t component, index_t other ) const
+    {
+        const auto range = related( component );
+        return std::binary_search( range.begin(), range.end(), other );
+    }
+
+    void CompiledRelationships::Adjacency::build( index_t nb_components,
+        absl::Span< const std::pair< index_t, index_t > > relations )
+    {
+        offsets.assign( nb_components + 1, 0 );
+        for( const auto& relation : relations )
+        {
+            offsets[relation.first + 1]++;
+        }
+        for( const auto c : Range{ nb_components } )
+        {
+            offsets[c + 1] += offsets[c];
+        }
+        values.resize( relations.size() );
+        std::vector< index_t > cursor{ offsets.begin(), offsets.end() - 1 };
+        for( const auto& relation : relations )
+        {
+            values[cursor[relation.first]++] = relation.second;
+        }
+        for( const auto c : Range{ nb_components } )
+        {
+            std::sort(
+                values.begin() + offsets[c], values.begin() + offsets[c + 1] );
+        }
+    }
+
+    index_t CompiledRelationships::component_index( const uuid& id ) const
+    {
+        const auto it = uuid2index_.find( id );
+        OPENGEODE_EXCEPTION( it != uuid2index_.end(),
+            "[CompiledRelationships::component_index] Component ", id.string(),
+            " is not in the compiled relationships" );
+        return it->second;
+    }
+} // namespace geode
@@ -28,6 +28,7 @@
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/pimpl_impl.h>
+#include <geode/basic/range.h>
 #include <geode/basic/uuid.h>
 
 #include <geode/geometry/bitsery_archive.h>
@@ -133,6 +134,80 @@ namespace geode
             uuid2index_.decrement_indices_larger_than( index );
         }
 
+        void unregister_components( absl::Span< const uuid > ids )
+        {
+            // All ids are resolved before any change so that an unknown id
+            // leaves the relationships untouched. Duplicated ids are allowed.
+            std::vector< bool > to_delete( graph_.nb_vertices(), false );
+            for( const auto& id : ids )
+            {
+                to_delete[vertex_id( id )] = true;
+            }
+            for( const auto& id : ids )
+            {
+                uuid2index_.erase( id );
+            }
+            const auto old2new =
+                GraphBuilder::create( graph_ )->delete_vertices( to_delete );
+            uuid2index_.update_indices( old2new );
+        }
+
+        const ComponentID& component_id( const uuid& id ) const
+        {
+            return ids_->value( vertex_id( id ) );
+        }
+
+        CompiledRelationships compile() const
+        {
+            CompiledRelationships compiled;
+            const auto nb_components = graph_.nb_vertices();
+            compiled.components_.reserve( nb_components );
+            compiled.uuid2index_.reserve( nb_components );
+            for( const auto v : Range{ nb_components } )
+            {
+                compiled.components_.push_back( ids_->value( v ) );
+                compiled.uuid2index_.emplace( ids_->value( v ).id(), v );
+            }
+            std::vector< std::pair< index_t, index_t > > to_relations;
+            std::vector< std::pair< index_t, index_t > > from_relations;
+            for( const auto type :
+                { BOUNDARY_RELATION, INTERNAL_RELATION, ITEM_RELATION } )
+            {
+                to_relations.clear();
+                from_relations.clear();
+                for( const auto e : Range{ graph_.nb_edges() } )
+                {
+                    if( relation_type( e ) != type )
+                    {
+                        continue;
+                    }
+                    const auto from = graph_.edge_vertex( { e, 0 } );
+                    const auto to = graph_.edge_vertex( { e, 1 } );
+                    to_relations.emplace_back( to, from );
+                    from_relations.emplace_back( from, to );
+                }
+                if( type == BOUNDARY_RELATION )
+                {
+                    compiled.boundaries_.build( nb_components, to_relations );
+                    compiled.incidences_.build(
+                        nb_components, from_relations );
+                }
+                else if( type == INTERNAL_RELATION )
+                {
+                    compiled.internals_.build( nb_components, to_relations );
+                    compiled.embeddings_.build(
+                        nb_components, from_relations );
+                }
+                else
+                {
+                    compiled.items_.build( nb_components, to_relations );
+                    compiled.collections_.build(
+                        nb_components, from_relations );
+                }
+            }
+            return compiled;
+        }
+
         bool check_relation_exists(
             const uuid& from, const uuid& to, const RelationType type ) const
         {
@@ -202,6 +277,14 @@ namespace geode
                 "[Relationships::load] Error while reading file: ", filename );
         }
 
+        MemoryUsage memory_usage() const
+        {
+            MemoryUsage usage{ "Relationships", 0 };
+            usage.add_child( "graph", graph_.memory_usage() );
+            usage.add_child( "uuid2index", uuid2index_.memory_usage() );
+            return usage;
+        }
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -248,6 +331,27 @@ namespace geode
         impl_->unregister_component( id );
     }
 
+    void Relationships::unregister_components(
+        absl::Span< const uuid > ids, RelationshipsBuilderKey )
+    {
+        impl_->unregister_components( ids );
+    }
+
+    const ComponentID& Relationships::component_id( const uuid& id ) const
+    {
+        return impl_->component_id( id );
+    }
+
+    CompiledRelationships Relationships::compile_relationships() const
+    {
+        return impl_->compile();
+    }
+
+    MemoryUsage Relationships::memory_usage() const
+    {
+        return impl_->memory_usage();
+    }
+
     index_t Relationships::nb_boundaries( const uuid& id ) const
     {
         return detail::count_relationships( boundaries( id ) );
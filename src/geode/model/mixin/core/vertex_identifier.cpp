@@ -3,6 +3,7 @@
 #include <fstream>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/bitsery_archive.h>
@@ -45,6 +46,18 @@ namespace geode
             return unique_vertices_.nb_vertices();
         }
 
+        MemoryUsage memory_usage() const
+        {
+            MemoryUsage usage{ "VertexIdentifier", 0 };
+            usage.add_child(
+                "unique_vertices", unique_vertices_.memory_usage() );
+            usage.add_child( "component_attributes",
+                AttributeHeapMemory< absl::flat_hash_map< uuid,
+                    std::shared_ptr< VariableAttribute< index_t > > > >::
+                    size( vertex2unique_vertex_ ) );
+            return usage;
+        }
+
         const std::vector< MeshComponentVertex >& mesh_component_vertices(
             index_t unique_vertex_id ) const
         {
@@ -91,6 +104,12 @@ namespace geode
             return vertex2unique_vertex_.at( component_id )->value( vertex_id );
         }
 
+        absl::Span< const index_t > unique_vertices(
+            const uuid& component_id ) const
+        {
+            return vertex2unique_vertex_.at( component_id )->values();
+        }
+
         bool has_mesh_component_vertices(
             index_t unique_vertex_id, const ComponentType& type ) const
         {
@@ -169,7 +188,23 @@ namespace geode
             mesh.vertex_attribute_manager().delete_attribute(
                 "unique vertices" );
             vertex2unique_vertex_.erase( component.id() );
-            filter_component_vertices( component.id() );
+            filter_component_vertices( { component.id() } );
+        }
+
+        template < typename MeshComponent >
+        void unregister_components( absl::Span<
+            const std::reference_wrapper< const MeshComponent > > components )
+        {
+            absl::flat_hash_set< uuid > component_ids;
+            component_ids.reserve( components.size() );
+            for( const MeshComponent& component : components )
+            {
+                component.mesh().vertex_attribute_manager().delete_attribute(
+                    "unique vertices" );
+                vertex2unique_vertex_.erase( component.id() );
+                component_ids.insert( component.id() );
+            }
+            filter_component_vertices( component_ids );
         }
 
         index_t create_unique_vertex()
@@ -217,6 +252,40 @@ namespace geode
             }
         }
 
+        void set_unique_vertices( const ComponentID& component_id,
+            absl::Span< const index_t > unique_vertices )
+        {
+            auto& attribute = *vertex2unique_vertex_.at( component_id.id() );
+            OPENGEODE_EXCEPTION(
+                unique_vertices.size() == attribute.values().size(),
+                "[VertexIdentifier::set_unique_vertices] Wrong number of "
+                "unique vertices" );
+            for( const auto v : Indices{ unique_vertices } )
+            {
+                const auto old_unique_id = attribute.value( v );
+                const auto unique_vertex_id = unique_vertices[v];
+                if( old_unique_id == unique_vertex_id )
+                {
+                    continue;
+                }
+                MeshComponentVertex component_vertex{ component_id, v };
+                if( old_unique_id != NO_ID )
+                {
+                    unset_unique_vertex( component_vertex, old_unique_id );
+                }
+                attribute.set_value( v, unique_vertex_id );
+                if( unique_vertex_id != NO_ID )
+                {
+                    component_vertices_->modify_value( unique_vertex_id,
+                        [&component_vertex](
+                            std::vector< MeshComponentVertex >& vertices ) {
+                            vertices.emplace_back(
+                                std::move( component_vertex ) );
+                        } );
+                }
+            }
+        }
+
         void unset_unique_vertex(
             const MeshComponentVertex& component_vertex_id,
             const index_t unique_vertex_id )
@@ -339,7 +408,8 @@ namespace geode
                 } );
         }
 
-        void filter_component_vertices( const uuid& component_id )
+        void filter_component_vertices(
+            const absl::flat_hash_set< uuid >& component_ids )
         {
             for( const auto uv_id : Range{ nb_unique_vertices() } )
             {
@@ -350,8 +420,8 @@ namespace geode
                 bool update{ false };
                 for( const auto i : Range{ mesh_component_vertices.size() } )
                 {
-                    if( mesh_component_vertices[i].component_id.id()
-                        == component_id )
+                    if( component_ids.contains(
+                            mesh_component_vertices[i].component_id.id() ) )
                     {
                         to_keep[i] = false;
                         update = true;
@@ -403,6 +473,11 @@ namespace geode
         return impl_->nb_unique_vertices();
     }
 
+    MemoryUsage VertexIdentifier::memory_usage() const
+    {
+        return impl_->memory_usage();
+    }
+
     const std::vector< MeshComponentVertex >&
         VertexIdentifier::mesh_component_vertices(
             index_t unique_vertex_id ) const
@@ -430,6 +505,12 @@ namespace geode
             mesh_component_vertex.vertex );
     }
 
+    absl::Span< const index_t > VertexIdentifier::unique_vertices(
+        const ComponentID& component_id ) const
+    {
+        return impl_->unique_vertices( component_id.id() );
+    }
+
     bool VertexIdentifier::has_mesh_component_vertices(
         index_t unique_vertex_id, const ComponentType& type ) const
     {
@@ -457,6 +538,15 @@ namespace geode
         impl_->unregister_component( component );
     }
 
+    template < typename MeshComponent >
+    void VertexIdentifier::unregister_mesh_components(
+        absl::Span< const std::reference_wrapper< const MeshComponent > >
+            components,
+        BuilderKey )
+    {
+        impl_->unregister_components( components );
+    }
+
     index_t VertexIdentifier::create_unique_vertex( BuilderKey )
     {
         return impl_->create_unique_vertex();
@@ -484,6 +574,14 @@ namespace geode
         impl_->unset_unique_vertex( component_vertex_id, unique_vertex_id );
     }
 
+    void VertexIdentifier::set_unique_vertices(
+        const ComponentID& component_id,
+        absl::Span< const index_t > unique_vertices,
+        BuilderKey )
+    {
+        impl_->set_unique_vertices( component_id, unique_vertices );
+    }
+
     void VertexIdentifier::update_unique_vertices(
         const ComponentID& component_id,
         absl::Span< const index_t > old2new,
@@ -540,4 +638,33 @@ namespace geode
     template void opengeode_model_api
         VertexIdentifier::unregister_mesh_component(
             const Block3D&, BuilderKey );
+
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Corner2D > >,
+            BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Corner3D > >,
+            BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Line2D > >,
+            BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Line3D > >,
+            BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Surface2D > >,
+            BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Surface3D > >,
+            BuilderKey );
+    template void opengeode_model_api
+        VertexIdentifier::unregister_mesh_components(
+            absl::Span< const std::reference_wrapper< const Block3D > >,
+            BuilderKey );
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/model/representation/builder/brep_builder.h>
 
+#include <absl/container/flat_hash_set.h>
+
 #include <geode/mesh/core/edged_curve.h>
 #include <geode/mesh/core/mesh_id.h>
 #include <geode/mesh/core/point_set.h>
@@ -281,6 +283,80 @@ namespace geode
         delete_model_boundary( boundary );
     }
 
+    void BRepBuilder::remove_components( absl::Span< const uuid > ids )
+    {
+        std::vector< std::reference_wrapper< const Corner3D > > corners;
+        std::vector< std::reference_wrapper< const Line3D > > lines;
+        std::vector< std::reference_wrapper< const Surface3D > > surfaces;
+        std::vector< std::reference_wrapper< const Block3D > > blocks;
+        std::vector< std::reference_wrapper< const ModelBoundary3D > >
+            model_boundaries;
+        absl::flat_hash_set< uuid > unique_ids;
+        unique_ids.reserve( ids.size() );
+        std::vector< uuid > to_remove;
+        to_remove.reserve( ids.size() );
+        for( const auto& id : ids )
+        {
+            if( !unique_ids.insert( id ).second )
+            {
+                continue;
+            }
+            to_remove.push_back( id );
+            const auto& type = brep_.component_id( id ).type();
+            if( type == Corner3D::component_type_static() )
+            {
+                corners.emplace_back( brep_.corner( id ) );
+            }
+            else if( type == Line3D::component_type_static() )
+            {
+                lines.emplace_back( brep_.line( id ) );
+            }
+            else if( type == Surface3D::component_type_static() )
+            {
+                surfaces.emplace_back( brep_.surface( id ) );
+            }
+            else if( type == Block3D::component_type_static() )
+            {
+                blocks.emplace_back( brep_.block( id ) );
+            }
+            else if( type == ModelBoundary3D::component_type_static() )
+            {
+                model_boundaries.emplace_back( brep_.model_boundary( id ) );
+            }
+            else
+            {
+                throw OpenGeodeException{ "[BRepBuilder::remove_components] "
+                                           "Unknown component type: ",
+                    type.get() };
+            }
+        }
+        unregister_components( to_remove );
+        unregister_mesh_components< Corner3D >( corners );
+        unregister_mesh_components< Line3D >( lines );
+        unregister_mesh_components< Surface3D >( surfaces );
+        unregister_mesh_components< Block3D >( blocks );
+        for( const Corner3D& corner : corners )
+        {
+            delete_corner( corner );
+        }
+        for( const Line3D& line : lines )
+        {
+            delete_line( line );
+        }
+        for( const Surface3D& surface : surfaces )
+        {
+            delete_surface( surface );
+        }
+        for( const Block3D& block : blocks )
+        {
+            delete_block( block );
+        }
+        for( const ModelBoundary3D& model_boundary : model_boundaries )
+        {
+            delete_model_boundary( model_boundary );
+        }
+    }
+
     void BRepBuilder::add_corner_line_boundary_relationship(
         const Corner3D& corner, const Line3D& line )
     {
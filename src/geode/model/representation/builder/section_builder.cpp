@@ -23,6 +23,8 @@
 
 #include <geode/model/representation/builder/section_builder.h>
 
+#include <absl/container/flat_hash_set.h>
+
 #include <geode/mesh/core/edged_curve.h>
 #include <geode/mesh/core/mesh_id.h>
 #include <geode/mesh/core/point_set.h>
@@ -231,6 +233,70 @@ namespace geode
         delete_model_boundary( boundary );
     }
 
+    void SectionBuilder::remove_components( absl::Span< const uuid > ids )
+    {
+        std::vector< std::reference_wrapper< const Corner2D > > corners;
+        std::vector< std::reference_wrapper< const Line2D > > lines;
+        std::vector< std::reference_wrapper< const Surface2D > > surfaces;
+        std::vector< std::reference_wrapper< const ModelBoundary2D > >
+            model_boundaries;
+        absl::flat_hash_set< uuid > unique_ids;
+        unique_ids.reserve( ids.size() );
+        std::vector< uuid > to_remove;
+        to_remove.reserve( ids.size() );
+        for( const auto& id : ids )
+        {
+            if( !unique_ids.insert( id ).second )
+            {
+                continue;
+            }
+            to_remove.push_back( id );
+            const auto& type = section_.component_id( id ).type();
+            if( type == Corner2D::component_type_static() )
+            {
+                corners.emplace_back( section_.corner( id ) );
+            }
+            else if( type == Line2D::component_type_static() )
+            {
+                lines.emplace_back( section_.line( id ) );
+            }
+            else if( type == Surface2D::component_type_static() )
+            {
+                surfaces.emplace_back( section_.surface( id ) );
+            }
+            else if( type == ModelBoundary2D::component_type_static() )
+            {
+                model_boundaries.emplace_back( section_.model_boundary( id ) );
+            }
+            else
+            {
+                throw OpenGeodeException{ "[SectionBuilder::remove_components] "
+                                           "Unknown component type: ",
+                    type.get() };
+            }
+        }
+        unregister_components( to_remove );
+        unregister_mesh_components< Corner2D >( corners );
+        unregister_mesh_components< Line2D >( lines );
+        unregister_mesh_components< Surface2D >( surfaces );
+        for( const Corner2D& corner : corners )
+        {
+            delete_corner( corner );
+        }
+        for( const Line2D& line : lines )
+        {
+            delete_line( line );
+        }
+        for( const Surface2D& surface : surfaces )
+        {
+            delete_surface( surface );
+        }
+        for( const ModelBoundary2D& model_boundary : model_boundaries )
+        {
+            delete_model_boundary( model_boundary );
+        }
+    }
+
     void SectionBuilder::add_corner_line_boundary_relationship(
         const Corner2D& corner, const Line2D& line )
     {
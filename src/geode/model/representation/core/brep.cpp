@@ -76,6 +76,18 @@ namespace
         }
         return box;
     }
+
+    template < typename MeshComponentRange >
+    geode::MemoryUsage meshes_memory_usage( MeshComponentRange range )
+    {
+        geode::MemoryUsage usage;
+        for( const auto& component : range )
+        {
+            usage.add_child(
+                component.id().string(), component.mesh().memory_usage() );
+        }
+        return usage;
+    }
 } // namespace
 
 namespace geode
@@ -547,4 +559,17 @@ namespace geode
         }
         return meshes_bounding_box( corners() );
     }
+
+    MemoryUsage BRep::memory_usage() const
+    {
+        MemoryUsage usage{ "BRep", 0 };
+        usage.add_child( "Relationships", Relationships::memory_usage() );
+        usage.add_child(
+            "VertexIdentifier", VertexIdentifier::memory_usage() );
+        usage.add_child( "Corners", meshes_memory_usage( corners() ) );
+        usage.add_child( "Lines", meshes_memory_usage( lines() ) );
+        usage.add_child( "Surfaces", meshes_memory_usage( surfaces() ) );
+        usage.add_child( "Blocks", meshes_memory_usage( blocks() ) );
+        return usage;
+    }
 } // namespace geode
@@ -74,6 +74,18 @@ namespace
         }
         return box;
     }
+
+    template < typename MeshComponentRange >
+    geode::MemoryUsage meshes_memory_usage( MeshComponentRange range )
+    {
+        geode::MemoryUsage usage;
+        for( const auto& component : range )
+        {
+            usage.add_child(
+                component.id().string(), component.mesh().memory_usage() );
+        }
+        return usage;
+    }
 } // namespace
 
 namespace geode
@@ -341,4 +353,15 @@ namespace geode
         return meshes_bounding_box( corners() );
     }
 
+    MemoryUsage Section::memory_usage() const
+    {
+        MemoryUsage usage{ "Section", 0 };
+        usage.add_child( "Relationships", Relationships::memory_usage() );
+        usage.add_child(
+            "VertexIdentifier", VertexIdentifier::memory_usage() );
+        usage.add_child( "Corners", meshes_memory_usage( corners() ) );
+        usage.add_child( "Lines", meshes_memory_usage( lines() ) );
+        usage.add_child( "Surfaces", meshes_memory_usage( surfaces() ) );
+        return usage;
+    }
 } // namespace geode
@@ -32,7 +32,8 @@ namespace geode
         try
         {
             auto input = BRepInputFactory::create(
-                extension_from_filename( filename ).data(), brep, filename );
+                to_string( extension_from_filename( filename ) ), brep,
+                filename );
             input->read();
             Logger::info( "BRep loaded from ", filename );
             Logger::info( "BRep has: ", brep.nb_blocks(), " Blocks, ",
@@ -32,7 +32,8 @@ namespace geode
         try
         {
             auto input = SectionInputFactory::create(
-                extension_from_filename( filename ).data(), section, filename );
+                to_string( extension_from_filename( filename ) ), section,
+                filename );
             input->read();
             Logger::info( "Section loaded from ", filename );
             Logger::info( "Section has: ", section.nb_surfaces(), " Surfaces, ",
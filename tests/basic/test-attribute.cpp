@@ -22,11 +22,13 @@
  */
 
 #include <fstream>
+#include <sstream>
 
 #include <bitsery/brief_syntax/array.h>
 
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/logger.h>
+#include <geode/basic/range.h>
 
 #include <geode/tests/common.h>
 
@@ -263,6 +265,8 @@ void check_attribute_values( geode::AttributeManager& manager,
     check_one_attribute_values< Foo >( manager, reloaded_manager, "foo_cst" );
     check_one_attribute_values< Foo >( manager, reloaded_manager, "foo_var" );
     check_one_attribute_values< Foo >( manager, reloaded_manager, "foo_spr" );
+    check_one_attribute_values< std::array< double, 3 > >(
+        manager, reloaded_manager, "array_double" );
 }
 
 void test_serialize_manager( geode::AttributeManager& manager )
@@ -309,6 +313,33 @@ void test_serialize_manager( geode::AttributeManager& manager )
     check_attribute_values( manager, reloaded_manager );
 }
 
+void test_corrupted_bulk_size()
+{
+    std::stringstream stream;
+    geode::TContext context{};
+    geode::Serializer archive{ context, stream };
+    // Claims far more values than the input contains
+    uint64_t nb_values{ uint64_t{ 1 } << 40 };
+    archive.value8b( nb_values );
+    for( const auto i : geode::Range{ 10 } )
+    {
+        double value = i;
+        archive.value8b( value );
+    }
+    archive.adapter().flush();
+
+    geode::TContext reload_context{};
+    geode::Deserializer unarchive{ reload_context, stream };
+    std::vector< double > values;
+    geode::detail::BulkValuesSerializer< geode::Deserializer >::process(
+        unarchive, values );
+    OPENGEODE_EXCEPTION(
+        unarchive.adapter().error() != bitsery::ReaderError::NoError,
+        "[Test] Reading a corrupted size should fail" );
+    OPENGEODE_EXCEPTION( values.empty(),
+        "[Test] No value should be kept from a corrupted input" );
+}
+
 void test_attribute_types( geode::AttributeManager& manager )
 {
     OPENGEODE_EXCEPTION(
@@ -350,6 +381,188 @@ void test_sparse_attribute_after_element_deletion(
         "Element 7 of sparse attribute should be 12 " );
 }
 
+void test_delete_many_elements()
+{
+    geode::AttributeManager manager;
+    const geode::index_t nb_elements{ 300000 };
+    manager.resize( nb_elements );
+    auto variable = manager.find_or_create_attribute< geode::VariableAttribute,
+        geode::index_t >( "variable", geode::NO_ID );
+    auto flag = manager.find_or_create_attribute< geode::VariableAttribute,
+        bool >( "flag", false );
+    auto sparse = manager.find_or_create_attribute< geode::SparseAttribute,
+        geode::index_t >( "sparse", geode::NO_ID );
+    std::vector< bool > to_delete( nb_elements, false );
+    for( const auto e : geode::Range{ nb_elements } )
+    {
+        variable->set_value( e, e );
+        flag->set_value( e, e % 2 == 0 );
+        if( e % 1000 == 0 )
+        {
+            sparse->set_value( e, e );
+        }
+        to_delete[e] = e % 3 == 0;
+    }
+    manager.delete_elements( to_delete );
+    OPENGEODE_EXCEPTION( manager.nb_elements() == 200000,
+        "[Test] Manager should have 200000 elements after deletion" );
+    for( const auto e : geode::Range{ manager.nb_elements() } )
+    {
+        const auto old_e = e + e / 2 + 1;
+        OPENGEODE_EXCEPTION( variable->value( e ) == old_e,
+            "[Test] Wrong variable attribute value after deletion" );
+        OPENGEODE_EXCEPTION( flag->value( e ) == ( old_e % 2 == 0 ),
+            "[Test] Wrong bool attribute value after deletion" );
+        const auto sparse_value = old_e % 1000 == 0 ? old_e : geode::NO_ID;
+        OPENGEODE_EXCEPTION( sparse->value( e ) == sparse_value,
+            "[Test] Wrong sparse attribute value after deletion" );
+    }
+}
+
+void test_sparse_attribute_resize()
+{
+    geode::AttributeManager manager;
+    manager.resize( 10 );
+    auto sparse =
+        manager.find_or_create_attribute< geode::SparseAttribute, double >(
+            "sparse", 0 );
+    sparse->set_value( 2, 2 );
+    sparse->set_value( 8, 8 );
+    std::vector< geode::index_t > permutation{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+    manager.permute_elements( permutation );
+    OPENGEODE_EXCEPTION( sparse->value( 1 ) == 8 && sparse->value( 7 ) == 2,
+        "[Test] Wrong sparse attribute values after permutation" );
+    std::vector< geode::index_t > repeated{ 0, 1, 2, 3, 4, 5, 6, 7, 1, 9 };
+    bool permute_throws{ false };
+    try
+    {
+        manager.permute_elements( repeated );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        permute_throws = true;
+    }
+    OPENGEODE_EXCEPTION(
+        permute_throws, "[Test] Invalid permutation should throw" );
+    OPENGEODE_EXCEPTION( sparse->value( 1 ) == 8 && sparse->value( 7 ) == 2,
+        "[Test] Invalid permutation should not modify attributes" );
+    manager.resize( 5 );
+    manager.resize( 10 );
+    OPENGEODE_EXCEPTION( sparse->value( 1 ) == 8,
+        "[Test] Sparse attribute value should be kept after shrink" );
+    OPENGEODE_EXCEPTION( sparse->value( 7 ) == 0,
+        "[Test] Sparse attribute value should be dropped after shrink" );
+    sparse->set_value( 9, 9 );
+    manager.resize( 11 );
+    OPENGEODE_EXCEPTION( sparse->value( 9 ) == 9,
+        "[Test] Sparse attribute value should be kept after growth" );
+    manager.resize( 9 );
+    manager.resize( 10 );
+    OPENGEODE_EXCEPTION( sparse->value( 9 ) == 0,
+        "[Test] Sparse attribute value should be dropped after regrowth" );
+}
+
+void test_memory_usage()
+{
+    geode::AttributeManager manager;
+    manager.resize( 100 );
+    manager.find_or_create_attribute< geode::VariableAttribute, double >(
+        "double", 0 );
+    auto vectors = manager.find_or_create_attribute< geode::VariableAttribute,
+        std::vector< double > >( "vectors", {} );
+    const auto before = manager.memory_usage();
+    OPENGEODE_EXCEPTION( before.children.size() == 2,
+        "[Test] Memory usage should be detailed by attribute" );
+    for( const auto& attribute : before.children )
+    {
+        if( attribute.name == "double" )
+        {
+            OPENGEODE_EXCEPTION( attribute.total() >= 100 * sizeof( double ),
+                "[Test] Wrong memory usage of double attribute" );
+        }
+    }
+    vectors->set_value( 3, std::vector< double >( 1000 ) );
+    const auto after = manager.memory_usage();
+    OPENGEODE_EXCEPTION(
+        after.total() >= before.total() + 1000 * sizeof( double ),
+        "[Test] Memory usage should include heap held values" );
+    OPENGEODE_EXCEPTION( after.flatten().size() == 3,
+        "[Test] Wrong number of flattened memory usage entries" );
+}
+
+void test_batch_computation()
+{
+    geode::AttributeManager manager;
+    manager.resize( 6 );
+    auto interpolated =
+        manager.find_or_create_attribute< geode::VariableAttribute, double >(
+            "interpolated", 0, { true, true } );
+    auto sparse =
+        manager.find_or_create_attribute< geode::SparseAttribute, double >(
+            "sparse", 0, { true, true } );
+    auto fixed = manager.find_or_create_attribute< geode::VariableAttribute,
+        double >( "fixed", 1 );
+    for( const auto e : geode::Range{ 4 } )
+    {
+        interpolated->set_value( e, e );
+        sparse->set_value( e, 2 * e );
+        fixed->set_value( e, e );
+    }
+
+    geode::AttributeLinearInterpolations interpolations;
+    interpolations.reserve( 2, 4 );
+    const std::array< geode::index_t, 2 > indices0{ 0, 2 };
+    const std::array< double, 2 > lambdas0{ 0.5, 0.5 };
+    interpolations.add_interpolation( 4, indices0, lambdas0 );
+    const std::array< geode::index_t, 2 > indices1{ 1, 3 };
+    const std::array< double, 2 > lambdas1{ 0.25, 0.75 };
+    interpolations.add_interpolation( 5, indices1, lambdas1 );
+    manager.interpolate_attribute_values( interpolations );
+    OPENGEODE_EXCEPTION(
+        interpolated->value( 4 ) == 1 && interpolated->value( 5 ) == 2.5,
+        "[Test] Wrong batch interpolated values" );
+    OPENGEODE_EXCEPTION( sparse->value( 4 ) == 2 && sparse->value( 5 ) == 5,
+        "[Test] Wrong batch interpolated sparse values" );
+    OPENGEODE_EXCEPTION( fixed->value( 4 ) == 1 && fixed->value( 5 ) == 1,
+        "[Test] Non interpolable attribute should not be modified" );
+
+    const std::array< geode::index_t, 2 > from{ 0, 1 };
+    const std::array< geode::index_t, 2 > to{ 5, 4 };
+    manager.assign_attribute_values( from, to );
+    OPENGEODE_EXCEPTION(
+        interpolated->value( 4 ) == 1 && interpolated->value( 5 ) == 0,
+        "[Test] Wrong batch assigned values" );
+    OPENGEODE_EXCEPTION( sparse->value( 4 ) == 2 && sparse->value( 5 ) == 0,
+        "[Test] Wrong batch assigned sparse values" );
+
+    const std::array< geode::index_t, 2 > out_of_range{ 1, 6 };
+    bool assign_throws{ false };
+    try
+    {
+        manager.assign_attribute_values( from, out_of_range );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        assign_throws = true;
+    }
+    OPENGEODE_EXCEPTION(
+        assign_throws, "[Test] Out of range batch assignment should throw" );
+
+    geode::AttributeLinearInterpolations wrong_interpolations;
+    wrong_interpolations.add_interpolation( 4, out_of_range, lambdas0 );
+    bool interpolate_throws{ false };
+    try
+    {
+        manager.interpolate_attribute_values( wrong_interpolations );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        interpolate_throws = true;
+    }
+    OPENGEODE_EXCEPTION( interpolate_throws,
+        "[Test] Out of range batch interpolation should throw" );
+}
+
 void test_generic_value( geode::AttributeManager& manager )
 {
     const auto& foo_attr = manager.find_attribute< Foo >( "foo_spr" );
@@ -396,6 +609,7 @@ void test()
     test_sparse_attribute_after_element_deletion( manager );
 
     test_serialize_manager( manager );
+    test_corrupted_bulk_size();
 
     test_copy_manager( manager );
     test_attribute_types( manager );
@@ -409,6 +623,11 @@ void test()
         manager.nb_elements() == 10, "[Test] Manager should have 10 elements" );
     manager.clear();
     test_number_of_attributes( manager, 0 );
+
+    test_delete_many_elements();
+    test_sparse_attribute_resize();
+    test_memory_usage();
+    test_batch_computation();
 }
 
 OPENGEODE_TEST( "attribute" )
\ No newline at end of file
@@ -22,6 +22,8 @@
  */
 
 #include <fstream>
+#include <limits>
+#include <vector>
 
 #include <geode/basic/bitsery_archive.h>
 #include <geode/basic/logger.h>
@@ -101,6 +103,76 @@ struct Foo3
     int int_{ 10 };
 };
 
+struct Indices
+{
+    template < typename Archive >
+    void serialize( Archive &archive )
+    {
+        archive.ext( *this, geode::DefaultGrowable< Archive, Indices >{},
+            []( Archive &archive, Indices &indices ) {
+                geode::serialize_index( archive, indices.index_ );
+                geode::serialize_index( archive, indices.no_id_ );
+                geode::serialize_index( archive, indices.large_index_ );
+                geode::serialize_indices( archive, indices.indices_ );
+            } );
+    }
+    geode::index_t index_{ 10 };
+    geode::index_t no_id_{ 10 };
+    geode::index_t large_index_{ 10 };
+    std::vector< geode::index_t > indices_;
+};
+
+struct RawIndices
+{
+    template < typename Archive >
+    void serialize( Archive &archive )
+    {
+        archive.ext( *this, geode::DefaultGrowable< Archive, RawIndices >{},
+            []( Archive &archive, RawIndices &indices ) {
+                archive.value4b( indices.index_ );
+                archive.value4b( indices.no_id_ );
+                archive.value4b( indices.large_index_ );
+                archive.container4b(
+                    indices.indices_, indices.indices_.max_size() );
+            } );
+    }
+    uint32_t index_{ 10 };
+    uint32_t no_id_{ 10 };
+    uint32_t large_index_{ 10 };
+    std::vector< uint32_t > indices_;
+};
+
+struct IndexValues
+{
+    template < typename Archive >
+    void serialize( Archive &archive )
+    {
+        archive.ext( *this, geode::DefaultGrowable< Archive, IndexValues >{},
+            []( Archive &archive, IndexValues &values ) {
+                geode::serialize_value( archive, values.value_ );
+                geode::serialize_value( archive, values.values_ );
+            } );
+    }
+    geode::index_t value_{ 10 };
+    std::vector< geode::index_t > values_;
+};
+
+struct RawValues
+{
+    template < typename Archive >
+    void serialize( Archive &archive )
+    {
+        archive.ext( *this, geode::DefaultGrowable< Archive, RawValues >{},
+            []( Archive &archive, RawValues &values ) {
+                archive.value4b( values.value_ );
+                archive.container4b(
+                    values.values_, values.values_.max_size() );
+            } );
+    }
+    uint32_t value_{ 10 };
+    std::vector< uint32_t > values_;
+};
+
 template < typename Out, typename T >
 Out test_growable( const T &foo )
 {
@@ -122,7 +194,7 @@ Out test_growable( const T &foo )
     return new_foo;
 }
 
-void test()
+void test_versions()
 {
     Foo foo;
     foo.double_ = 42.5;
@@ -145,4 +217,61 @@ void test()
     CHECK( foo4.int_, -52 );
 }
 
+void test_indices()
+{
+    RawIndices raw;
+    raw.index_ = 42;
+    raw.no_id_ = std::numeric_limits< uint32_t >::max();
+    raw.large_index_ = 12;
+    raw.indices_ = { 1, std::numeric_limits< uint32_t >::max() };
+    auto indices = test_growable< Indices >( raw );
+    CHECK( indices.index_, 42 );
+    CHECK( indices.no_id_, geode::NO_ID );
+    CHECK( indices.large_index_, 12 );
+    CHECK( indices.indices_.back(), geode::NO_ID );
+
+    indices.large_index_ = geode::NO_ID - 1;
+    indices.indices_ = { 1, geode::NO_ID, geode::NO_ID - 1, 3 };
+    auto indices2 = test_growable< Indices >( indices );
+    CHECK( indices2.index_, 42 );
+    CHECK( indices2.no_id_, geode::NO_ID );
+    CHECK( indices2.large_index_, geode::NO_ID - 1 );
+    OPENGEODE_EXCEPTION( indices2.indices_ == indices.indices_,
+        "[Test] Wrong indices container" );
+
+    indices.large_index_ = 12;
+    indices.indices_ = { 1, geode::NO_ID };
+    auto raw2 = test_growable< RawIndices >( indices );
+    CHECK( raw2.index_, 42 );
+    CHECK( raw2.no_id_, std::numeric_limits< uint32_t >::max() );
+    CHECK( raw2.large_index_, 12 );
+    CHECK( raw2.indices_.back(), std::numeric_limits< uint32_t >::max() );
+}
+
+void test_index_values()
+{
+    const auto escape = std::numeric_limits< uint32_t >::max() - 1;
+    RawValues raw;
+    raw.value_ = escape;
+    raw.values_ = { escape, 3, std::numeric_limits< uint32_t >::max() };
+    auto values = test_growable< IndexValues >( raw );
+    CHECK( values.value_, escape );
+    CHECK( values.values_.size(), 3 );
+    CHECK( values.values_[0], escape );
+    CHECK( values.values_[1], 3 );
+    CHECK( values.values_[2], geode::NO_ID );
+
+    auto raw2 = test_growable< RawValues >( values );
+    CHECK( raw2.value_, escape );
+    OPENGEODE_EXCEPTION(
+        raw2.values_ == raw.values_, "[Test] Wrong raw values container" );
+}
+
+void test()
+{
+    test_versions();
+    test_indices();
+    test_index_values();
+}
+
 OPENGEODE_TEST( "growable" )
\ No newline at end of file
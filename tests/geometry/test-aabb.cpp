@@ -21,6 +21,8 @@
  *
  */
 
+#include <algorithm>
+
 #include <geode/basic/logger.h>
 
 #include <geode/geometry/aabb.h>
@@ -30,6 +32,7 @@
 #include <geode/tests/common.h>
 
 #include <absl/container/flat_hash_set.h>
+#include <absl/strings/str_cat.h>
 
 using namespace geode;
 
@@ -163,6 +166,68 @@ void test_nearest_neighbor_search()
     }
 }
 
+template < index_t dimension >
+void test_k_nearest_and_range_search()
+{
+    geode::Logger::info(
+        "TEST", " K nearest and range boxes to point AABB ", dimension, "D" );
+    const index_t nb_boxes{ 10 };
+    const auto box_vector = create_box_vector< dimension >( nb_boxes, 0.25 );
+    AABBTree< dimension > aabb( box_vector );
+    const BoxAABBEvalDistance< dimension > disteval{ box_vector };
+
+    Point< dimension > query;
+    query.set_value( 0, 4.2 );
+    query.set_value( 1, 5.35 );
+    std::vector< double > distances;
+    for( const auto box : Range{ box_vector.size() } )
+    {
+        distances.push_back( std::get< 0 >( disteval( query, box ) ) );
+    }
+    std::sort( distances.begin(), distances.end() );
+
+    const auto nearest = aabb.closest_element_boxes( query, 5, disteval );
+    OPENGEODE_EXCEPTION( nearest.size() == 5,
+        "[Test] K nearest boxes AABB - Wrong number of boxes" );
+    const std::array< index_t, 5 > expected_boxes{ {
+        global_box_index( 4, 5, nb_boxes ), global_box_index( 4, 6, nb_boxes ),
+        global_box_index( 5, 5, nb_boxes ), global_box_index( 5, 6, nb_boxes ),
+        global_box_index( 3, 5, nb_boxes ) } };
+    for( const auto n : Range{ 5 } )
+    {
+        OPENGEODE_EXCEPTION( std::get< 0 >( nearest[n] ) == expected_boxes[n]
+                                 && std::get< 2 >( nearest[n] ) == distances[n],
+            "[Test] K nearest boxes AABB - Wrong nearest box ", n );
+    }
+    OPENGEODE_EXCEPTION(
+        aabb.closest_element_boxes( query, 1000, disteval ).size()
+            == box_vector.size(),
+        "[Test] K nearest boxes AABB - All boxes should be returned" );
+
+    const double radius{ 1.8 };
+    const auto in_range =
+        aabb.elements_within_distance( query, radius, disteval );
+    const auto nb_in_range = static_cast< index_t >(
+        std::upper_bound( distances.begin(), distances.end(), radius )
+        - distances.begin() );
+    OPENGEODE_EXCEPTION( in_range.size() == nb_in_range,
+        "[Test] Range boxes AABB - Wrong number of boxes" );
+    for( const auto n : Range{ nb_in_range } )
+    {
+        OPENGEODE_EXCEPTION( std::get< 2 >( in_range[n] ) == distances[n],
+            "[Test] Range boxes AABB - Wrong box distance ", n );
+    }
+
+    OPENGEODE_EXCEPTION(
+        std::get< 0 >( aabb.closest_element_box( query, disteval, 0.1 ) )
+            == NO_ID,
+        "[Test] Nearest box AABB - No box should be closer than 0.1" );
+    OPENGEODE_EXCEPTION(
+        std::get< 0 >( aabb.closest_element_box( query, disteval, 0.5 ) )
+            == global_box_index( 4, 5, nb_boxes ),
+        "[Test] Nearest box AABB - Wrong nearest box with max distance" );
+}
+
 template < index_t dimension >
 class BoxAABBIntersection
 {
@@ -426,14 +491,153 @@ void test_self_intersections()
     }
 }
 
+template < index_t dimension >
+class OtherAABBIntersection
+{
+public:
+    void operator()( index_t box, index_t other_box )
+    {
+        pairs_.emplace_back( box, other_box );
+    }
+
+public:
+    std::vector< std::pair< index_t, index_t > > pairs_;
+};
+
+template < index_t dimension >
+void test_other_intersections()
+{
+    geode::Logger::info(
+        "TEST", " Box other tree intersection AABB ", dimension, "D" );
+
+    const index_t nb_boxes{ 10 };
+    const auto box_vector = create_box_vector< dimension >( nb_boxes, 0.75 );
+    AABBTree< dimension > aabb( box_vector );
+    // Grid of smaller boxes shifted by half a cell along the first axis
+    auto box_vector2 = create_box_vector< dimension >( nb_boxes - 1, 0.2 );
+    Point< dimension > shift;
+    shift.set_value( 0, 0.5 );
+    for( auto& box : box_vector2 )
+    {
+        BoundingBox< dimension > shifted_box;
+        shifted_box.add_point( box.min() + shift );
+        shifted_box.add_point( box.max() + shift );
+        box = shifted_box;
+    }
+    AABBTree< dimension > aabb2( box_vector2 );
+
+    OtherAABBIntersection< dimension > eval_intersection;
+    aabb.compute_other_element_bbox_intersections( aabb2, eval_intersection );
+    std::sort(
+        eval_intersection.pairs_.begin(), eval_intersection.pairs_.end() );
+    std::vector< std::pair< index_t, index_t > > expected;
+    for( const auto box : Range{ box_vector.size() } )
+    {
+        for( const auto box2 : Range{ box_vector2.size() } )
+        {
+            if( box_vector[box].intersects( box_vector2[box2] ) )
+            {
+                expected.emplace_back( box, box2 );
+            }
+        }
+    }
+    OPENGEODE_EXCEPTION(
+        !expected.empty() && eval_intersection.pairs_ == expected,
+        "[Test] Box other tree intersection - Wrong intersecting pairs" );
+
+    OtherAABBIntersection< dimension > reversed_intersection;
+    aabb2.compute_other_element_bbox_intersections(
+        aabb, reversed_intersection );
+    OPENGEODE_EXCEPTION(
+        reversed_intersection.pairs_.size() == expected.size(),
+        "[Test] Box other tree intersection - Wrong reversed pairs" );
+}
+
+template < index_t dimension >
+void test_save_and_load()
+{
+    geode::Logger::info( "TEST", " Save and load AABB ", dimension, "D" );
+    const index_t nb_boxes{ 10 };
+    const double box_size{ 0.75 };
+    const auto box_vector =
+        create_box_vector< dimension >( nb_boxes, box_size );
+    const AABBTree< dimension > aabb( box_vector );
+    const auto filename = absl::StrCat( "test_aabb", dimension, "d.bin" );
+    save_aabb_tree( aabb, filename );
+    const auto reloaded = load_aabb_tree< dimension >( filename );
+
+    OPENGEODE_EXCEPTION( reloaded.nb_bboxes() == aabb.nb_bboxes(),
+        "[Test] Save and load AABB - Wrong number of boxes" );
+    OPENGEODE_EXCEPTION( reloaded.is_built_from( box_vector ),
+        "[Test] Save and load AABB - Wrong checksum" );
+    auto moved_boxes = box_vector;
+    moved_boxes.back().add_point( moved_boxes.back().max() * 2. );
+    OPENGEODE_EXCEPTION( !reloaded.is_built_from( moved_boxes ),
+        "[Test] Save and load AABB - Checksum should detect moved boxes" );
+
+    const BoxAABBEvalDistance< dimension > disteval( box_vector );
+    for( const auto& box : box_vector )
+    {
+        const auto query = box.min() * 0.3 + box.max() * 0.7;
+        const auto closest = aabb.closest_element_box( query, disteval );
+        const auto reloaded_closest =
+            reloaded.closest_element_box( query, disteval );
+        OPENGEODE_EXCEPTION(
+            std::get< 0 >( closest ) == std::get< 0 >( reloaded_closest ),
+            "[Test] Save and load AABB - Wrong closest box after reload" );
+    }
+}
+
+template < index_t dimension >
+void test_empty_aabb()
+{
+    geode::Logger::info( "TEST", " Empty AABB ", dimension, "D" );
+    const std::vector< BoundingBox< dimension > > box_vector;
+    const AABBTree< dimension > default_aabb;
+    const AABBTree< dimension > empty_aabb( box_vector );
+    const BoxAABBEvalDistance< dimension > disteval( box_vector );
+    index_t nb_calls{ 0 };
+    const auto count_calls = [&nb_calls]( index_t /*unused*/ ) {
+        nb_calls++;
+    };
+    for( const auto* aabb : { &default_aabb, &empty_aabb } )
+    {
+        OPENGEODE_EXCEPTION( aabb->nb_bboxes() == 0,
+            "[Test] Empty AABB - Wrong number of boxes" );
+        const Point< dimension > query;
+        OPENGEODE_EXCEPTION(
+            std::get< 0 >( aabb->closest_element_box( query, disteval ) )
+                == NO_ID,
+            "[Test] Empty AABB - There should be no closest box" );
+        OPENGEODE_EXCEPTION(
+            aabb->closest_element_boxes( query, 3, disteval ).empty(),
+            "[Test] Empty AABB - There should be no closest boxes" );
+        OPENGEODE_EXCEPTION(
+            aabb->elements_within_distance( query, 1., disteval ).empty(),
+            "[Test] Empty AABB - There should be no boxes within distance" );
+        aabb->compute_bbox_element_bbox_intersections(
+            create_bounding_box( query, 1. ), count_calls );
+        Vector< dimension > direction;
+        direction.set_value( 0, 1 );
+        aabb->compute_ray_element_bbox_intersections(
+            Ray< dimension >{ direction, query }, count_calls );
+    }
+    OPENGEODE_EXCEPTION(
+        nb_calls == 0, "[Test] Empty AABB - There should be no intersection" );
+}
+
 template < index_t dimension >
 void do_test()
 {
     test_build_aabb< dimension >();
     test_nearest_neighbor_search< dimension >();
+    test_k_nearest_and_range_search< dimension >();
     test_intersections_with_query_box< dimension >();
     test_intersections_with_ray_trace< dimension >();
     test_self_intersections< dimension >();
+    test_other_intersections< dimension >();
+    test_save_and_load< dimension >();
+    test_empty_aabb< dimension >();
 }
 
 void test()
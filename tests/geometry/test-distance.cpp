@@ -27,6 +27,7 @@
 #include <geode/geometry/point.h>
 
 #include <geode/geometry/basic_objects.h>
+#include <geode/geometry/batch_distance.h>
 #include <geode/geometry/distance.h>
 
 #include <geode/tests/common.h>
@@ -615,6 +616,105 @@ void test_point_tetra_distance()
         "q3" );
 }
 
+template < geode::index_t dimension >
+geode::Point< dimension > batch_point( geode::index_t seed )
+{
+    geode::Point< dimension > point;
+    for( const auto d : geode::Range{ dimension } )
+    {
+        point.set_value( d, 3 * std::sin( 1.7 * seed + 2.3 * d + 0.1 ) );
+    }
+    return point;
+}
+
+template < geode::index_t dimension >
+void test_batch_distance()
+{
+    std::vector< geode::Point< dimension > > points;
+    for( const auto p : geode::Range{ 90 } )
+    {
+        points.push_back( batch_point< dimension >( p ) );
+    }
+    geode::SegmentBatch< dimension > segments;
+    geode::TriangleBatch< dimension > triangles;
+    for( const auto i : geode::Range{ 10 } )
+    {
+        segments.add( { { points[3 * i], points[3 * i + 1] } } );
+        triangles.add(
+            { { points[3 * i], points[3 * i + 1], points[3 * i + 2] } } );
+    }
+    // Degenerate elements
+    segments.add( { { points[0], points[0] } } );
+    triangles.add( { { points[0], points[1], points[0] } } );
+
+    std::vector< double > distance_values( points.size() );
+    const auto distances = absl::MakeSpan( distance_values );
+    for( const auto q : geode::Range{ 30, points.size() } )
+    {
+        const auto& query = points[q];
+        geode::point_segments_distances( query, segments, distances );
+        for( const auto s : geode::Range{ segments.size() } )
+        {
+            const auto& v0 = points[s < 10 ? 3 * s : 0];
+            const auto& v1 = points[s < 10 ? 3 * s + 1 : 0];
+            const auto expected = std::get< 0 >(
+                geode::point_segment_distance( query, { v0, v1 } ) );
+            OPENGEODE_EXCEPTION(
+                std::fabs( distances[s] - expected ) < geode::global_epsilon,
+                "[Test] Wrong batched point segment distance" );
+        }
+        geode::point_triangles_distances( query, triangles, distances );
+        double min_distance{ std::numeric_limits< double >::max() };
+        for( const auto t : geode::Range{ triangles.size() - 1 } )
+        {
+            const auto expected =
+                std::get< 0 >( geode::point_triangle_distance( query,
+                    { points[3 * t], points[3 * t + 1], points[3 * t + 2] } ) );
+            OPENGEODE_EXCEPTION(
+                std::fabs( distances[t] - expected ) < geode::global_epsilon,
+                "[Test] Wrong batched point triangle distance" );
+            min_distance = std::min( min_distance, expected );
+        }
+        const auto expected_degenerate =
+            std::get< 0 >( geode::point_segment_distance(
+                query, { points[0], points[1] } ) );
+        OPENGEODE_EXCEPTION( std::fabs( distances[triangles.size() - 1]
+                                        - expected_degenerate )
+                                 < geode::global_epsilon,
+            "[Test] Wrong batched distance to degenerate triangle" );
+        min_distance = std::min( min_distance, expected_degenerate );
+        OPENGEODE_EXCEPTION(
+            std::fabs( std::get< 1 >( geode::point_closest_triangle(
+                           query, triangles ) )
+                       - min_distance )
+                < geode::global_epsilon,
+            "[Test] Wrong closest triangle distance" );
+    }
+
+    const geode::Triangle< dimension > triangle{ points[0], points[1],
+        points[2] };
+    geode::points_triangle_distances< dimension >(
+        points, triangle, distances );
+    for( const auto p : geode::Range{ points.size() } )
+    {
+        const auto expected = std::get< 0 >(
+            geode::point_triangle_distance( points[p], triangle ) );
+        OPENGEODE_EXCEPTION(
+            std::fabs( distances[p] - expected ) < geode::global_epsilon,
+            "[Test] Wrong batched points triangle distance" );
+    }
+    const geode::Segment< dimension > segment{ points[0], points[1] };
+    geode::points_segment_distances< dimension >( points, segment, distances );
+    for( const auto p : geode::Range{ points.size() } )
+    {
+        const auto expected = std::get< 0 >(
+            geode::point_segment_distance( points[p], segment ) );
+        OPENGEODE_EXCEPTION(
+            std::fabs( distances[p] - expected ) < geode::global_epsilon,
+            "[Test] Wrong batched points segment distance" );
+    }
+}
+
 void test()
 {
     test_point_segment_distance();
@@ -622,6 +722,8 @@ void test()
     test_point_triangle_distance();
     test_point_tetra_distance();
     test_point_plane_distance();
+    test_batch_distance< 2 >();
+    test_batch_distance< 3 >();
 }
 
 OPENGEODE_TEST( "distance" )
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/intersection_detection.h>
+#include <geode/geometry/point.h>
+
+#include <geode/tests/common.h>
+
+void test_segment_triangle()
+{
+    const geode::Point3D a{ { 0, 0, 0 } };
+    const geode::Point3D b{ { 1, 0, 0 } };
+    const geode::Point3D c{ { 0, 1, 0 } };
+    const geode::Triangle3D triangle{ a, b, c };
+
+    const geode::Point3D above{ { 0.25, 0.25, 1 } };
+    const geode::Point3D below{ { 0.25, 0.25, -1 } };
+    OPENGEODE_EXCEPTION( geode::segment_triangle_intersection_detection(
+                             { above, below }, triangle ),
+        "[Test] Segment crossing the triangle should intersect" );
+    const geode::Point3D outside{ { 1, 1, -1 } };
+    OPENGEODE_EXCEPTION( !geode::segment_triangle_intersection_detection(
+                             { above, outside }, triangle ),
+        "[Test] Segment passing beside the triangle should not intersect" );
+    const geode::Point3D on_edge{ { 0.5, 0.5, 0 } };
+    OPENGEODE_EXCEPTION( geode::segment_triangle_intersection_detection(
+                             { above, on_edge }, triangle ),
+        "[Test] Segment ending on the triangle edge should intersect" );
+    const geode::Point3D far{ { 2, 2, 1 } };
+    OPENGEODE_EXCEPTION( !geode::segment_triangle_intersection_detection(
+                             { above, far }, triangle ),
+        "[Test] Segment above the triangle should not intersect" );
+
+    const geode::Point3D coplanar0{ { -1, 0.5, 0 } };
+    const geode::Point3D coplanar1{ { 2, 0.5, 0 } };
+    const geode::Point3D coplanar2{ { 2, 1.5, 0 } };
+    OPENGEODE_EXCEPTION( geode::segment_triangle_intersection_detection(
+                             { coplanar0, coplanar1 }, triangle ),
+        "[Test] Coplanar segment crossing the triangle should intersect" );
+    OPENGEODE_EXCEPTION( !geode::segment_triangle_intersection_detection(
+                             { coplanar1, coplanar2 }, triangle ),
+        "[Test] Coplanar segment beside the triangle should not intersect" );
+
+    const geode::Point3D collinear{ { 2, 0, 0 } };
+    const geode::Triangle3D degenerate{ a, b, collinear };
+    OPENGEODE_EXCEPTION( !geode::segment_triangle_intersection_detection(
+                             { above, below }, degenerate ),
+        "[Test] Degenerate triangles should not intersect" );
+}
+
+void test_triangle_triangle()
+{
+    const geode::Point3D a{ { 0, 0, 0 } };
+    const geode::Point3D b{ { 1, 0, 0 } };
+    const geode::Point3D c{ { 0, 1, 0 } };
+    const geode::Triangle3D triangle{ a, b, c };
+
+    const geode::Point3D p0{ { 0.2, 0.2, -1 } };
+    const geode::Point3D p1{ { 0.2, 0.2, 1 } };
+    const geode::Point3D p2{ { 2, 2, 1 } };
+    OPENGEODE_EXCEPTION( geode::triangle_triangle_intersection_detection(
+                             triangle, { p0, p1, p2 } ),
+        "[Test] Crossing triangles should intersect" );
+    const geode::Point3D p3{ { 2, 2, -1 } };
+    const geode::Point3D p4{ { 3, 2, 1 } };
+    OPENGEODE_EXCEPTION( !geode::triangle_triangle_intersection_detection(
+                             triangle, { p3, p2, p4 } ),
+        "[Test] Distant triangles should not intersect" );
+    const geode::Point3D p5{ { 0.1, 0.3, 1 } };
+    OPENGEODE_EXCEPTION( !geode::triangle_triangle_intersection_detection(
+                             triangle, { p5, p1, p2 } ),
+        "[Test] Triangles above each other should not intersect" );
+    const geode::Point3D touching{ { 0.5, 0.5, 0 } };
+    OPENGEODE_EXCEPTION( geode::triangle_triangle_intersection_detection(
+                             triangle, { touching, p1, p2 } ),
+        "[Test] Touching triangles should intersect" );
+
+    const geode::Point3D q0{ { 0.1, 0.1, 0 } };
+    const geode::Point3D q1{ { 0.2, 0.1, 0 } };
+    const geode::Point3D q2{ { 0.1, 0.2, 0 } };
+    OPENGEODE_EXCEPTION( geode::triangle_triangle_intersection_detection(
+                             triangle, { q0, q1, q2 } ),
+        "[Test] Coplanar nested triangles should intersect" );
+    OPENGEODE_EXCEPTION( geode::triangle_triangle_intersection_detection(
+                             { q0, q1, q2 }, triangle ),
+        "[Test] Coplanar nesting triangles should intersect" );
+    const geode::Point3D q3{ { 1, 1, 0 } };
+    const geode::Point3D q4{ { 2, 1, 0 } };
+    const geode::Point3D q5{ { 1, 2, 0 } };
+    OPENGEODE_EXCEPTION( !geode::triangle_triangle_intersection_detection(
+                             triangle, { q3, q4, q5 } ),
+        "[Test] Coplanar distant triangles should not intersect" );
+}
+
+void test()
+{
+    test_segment_triangle();
+    test_triangle_triangle();
+}
+
+OPENGEODE_TEST( "intersection-detection" )
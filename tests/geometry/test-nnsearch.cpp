@@ -21,12 +21,92 @@
  *
  */
 
+#include <cmath>
+#include <sstream>
+
 #include <geode/basic/logger.h>
+#include <geode/basic/range.h>
 
 #include <geode/geometry/nn_search.h>
 
 #include <geode/tests/common.h>
 
+void test_save_and_load()
+{
+    // Enough points to span many leaves of the kd-tree
+    constexpr geode::index_t nb_points_per_axis{ 8 };
+    std::vector< geode::Point3D > points;
+    points.reserve(
+        nb_points_per_axis * nb_points_per_axis * nb_points_per_axis );
+    for( const auto i : geode::Range{ nb_points_per_axis } )
+    {
+        for( const auto j : geode::Range{ nb_points_per_axis } )
+        {
+            for( const auto k : geode::Range{ nb_points_per_axis } )
+            {
+                const auto id = static_cast< double >( points.size() );
+                points.push_back( { { i + 0.4 * std::sin( 1.7 * id ),
+                    j + 0.4 * std::cos( 2.3 * id ),
+                    k + 0.4 * std::sin( 0.9 * id + 1. ) } } );
+            }
+        }
+    }
+    const geode::NNSearch3D search{ points };
+    std::stringstream stream;
+    geode::save_nn_search( search, stream );
+    const auto reloaded = geode::load_nn_search< 3 >( stream );
+
+    OPENGEODE_EXCEPTION( reloaded->nb_points() == search.nb_points(),
+        "[Test] Error in reloaded number of points" );
+    OPENGEODE_EXCEPTION( reloaded->is_built_from( points ),
+        "[Test] Error in reloaded checksum" );
+    auto moved_points = points;
+    moved_points.front().set_value( 0, 0.2 );
+    OPENGEODE_EXCEPTION( !reloaded->is_built_from( moved_points ),
+        "[Test] Checksum should detect moved points" );
+    for( const auto& point : points )
+    {
+        const geode::Point3D query{ { point.value( 0 ) + 0.3,
+            point.value( 1 ) - 0.2, point.value( 2 ) } };
+        OPENGEODE_EXCEPTION( reloaded->closest_neighbor( query )
+                                 == search.closest_neighbor( query ),
+            "[Test] Error in reloaded closest neighbor" );
+        OPENGEODE_EXCEPTION(
+            reloaded->neighbors( query, 10 ) == search.neighbors( query, 10 ),
+            "[Test] Error in reloaded neighbors" );
+        OPENGEODE_EXCEPTION( reloaded->radius_neighbors( query, 1.5 )
+                                 == search.radius_neighbors( query, 1.5 ),
+            "[Test] Error in reloaded radius neighbors" );
+    }
+}
+
+void test_truncated_load()
+{
+    std::vector< geode::Point3D > points;
+    for( const auto i : geode::Range{ 64 } )
+    {
+        points.push_back( { { std::sin( 1.3 * i ), std::cos( 0.7 * i ),
+            0.1 * i } } );
+    }
+    const geode::NNSearch3D search{ points };
+    std::stringstream stream;
+    geode::save_nn_search( search, stream );
+    // The kd-tree nodes are stored last: drop the end of the tree
+    const auto content = stream.str();
+    std::stringstream truncated{ content.substr( 0, content.size() - 10 ) };
+    bool has_thrown{ false };
+    try
+    {
+        geode::load_nn_search< 3 >( truncated );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        has_thrown = true;
+    }
+    OPENGEODE_EXCEPTION(
+        has_thrown, "[Test] Loading a truncated NNSearch should fail" );
+}
+
 void test()
 {
     const geode::NNSearch2D search{ { { { 0.1, 4.2 } }, { { 5.9, 7.3 } },
@@ -63,6 +143,9 @@ void test()
     const absl::FixedArray< geode::Point3D > points_answer{ p0, p1, p2, p3 };
     OPENGEODE_EXCEPTION( colocated_info.unique_points == points_answer,
         "[Test] Error in unique points" );
+
+    test_save_and_load();
+    test_truncated_load();
 }
 
 OPENGEODE_TEST( "nnsearch" )
\ No newline at end of file
@@ -21,6 +21,7 @@
  *
  */
 
+#include <geode/basic/attribute_manager.h>
 #include <geode/basic/logger.h>
 
 #include <geode/geometry/point.h>
@@ -54,10 +55,31 @@ void test_operators()
     OPENGEODE_EXCEPTION( answer / 2 == p, "[Test] Points should be equal" );
 }
 
+void test_batch_interpolation()
+{
+    geode::AttributeManager manager;
+    manager.resize( 4 );
+    auto points = manager.find_or_create_attribute< geode::VariableAttribute,
+        geode::Point3D >( "points", geode::Point3D{}, { false, true } );
+    points->set_value( 0, geode::Point3D{ { 0, 0, 0 } } );
+    points->set_value( 1, geode::Point3D{ { 4, 2, 8 } } );
+    points->set_value( 2, geode::Point3D{ { 1, 3, 5 } } );
+
+    geode::AttributeLinearInterpolations interpolations;
+    const std::array< geode::index_t, 3 > indices{ 0, 1, 2 };
+    const std::array< double, 3 > lambdas{ 0.25, 0.25, 0.5 };
+    interpolations.add_interpolation( 3, indices, lambdas );
+    manager.interpolate_attribute_values( interpolations );
+    const geode::Point3D answer{ { 1.5, 2, 4.5 } };
+    OPENGEODE_EXCEPTION( points->value( 3 ) == answer,
+        "[Test] Wrong batch interpolated point" );
+}
+
 void test()
 {
     test_comparison();
     test_operators();
+    test_batch_interpolation();
 }
 
 OPENGEODE_TEST( "point" )
\ No newline at end of file
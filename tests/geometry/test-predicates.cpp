@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cmath>
+
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/basic_objects.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/predicates.h>
+#include <geode/geometry/signed_mensuration.h>
+
+#include <geode/tests/common.h>
+
+void test_orient2d()
+{
+    const geode::Point2D a{ { 0, 0 } };
+    const geode::Point2D b{ { 1, 0 } };
+    const geode::Point2D c{ { 0, 1 } };
+    OPENGEODE_EXCEPTION( geode::orient2d( a, b, c ) == geode::Side::positive,
+        "[Test] Wrong orient2d for counter-clockwise points" );
+    OPENGEODE_EXCEPTION( geode::orient2d( a, c, b ) == geode::Side::negative,
+        "[Test] Wrong orient2d for clockwise points" );
+    OPENGEODE_EXCEPTION(
+        geode::orient2d( a, { { 1, 1 } }, { { 0.1, 0.1 } } )
+            == geode::Side::zero,
+        "[Test] Wrong orient2d for collinear points" );
+
+    // Points closer to the line y = x than the rounding errors of a plain
+    // floating point evaluation
+    const auto ulp = std::ldexp( 1., -53 );
+    const geode::Point2D q{ { 12, 12 } };
+    const geode::Point2D r{ { 24, 24 } };
+    for( const auto i : geode::Range{ 16 } )
+    {
+        for( const auto j : geode::Range{ 16 } )
+        {
+            const geode::Point2D p{ { 0.5 + i * ulp, 0.5 + j * ulp } };
+            const auto expected = i < j ? geode::Side::positive
+                                        : i > j ? geode::Side::negative
+                                                : geode::Side::zero;
+            OPENGEODE_EXCEPTION( geode::orient2d( p, q, r ) == expected,
+                "[Test] Wrong orient2d for nearly collinear points ", i, " ",
+                j );
+        }
+    }
+}
+
+void test_orient3d()
+{
+    const geode::Point3D a{ { 0, 0, 0 } };
+    const geode::Point3D b{ { 1, 0, 0 } };
+    const geode::Point3D c{ { 0, 1, 0 } };
+    const geode::Point3D d{ { 0, 0, 1 } };
+    OPENGEODE_EXCEPTION( geode::tetra_signed_volume( { a, b, c, d } ) > 0
+                             && geode::orient3d( a, b, c, d )
+                                    == geode::Side::positive,
+        "[Test] orient3d should have the sign of tetra_signed_volume" );
+    OPENGEODE_EXCEPTION(
+        geode::orient3d( a, c, b, d ) == geode::Side::negative,
+        "[Test] Wrong orient3d for negative tetra" );
+
+    // Plane z = x + y
+    const geode::Point3D e{ { 1, 0, 1 } };
+    const geode::Point3D f{ { 0, 1, 1 } };
+    OPENGEODE_EXCEPTION(
+        geode::orient3d( a, e, f, { { 2, 3, 5 } } ) == geode::Side::zero,
+        "[Test] Wrong orient3d for coplanar points" );
+    // 0.1 + 0.2 is greater than 0.3 with doubles
+    OPENGEODE_EXCEPTION( geode::orient3d( a, e, f, { { 0.1, 0.2, 0.3 } } )
+                             == geode::Side::negative,
+        "[Test] Wrong orient3d for nearly coplanar points" );
+}
+
+void test_incircle()
+{
+    const geode::Point2D a{ { 0, 0 } };
+    const geode::Point2D b{ { 1, 0 } };
+    const geode::Point2D c{ { 0, 1 } };
+    OPENGEODE_EXCEPTION(
+        geode::incircle( a, b, c, { { 0.5, 0.5 } } ) == geode::Side::positive,
+        "[Test] Wrong incircle for inside point" );
+    OPENGEODE_EXCEPTION(
+        geode::incircle( a, c, b, { { 0.5, 0.5 } } ) == geode::Side::negative,
+        "[Test] Wrong incircle for clockwise circle" );
+    OPENGEODE_EXCEPTION(
+        geode::incircle( a, b, c, { { 2, 2 } } ) == geode::Side::negative,
+        "[Test] Wrong incircle for outside point" );
+    OPENGEODE_EXCEPTION(
+        geode::incircle( a, b, c, { { 1, 1 } } ) == geode::Side::zero,
+        "[Test] Wrong incircle for cocircular point" );
+    OPENGEODE_EXCEPTION(
+        geode::incircle( a, b, c, { { 1, 1 + std::ldexp( 1., -52 ) } } )
+            == geode::Side::negative,
+        "[Test] Wrong incircle for nearly cocircular outside point" );
+    OPENGEODE_EXCEPTION(
+        geode::incircle( a, b, c, { { 1, 1 - std::ldexp( 1., -53 ) } } )
+            == geode::Side::positive,
+        "[Test] Wrong incircle for nearly cocircular inside point" );
+}
+
+void test_insphere()
+{
+    const geode::Point3D a{ { 0, 0, 0 } };
+    const geode::Point3D b{ { 1, 0, 0 } };
+    const geode::Point3D c{ { 0, 1, 0 } };
+    const geode::Point3D d{ { 0, 0, 1 } };
+    OPENGEODE_EXCEPTION( geode::insphere( a, b, c, d, { { 0.25, 0.25, 0.25 } } )
+                             == geode::Side::positive,
+        "[Test] Wrong insphere for inside point" );
+    OPENGEODE_EXCEPTION( geode::insphere( a, c, b, d, { { 0.25, 0.25, 0.25 } } )
+                             == geode::Side::negative,
+        "[Test] Wrong insphere for negative tetra" );
+    OPENGEODE_EXCEPTION(
+        geode::insphere( a, b, c, d, { { 2, 2, 2 } } ) == geode::Side::negative,
+        "[Test] Wrong insphere for outside point" );
+    OPENGEODE_EXCEPTION(
+        geode::insphere( a, b, c, d, { { 1, 1, 1 } } ) == geode::Side::zero,
+        "[Test] Wrong insphere for cospherical point" );
+    OPENGEODE_EXCEPTION(
+        geode::insphere( a, b, c, d, { { 1, 1, 1 + std::ldexp( 1., -52 ) } } )
+            == geode::Side::negative,
+        "[Test] Wrong insphere for nearly cospherical outside point" );
+    OPENGEODE_EXCEPTION(
+        geode::insphere( a, b, c, d, { { 1, 1, 1 - std::ldexp( 1., -53 ) } } )
+            == geode::Side::positive,
+        "[Test] Wrong insphere for nearly cospherical inside point" );
+}
+
+void test_batch()
+{
+    // Grid points: many of them are collinear, coplanar, cocircular or
+    // cospherical with the query simplices
+    std::vector< geode::Point2D > points2d;
+    std::vector< geode::Point3D > points3d;
+    for( const auto i : geode::Range{ 7 } )
+    {
+        for( const auto j : geode::Range{ 7 } )
+        {
+            points2d.push_back( { { 0.5 * i - 1, 0.5 * j - 1 } } );
+            for( const auto k : geode::Range{ 7 } )
+            {
+                points3d.push_back(
+                    { { 0.5 * i - 1, 0.5 * j - 1, 0.1 * k - 0.2 } } );
+            }
+        }
+    }
+    const geode::Point2D a2{ { 0, 0 } };
+    const geode::Point2D b2{ { 1, 0 } };
+    const geode::Point2D c2{ { 0, 1 } };
+    std::vector< geode::Side > sides( points3d.size() );
+    geode::orient2d( a2, b2, points2d, absl::MakeSpan( sides ) );
+    for( const auto p : geode::Range{ points2d.size() } )
+    {
+        OPENGEODE_EXCEPTION(
+            sides[p] == geode::orient2d( a2, b2, points2d[p] ),
+            "[Test] Wrong batch orient2d" );
+    }
+    geode::incircle( a2, b2, c2, points2d, absl::MakeSpan( sides ) );
+    for( const auto p : geode::Range{ points2d.size() } )
+    {
+        OPENGEODE_EXCEPTION(
+            sides[p] == geode::incircle( a2, b2, c2, points2d[p] ),
+            "[Test] Wrong batch incircle" );
+    }
+
+    const geode::Point3D a3{ { 0, 0, 0 } };
+    const geode::Point3D b3{ { 1, 0, 0.1 } };
+    const geode::Point3D c3{ { 0, 1, 0.2 } };
+    const geode::Point3D d3{ { 0, 0, 1 } };
+    geode::orient3d( a3, b3, c3, points3d, absl::MakeSpan( sides ) );
+    for( const auto p : geode::Range{ points3d.size() } )
+    {
+        OPENGEODE_EXCEPTION(
+            sides[p] == geode::orient3d( a3, b3, c3, points3d[p] ),
+            "[Test] Wrong batch orient3d" );
+    }
+    geode::insphere( a3, b3, c3, d3, points3d, absl::MakeSpan( sides ) );
+    for( const auto p : geode::Range{ points3d.size() } )
+    {
+        OPENGEODE_EXCEPTION(
+            sides[p] == geode::insphere( a3, b3, c3, d3, points3d[p] ),
+            "[Test] Wrong batch insphere" );
+    }
+}
+
+void test()
+{
+    test_orient2d();
+    test_orient3d();
+    test_incircle();
+    test_insphere();
+    test_batch();
+}
+
+OPENGEODE_TEST( "predicates" )
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/logger.h>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/helpers/aabb_solid_helpers.h>
+
+#include <geode/geometry/aabb.h>
+#include <geode/geometry/point.h>
+
+#include <geode/tests/common.h>
+
+geode::index_t vertex_id(
+    geode::index_t size, geode::index_t i, geode::index_t j, geode::index_t k )
+{
+    return ( i * size + j ) * size + k;
+}
+
+void add_vertices(
+    geode::TetrahedralSolidBuilder3D& builder, geode::index_t size )
+{
+    builder.create_vertices( size * size * size );
+    for( const auto i : geode::Range{ size } )
+    {
+        for( const auto j : geode::Range{ size } )
+        {
+            for( const auto k : geode::Range{ size } )
+            {
+                builder.set_point( vertex_id( size, i, j, k ),
+                    { { 1. * i, 1. * j, 1. * k } } );
+            }
+        }
+    }
+}
+
+void add_tetrahedra(
+    geode::TetrahedralSolidBuilder3D& builder, geode::index_t size )
+{
+    // Each cube is split in 6 tetrahedra around its main diagonal
+    static constexpr std::array< std::array< geode::index_t, 3 >, 6 >
+        axis_orders{ { { { 0, 1, 2 } }, { { 0, 2, 1 } }, { { 1, 0, 2 } },
+            { { 1, 2, 0 } }, { { 2, 0, 1 } }, { { 2, 1, 0 } } } };
+    const auto nb_cubes = ( size - 1 ) * ( size - 1 ) * ( size - 1 );
+    builder.reserve_tetrahedra( nb_cubes * 6 );
+    for( const auto i : geode::Range{ size - 1 } )
+    {
+        for( const auto j : geode::Range{ size - 1 } )
+        {
+            for( const auto k : geode::Range{ size - 1 } )
+            {
+                for( const auto& order : axis_orders )
+                {
+                    std::array< geode::index_t, 4 > vertices;
+                    std::array< geode::index_t, 3 > cur{ { i, j, k } };
+                    vertices[0] = vertex_id( size, cur[0], cur[1], cur[2] );
+                    for( const auto a : geode::Range{ 3 } )
+                    {
+                        cur[order[a]]++;
+                        vertices[a + 1] =
+                            vertex_id( size, cur[0], cur[1], cur[2] );
+                    }
+                    builder.create_tetrahedron( vertices );
+                }
+            }
+        }
+    }
+}
+
+void check_location( const geode::TetrahedralSolid3D& solid,
+    const geode::Point3D& query,
+    const absl::optional< geode::PolyhedronLocation >& location )
+{
+    OPENGEODE_EXCEPTION( location, "[Test] Point should be located" );
+    geode::Point3D interpolated;
+    for( const auto v : geode::Range{ 4 } )
+    {
+        const auto lambda = location->barycentric_coordinates[v];
+        OPENGEODE_EXCEPTION( lambda >= -geode::global_epsilon,
+            "[Test] Wrong barycentric coordinates" );
+        interpolated = interpolated
+                       + solid.point( solid.polyhedron_vertex(
+                             { location->polyhedron, v } ) )
+                             * lambda;
+    }
+    OPENGEODE_EXCEPTION( interpolated.inexact_equal( query, 1e-10 ),
+        "[Test] Wrong interpolated point" );
+}
+
+void test_containing_polyhedron( const geode::TetrahedralSolid3D& solid,
+    const geode::AABBTree3D& aabb_tree )
+{
+    std::vector< geode::Point3D > queries;
+    for( const auto i : geode::Range{ 10 } )
+    {
+        for( const auto j : geode::Range{ 10 } )
+        {
+            for( const auto k : geode::Range{ 10 } )
+            {
+                queries.push_back(
+                    { { 0.43 * i + 0.01, 0.41 * j + 0.02, 0.39 * k + 0.03 } } );
+            }
+        }
+    }
+    queries.push_back( { { 0, 0, 0 } } );
+    queries.push_back( { { 2, 1, 3 } } );
+    queries.push_back( { { 0.5, 0.5, 0.5 } } );
+
+    const auto locations =
+        geode::containing_polyhedra( aabb_tree, solid, queries );
+    for( const auto q : geode::Range{ queries.size() } )
+    {
+        check_location( solid, queries[q], locations[q] );
+        const auto location =
+            geode::containing_polyhedron( aabb_tree, solid, queries[q] );
+        OPENGEODE_EXCEPTION(
+            location->polyhedron == locations[q]->polyhedron,
+            "[Test] Batched and single queries should match" );
+    }
+
+    OPENGEODE_EXCEPTION( !geode::containing_polyhedron(
+                             aabb_tree, solid, { { 4.5, 1, 1 } } ),
+        "[Test] Point outside the mesh should not be located" );
+    OPENGEODE_EXCEPTION( !geode::containing_polyhedron(
+                             aabb_tree, solid, { { -1e-3, 1, 1 } } ),
+        "[Test] Point outside the mesh should not be located" );
+
+    const geode::AABBTree3D empty_tree;
+    bool mismatch_throws{ false };
+    try
+    {
+        geode::containing_polyhedron( empty_tree, solid, { { 1, 1, 1 } } );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        mismatch_throws = true;
+    }
+    OPENGEODE_EXCEPTION( mismatch_throws,
+        "[Test] Tree built on another mesh should be rejected" );
+}
+
+void test_walk( const geode::TetrahedralSolid3D& solid,
+    const geode::AABBTree3D& aabb_tree )
+{
+    const geode::TetrahedralSolidLocator locator{ solid, aabb_tree };
+    geode::TetrahedralSolidLocator::Hint hint;
+    for( const auto i : geode::Range{ 200 } )
+    {
+        const geode::Point3D query{ { 0.02 * i + 0.001, 0.015 * i + 0.002,
+            3.9 - 0.017 * i } };
+        check_location( solid, query, locator.locate( query, hint ) );
+    }
+
+    const geode::TetrahedralSolidLocator short_locator{ solid, aabb_tree, 2 };
+    geode::TetrahedralSolidLocator::Hint far_hint;
+    far_hint.tetrahedron = 0;
+    const geode::Point3D far_query{ { 3.7, 3.6, 3.5 } };
+    check_location(
+        solid, far_query, short_locator.locate( far_query, far_hint ) );
+    OPENGEODE_EXCEPTION( far_hint.tetrahedron != 0,
+        "[Test] Hint should be updated after fallback" );
+
+    const auto outside = locator.locate( { { 2, 2, 4.1 } }, hint );
+    OPENGEODE_EXCEPTION(
+        !outside, "[Test] Point outside the mesh should not be located" );
+}
+
+void test()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    const geode::index_t size{ 5 };
+    add_vertices( *builder, size );
+    add_tetrahedra( *builder, size );
+    builder->compute_polyhedron_adjacencies();
+
+    const auto aabb_tree = geode::create_aabb_tree( *solid );
+    OPENGEODE_EXCEPTION( aabb_tree.nb_bboxes() == solid->nb_polyhedra(),
+        "[Test] Wrong number of boxes" );
+
+    test_containing_polyhedron( *solid, aabb_tree );
+    test_walk( *solid, aabb_tree );
+}
+
+OPENGEODE_TEST( "aabb-solid-helpers" )
@@ -35,6 +35,7 @@
 
 #include <geode/geometry/aabb.h>
 #include <geode/geometry/point.h>
+#include <geode/geometry/vector.h>
 
 #include <geode/tests/common.h>
 
@@ -124,6 +125,52 @@ void check_surface_tree( const geode::AABBTree< dimension >& tree,
         "[TEST] Wrong nearest point found" );
 }
 
+template < geode::index_t dimension >
+void check_surface_tree_by_blocks( const geode::AABBTree< dimension >& tree,
+    const geode::DistanceToTriangles< dimension >& distances_action,
+    const geode::DistanceToTriangle< dimension >& distance_action,
+    geode::index_t size )
+{
+    for( const auto i : geode::Range{ 4 * size } )
+    {
+        for( const auto j : geode::Range{ 4 * size } )
+        {
+            const auto query = create_vertex< dimension >(
+                0.3 * i - 0.2 * size, 0.3 * j - 0.2 * size );
+            geode::index_t triangle;
+            geode::Point< dimension > nearest_point;
+            double distance;
+            std::tie( triangle, nearest_point, distance ) =
+                tree.closest_element_box_by_blocks(
+                    query, distances_action, distance_action );
+            double expected_distance;
+            std::tie( std::ignore, std::ignore, expected_distance ) =
+                tree.closest_element_box( query, distance_action );
+            OPENGEODE_EXCEPTION( std::fabs( distance - expected_distance )
+                                     < geode::global_epsilon,
+                "[TEST] Wrong distance found by blocks" );
+            double triangle_distance;
+            geode::Point< dimension > triangle_nearest_point;
+            std::tie( triangle_distance, triangle_nearest_point ) =
+                distance_action( query, triangle );
+            OPENGEODE_EXCEPTION(
+                std::fabs( triangle_distance - expected_distance )
+                    < geode::global_epsilon,
+                "[TEST] Wrong triangle found by blocks" );
+            OPENGEODE_EXCEPTION( nearest_point == triangle_nearest_point,
+                "[TEST] Wrong nearest point found by blocks" );
+        }
+    }
+
+    geode::index_t triangle;
+    std::tie( triangle, std::ignore, std::ignore ) =
+        tree.closest_element_box_by_blocks(
+            create_vertex< dimension >( 100, 100 ), distances_action,
+            distance_action, 1. );
+    OPENGEODE_EXCEPTION( triangle == geode::NO_ID,
+        "[TEST] Triangle found further than the maximal distance" );
+}
+
 template < geode::index_t dimension >
 void test_SurfaceAABB()
 {
@@ -142,6 +189,9 @@ void test_SurfaceAABB()
     geode::DistanceToTriangle< dimension > distance_action( *t_surf );
 
     check_surface_tree< dimension >( aabb_tree, distance_action, size );
+    geode::DistanceToTriangles< dimension > distances_action( *t_surf );
+    check_surface_tree_by_blocks< dimension >(
+        aabb_tree, distances_action, distance_action, size );
 }
 
 void test()
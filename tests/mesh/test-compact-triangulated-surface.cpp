@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <cmath>
+
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/point_storage.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/io/detail/compact_triangulated_surface.h>
+#include <geode/mesh/io/triangulated_surface_input.h>
+#include <geode/mesh/io/triangulated_surface_output.h>
+
+#include <geode/tests/common.h>
+
+void test_create( const geode::TriangulatedSurface3D& surface,
+    geode::TriangulatedSurfaceBuilder3D& builder )
+{
+    builder.create_point( { { 0.1, 0.2, 0.3 } } );
+    builder.create_point( { { 2.1, 9.4, 6.7 } } );
+    builder.create_point( { { 7.5, 5.2, 6.3 } } );
+    builder.create_point( { { 8.1, 1.4, 4.7 } } );
+    builder.create_point( { { 4.7, 2.1, 1.3 } } );
+    builder.create_triangle( { 0, 1, 2 } );
+    builder.create_triangle( { 1, 3, 2 } );
+    builder.create_triangle( { 3, 4, 2 } );
+    builder.compute_polygon_adjacencies();
+    OPENGEODE_EXCEPTION( surface.nb_vertices() == 5,
+        "[Test] TriangulatedSurface should have 5 vertices" );
+    OPENGEODE_EXCEPTION( surface.nb_polygons() == 3,
+        "[Test] TriangulatedSurface should have 3 triangles" );
+}
+
+void test_io( const geode::TriangulatedSurface3D& surface,
+    geode::PointStorage storage,
+    double tolerance )
+{
+    const auto filename = absl::StrCat( "test.",
+        geode::detail::compact_triangulated_surface_extension< 3 >(
+            storage ) );
+    geode::save_triangulated_surface( surface, filename );
+    const auto reloaded = geode::load_triangulated_surface< 3 >( filename );
+    OPENGEODE_EXCEPTION( reloaded->nb_vertices() == surface.nb_vertices(),
+        "[Test] Reloaded compact TriangulatedSurface should have ",
+        surface.nb_vertices(), " vertices" );
+    OPENGEODE_EXCEPTION( reloaded->nb_polygons() == surface.nb_polygons(),
+        "[Test] Reloaded compact TriangulatedSurface should have ",
+        surface.nb_polygons(), " polygons" );
+    for( const auto v : geode::Range{ surface.nb_vertices() } )
+    {
+        for( const auto d : geode::Range{ 3 } )
+        {
+            OPENGEODE_EXCEPTION( std::fabs( reloaded->point( v ).value( d )
+                                            - surface.point( v ).value( d ) )
+                                     <= tolerance,
+                "[Test] Reloaded compact TriangulatedSurface vertex "
+                "coordinates are not correct" );
+        }
+    }
+    OPENGEODE_EXCEPTION( reloaded->polygon_vertex( { 2, 1 } ) == 4,
+        "[Test] Reloaded compact TriangulatedSurface polygon vertex is not "
+        "correct" );
+    OPENGEODE_EXCEPTION( reloaded->polygon_adjacent( { 0, 1 } ) == 1,
+        "[Test] Reloaded compact TriangulatedSurface adjacent index is not "
+        "correct" );
+}
+
+void test()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+
+    test_create( *surface, *builder );
+    test_io( *surface, geode::PointStorage::single_precision, 1e-6 );
+    test_io( *surface, geode::PointStorage::quantized, 1e-3 );
+}
+
+OPENGEODE_TEST( "compact-triangulated-surface" )
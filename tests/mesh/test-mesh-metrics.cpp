@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/attribute_manager.h>
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/bounding_box.h>
+#include <geode/geometry/point.h>
+#include <geode/geometry/vector.h>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.h>
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/tetrahedral_solid.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/helpers/mesh_metrics.h>
+
+#include <geode/tests/common.h>
+
+void check_surface_metrics( const geode::TriangulatedSurface3D& surface )
+{
+    const auto areas = geode::polygon_areas( surface );
+    const auto barycenters = geode::polygon_barycenters( surface );
+    for( const auto p : geode::Range{ surface.nb_polygons() } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::fabs( areas->value( p ) - surface.polygon_area( p ) )
+                < geode::global_epsilon,
+            "[Test] Wrong cached polygon area" );
+        OPENGEODE_EXCEPTION(
+            barycenters->value( p ) == surface.polygon_barycenter( p ),
+            "[Test] Wrong cached polygon barycenter" );
+    }
+    const auto lengths = geode::edge_lengths( surface );
+    for( const auto e : geode::Range{ surface.nb_edges() } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::fabs( lengths->value( e ) - surface.edge_length( e ) )
+                < geode::global_epsilon,
+            "[Test] Wrong cached edge length" );
+    }
+}
+
+void test_surface_metrics()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_point( { { 0, 0, 0 } } );
+    builder->create_point( { { 1, 0, 0 } } );
+    builder->create_point( { { 0, 1, 0 } } );
+    builder->create_point( { { 1, 1, 1 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 1, 3, 2 } );
+    check_surface_metrics( *surface );
+
+    const auto area_name =
+        absl::StrCat( geode::metric_attribute_prefix, "polygon_area" );
+    const auto areas = geode::polygon_areas( *surface );
+    OPENGEODE_EXCEPTION( areas == geode::polygon_areas( *surface ),
+        "[Test] Polygon areas should be reused from the cache" );
+    OPENGEODE_EXCEPTION(
+        surface->polygon_attribute_manager().attribute_exists( area_name ),
+        "[Test] Polygon areas should be stored as an attribute" );
+
+    builder->set_point( 3, { { 1, 1, 0 } } );
+    OPENGEODE_EXCEPTION(
+        std::fabs( geode::polygon_areas( *surface )->value( 1 ) - 0.5 )
+            < geode::global_epsilon,
+        "[Test] Wrong polygon area after set_point" );
+    OPENGEODE_EXCEPTION( areas == geode::polygon_areas( *surface ),
+        "[Test] Polygon areas should be computed again in the same "
+        "attribute" );
+    check_surface_metrics( *surface );
+
+    std::vector< bool > to_delete( surface->nb_polygons(), false );
+    to_delete[0] = true;
+    builder->delete_polygons( to_delete );
+    OPENGEODE_EXCEPTION(
+        surface->polygon_attribute_manager().attribute_exists( area_name ),
+        "[Test] Metrics should be kept after polygon deletion" );
+    check_surface_metrics( *surface );
+
+    builder->create_triangle( { 0, 1, 2 } );
+    check_surface_metrics( *surface );
+}
+
+void test_solid_metrics()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( { { 0, 0, 0 } } );
+    builder->create_point( { { 1, 0, 0 } } );
+    builder->create_point( { { 0, 1, 0 } } );
+    builder->create_point( { { 0, 0, 1 } } );
+    builder->create_point( { { 1, 1, 1 } } );
+    builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder->create_tetrahedron( { 1, 2, 3, 4 } );
+
+    const auto barycenters = geode::polyhedron_barycenters( *solid );
+    for( const auto p : geode::Range{ solid->nb_polyhedra() } )
+    {
+        OPENGEODE_EXCEPTION(
+            barycenters->value( p ) == solid->polyhedron_barycenter( p ),
+            "[Test] Wrong cached polyhedron barycenter" );
+    }
+    const auto normals = geode::facet_normals( *solid );
+    for( const auto f : geode::Range{ solid->nb_facets() } )
+    {
+        const geode::Vector3D normal{ normals->value( f ) };
+        OPENGEODE_EXCEPTION(
+            normal.inexact_equal( solid->facet_normal( f ), 1e-12 ),
+            "[Test] Wrong cached facet normal" );
+    }
+    const auto lengths = geode::edge_lengths( *solid );
+    for( const auto e : geode::Range{ solid->nb_edges() } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::fabs( lengths->value( e ) - solid->edge_length( e ) )
+                < geode::global_epsilon,
+            "[Test] Wrong cached edge length" );
+    }
+
+    builder->set_point( 4, { { 2, 2, 2 } } );
+    OPENGEODE_EXCEPTION(
+        geode::polyhedron_barycenters( *solid )->value( 1 )
+            == solid->polyhedron_barycenter( 1 ),
+        "[Test] Wrong polyhedron barycenter after set_point" );
+}
+
+void test_bounding_box()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    const geode::index_t nb_points{ 10000 };
+    builder->create_vertices( nb_points );
+    for( const auto v : geode::Range{ nb_points } )
+    {
+        builder->set_point( v, { { 1. * v, -1. * v, 0.5 * ( v % 7 ) } } );
+    }
+    const auto box = surface->bounding_box();
+    OPENGEODE_EXCEPTION( box.min() == geode::Point3D( { 0, -9999, 0 } )
+                             && box.max() == geode::Point3D( { 9999, 0, 3 } ),
+        "[Test] Wrong surface bounding box" );
+}
+
+void test()
+{
+    test_surface_metrics();
+    test_solid_metrics();
+    test_bounding_box();
+}
+
+OPENGEODE_TEST( "mesh-metrics" )
@@ -134,6 +134,29 @@ std::unique_ptr< geode::PolygonalSurface3D > create_surface()
     return surface;
 }
 
+void test_dense_view( const geode::PolygonalSurface3D& surface )
+{
+    geode::PolygonalSurfaceView3D view{ surface,
+        geode::MeshViewMapping::dense };
+    auto builder = geode::PolygonalSurfaceViewBuilder3D::create( view );
+    const std::array< geode::index_t, 3 > polygons{ 1, 2, 1 };
+    builder->add_viewed_polygons( polygons );
+    OPENGEODE_EXCEPTION( view.nb_polygons() == 2,
+        "[Test] Dense PolygonalSurfaceView should have 2 polygons" );
+    OPENGEODE_EXCEPTION( view.nb_vertices() == 6,
+        "[Test] Dense PolygonalSurfaceView should have 6 vertices" );
+    OPENGEODE_EXCEPTION( view.nb_edges() == 7,
+        "[Test] Dense PolygonalSurfaceView should have 7 edges" );
+    OPENGEODE_EXCEPTION( view.viewed_polygon( 1 ) == 2,
+        "[Test] Dense PolygonalSurfaceView polygon is not correct" );
+    OPENGEODE_EXCEPTION( view.polygon_vertex( { 0, 2 } ) == 2,
+        "[Test] Dense PolygonalSurfaceView PolygonVertex is not correct" );
+    OPENGEODE_EXCEPTION( view.polygon_adjacent( { 0, 0 } ) == 1,
+        "[Test] Dense PolygonalSurfaceView adjacency is not correct" );
+    OPENGEODE_EXCEPTION( !view.polygon_adjacent( { 0, 1 } ),
+        "[Test] Dense PolygonalSurfaceView adjacency is not correct" );
+}
+
 void test()
 {
     auto surface = create_surface();
@@ -143,6 +166,7 @@ void test()
     test_create_viewed_vertices( view, *builder );
     test_create_viewed_polygons( view, *builder );
     test_polygon_adjacencies( view );
+    test_dense_view( *surface );
 }
 
 OPENGEODE_TEST( "polygonal-surface-view" )
\ No newline at end of file
@@ -21,6 +21,8 @@
  *
  */
 
+#include <sstream>
+
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/logger.h>
 
@@ -354,6 +356,55 @@ void test_io( const geode::PolygonalSurface3D& polygonal_surface,
     }
 }
 
+void test_stream_io( const geode::PolygonalSurface3D& polygonal_surface )
+{
+    const auto extension = polygonal_surface.native_extension();
+    std::ostringstream out;
+    geode::save_polygonal_surface( polygonal_surface, out, extension );
+    const auto buffer = out.str();
+
+    std::istringstream in{ buffer };
+    auto new_polygonal_surface =
+        geode::load_polygonal_surface< 3 >( in, extension );
+    OPENGEODE_EXCEPTION( new_polygonal_surface->nb_vertices() == 7
+                             && new_polygonal_surface->nb_polygons() == 3,
+        "[Test] PolygonalSurface reloaded from stream is not correct" );
+
+    new_polygonal_surface = geode::load_polygonal_surface< 3 >(
+        absl::MakeConstSpan( buffer.data(), buffer.size() ), extension );
+    OPENGEODE_EXCEPTION( new_polygonal_surface->nb_vertices() == 7
+                             && new_polygonal_surface->nb_polygons() == 3,
+        "[Test] PolygonalSurface reloaded from buffer is not correct" );
+    OPENGEODE_EXCEPTION( new_polygonal_surface->polygon_edge( { 1, 0 } )
+                             == polygonal_surface.polygon_edge( { 1, 0 } ),
+        "[Test] PolygonalSurface reloaded from buffer has wrong polygon edge "
+        "index" );
+}
+
+void test_memory_usage( const geode::PolygonalSurface3D& polygonal_surface )
+{
+    const auto usage = polygonal_surface.memory_usage();
+    OPENGEODE_EXCEPTION(
+        usage.name == polygonal_surface.impl_name().get(),
+        "[Test] Memory usage root should be named after the mesh type" );
+    for( const auto& name :
+        { "vertices", "polygons", "edges", "polygon_storage" } )
+    {
+        bool found{ false };
+        for( const auto& child : usage.children )
+        {
+            if( child.name == name )
+            {
+                found = true;
+                OPENGEODE_EXCEPTION( child.total() > 0,
+                    "[Test] Memory usage of ", name, " should not be empty" );
+            }
+        }
+        OPENGEODE_EXCEPTION(
+            found, "[Test] Memory usage should report ", name );
+    }
+}
+
 void test_clone( const geode::PolygonalSurface3D& polygonal_surface )
 {
     const auto polygonal_surface2 = polygonal_surface.clone();
@@ -466,11 +517,13 @@ void test()
     test_polygon_area();
     test_polygon_normal();
     test_polygon_vertex_normal();
+    test_memory_usage( *polygonal_surface );
 
     test_io( *polygonal_surface,
         absl::StrCat( "test.", polygonal_surface->native_extension() ) );
     test_backward_io( absl::StrCat( geode::data_path, "/test_v4.",
         polygonal_surface->native_extension() ) );
+    test_stream_io( *polygonal_surface );
 
     test_replace_vertex( *polygonal_surface, *builder );
     test_delete_vertex( *polygonal_surface, *builder );
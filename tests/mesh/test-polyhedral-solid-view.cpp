@@ -159,6 +159,26 @@ std::unique_ptr< geode::PolyhedralSolid3D > create_solid()
     return solid;
 }
 
+void test_dense_view( const geode::PolyhedralSolid3D& solid )
+{
+    geode::PolyhedralSolidView3D view{ solid, geode::MeshViewMapping::dense };
+    auto builder = geode::PolyhedralSolidViewBuilder3D::create( view );
+    const std::array< geode::index_t, 2 > polyhedra{ 0, 2 };
+    builder->add_viewed_polyhedra( polyhedra );
+    OPENGEODE_EXCEPTION( view.nb_polyhedra() == 2,
+        "[Test] Dense PolyhedralSolidView should have 2 polyhedra" );
+    OPENGEODE_EXCEPTION( view.nb_vertices() == 7,
+        "[Test] Dense PolyhedralSolidView should have 7 vertices" );
+    OPENGEODE_EXCEPTION( view.nb_edges() == 12,
+        "[Test] Dense PolyhedralSolidView should have 12 edges" );
+    OPENGEODE_EXCEPTION( view.nb_facets() == 8,
+        "[Test] Dense PolyhedralSolidView should have 8 facets" );
+    OPENGEODE_EXCEPTION( view.viewed_polyhedron( 1 ) == 2,
+        "[Test] Dense PolyhedralSolidView polyhedron is not correct" );
+    OPENGEODE_EXCEPTION( view.polyhedron_adjacent( { 0, 1 } ) == 1,
+        "[Test] Dense PolyhedralSolidView adjacent index is not correct" );
+}
+
 void test()
 {
     auto solid = create_solid();
@@ -168,6 +188,7 @@ void test()
     test_create_viewed_vertices( view, *builder );
     test_create_viewed_polyhedra( view, *builder );
     test_polyhedron_adjacencies( view );
+    test_dense_view( *solid );
 }
 
 OPENGEODE_TEST( "polyhedral-solid-view" )
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include <geode/mesh/core/geode_polyhedral_solid.h>
 #include <geode/mesh/core/geode_tetrahedral_solid.h>
 #include <geode/mesh/core/geode_triangulated_surface.h>
+#include <geode/mesh/io/detail/geode_compact_triangulated_surface_output.h>
 #include <geode/mesh/io/detail/geode_edged_curve_output.h>
 #include <geode/mesh/io/detail/geode_graph_output.h>
 #include <geode/mesh/io/detail/geode_point_set_output.h>
@@ -74,6 +75,18 @@ void test()
     check_register< geode::TriangulatedSurfaceOutputFactory3D >(
         geode::OpenGeodeTriangulatedSurface3D::native_extension_static()
             .data() );
+    check_register< geode::TriangulatedSurfaceOutputFactory2D >(
+        geode::detail::compact_triangulated_surface_extension< 2 >(
+            geode::PointStorage::single_precision ) );
+    check_register< geode::TriangulatedSurfaceOutputFactory3D >(
+        geode::detail::compact_triangulated_surface_extension< 3 >(
+            geode::PointStorage::single_precision ) );
+    check_register< geode::TriangulatedSurfaceOutputFactory2D >(
+        geode::detail::compact_triangulated_surface_extension< 2 >(
+            geode::PointStorage::quantized ) );
+    check_register< geode::TriangulatedSurfaceOutputFactory3D >(
+        geode::detail::compact_triangulated_surface_extension< 3 >(
+            geode::PointStorage::quantized ) );
     check_register< geode::PolyhedralSolidOutputFactory3D >(
         geode::OpenGeodePolyhedralSolid3D::native_extension_static().data() );
     check_register< geode::TetrahedralSolidOutputFactory3D >(
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/attribute_manager.h>
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/builder/polygonal_surface_builder.h>
+#include <geode/mesh/builder/polyhedral_solid_builder.h>
+#include <geode/mesh/core/geode_polygonal_surface.h>
+#include <geode/mesh/core/geode_polyhedral_solid.h>
+#include <geode/mesh/core/polygonal_surface.h>
+#include <geode/mesh/core/polyhedral_solid.h>
+#include <geode/mesh/helpers/reorder_mesh.h>
+
+#include <geode/tests/common.h>
+
+namespace
+{
+    constexpr geode::index_t SIZE = 5;
+    constexpr geode::index_t SCRAMBLE = 7;
+
+    geode::index_t scrambled( geode::index_t id, geode::index_t nb )
+    {
+        return ( id * SCRAMBLE ) % nb;
+    }
+
+    std::vector< geode::index_t > create_grid_points(
+        geode::PolygonalSurfaceBuilder2D& builder )
+    {
+        constexpr auto nb_points = SIZE * SIZE;
+        std::vector< geode::index_t > vertices( nb_points );
+        for( const auto v : geode::Range{ nb_points } )
+        {
+            const auto point = scrambled( v, nb_points );
+            vertices[point] = builder.create_point(
+                { { static_cast< double >( point % SIZE ),
+                    static_cast< double >( point / SIZE ) } } );
+        }
+        return vertices;
+    }
+
+    std::vector< geode::index_t > create_grid_points(
+        geode::PolyhedralSolidBuilder3D& builder )
+    {
+        constexpr auto nb_points = SIZE * SIZE * SIZE;
+        std::vector< geode::index_t > vertices( nb_points );
+        for( const auto v : geode::Range{ nb_points } )
+        {
+            const auto point = scrambled( v, nb_points );
+            vertices[point] = builder.create_point(
+                { { static_cast< double >( point % SIZE ),
+                    static_cast< double >( ( point / SIZE ) % SIZE ),
+                    static_cast< double >( point / ( SIZE * SIZE ) ) } } );
+        }
+        return vertices;
+    }
+} // namespace
+
+std::unique_ptr< geode::PolygonalSurface2D > create_surface()
+{
+    auto surface = geode::PolygonalSurface2D::create(
+        geode::OpenGeodePolygonalSurface2D::impl_name_static() );
+    auto builder = geode::PolygonalSurfaceBuilder2D::create( *surface );
+    const auto vertices = create_grid_points( *builder );
+    constexpr auto nb_cells = ( SIZE - 1 ) * ( SIZE - 1 );
+    for( const auto c : geode::Range{ nb_cells } )
+    {
+        const auto cell = scrambled( c, nb_cells );
+        const auto i = cell % ( SIZE - 1 );
+        const auto j = cell / ( SIZE - 1 );
+        const auto v0 = i + j * SIZE;
+        builder->create_polygon( { vertices[v0], vertices[v0 + 1],
+            vertices[v0 + SIZE + 1], vertices[v0 + SIZE] } );
+    }
+    builder->compute_polygon_adjacencies();
+    return surface;
+}
+
+std::unique_ptr< geode::PolyhedralSolid3D > create_solid()
+{
+    auto solid = geode::PolyhedralSolid3D::create(
+        geode::OpenGeodePolyhedralSolid3D::impl_name_static() );
+    auto builder = geode::PolyhedralSolidBuilder3D::create( *solid );
+    const auto vertices = create_grid_points( *builder );
+    constexpr auto nb_cells = ( SIZE - 1 ) * ( SIZE - 1 ) * ( SIZE - 1 );
+    const std::vector< std::vector< geode::index_t > > facets{ { 0, 3, 2, 1 },
+        { 4, 5, 6, 7 }, { 0, 1, 5, 4 }, { 1, 2, 6, 5 }, { 2, 3, 7, 6 },
+        { 3, 0, 4, 7 } };
+    for( const auto c : geode::Range{ nb_cells } )
+    {
+        const auto cell = scrambled( c, nb_cells );
+        const auto i = cell % ( SIZE - 1 );
+        const auto j = ( cell / ( SIZE - 1 ) ) % ( SIZE - 1 );
+        const auto k = cell / ( ( SIZE - 1 ) * ( SIZE - 1 ) );
+        const auto v0 = i + j * SIZE + k * SIZE * SIZE;
+        const auto v4 = v0 + SIZE * SIZE;
+        builder->create_polyhedron(
+            { vertices[v0], vertices[v0 + 1], vertices[v0 + SIZE + 1],
+                vertices[v0 + SIZE], vertices[v4], vertices[v4 + 1],
+                vertices[v4 + SIZE + 1], vertices[v4 + SIZE] },
+            facets );
+    }
+    builder->compute_polyhedron_adjacencies();
+    return solid;
+}
+
+void test_reorder_attribute()
+{
+    geode::AttributeManager manager;
+    manager.resize( 4 );
+    auto attribute = manager.find_or_create_attribute< geode::VariableAttribute,
+        geode::index_t >( "id", geode::NO_ID );
+    for( const auto i : geode::Range{ 4 } )
+    {
+        attribute->set_value( i, 10 * i );
+    }
+    manager.permute_elements( { 2, 0, 3, 1 } );
+    OPENGEODE_EXCEPTION( attribute->value( 0 ) == 20
+                             && attribute->value( 1 ) == 0
+                             && attribute->value( 2 ) == 30
+                             && attribute->value( 3 ) == 10,
+        "[Test] Wrong attribute values after permutation" );
+}
+
+void test_reorder_surface()
+{
+    auto surface = create_surface();
+    auto builder = geode::PolygonalSurfaceBuilder2D::create( *surface );
+    auto polygon_origin =
+        surface->polygon_attribute_manager()
+            .find_or_create_attribute< geode::VariableAttribute,
+                geode::index_t >( "origin", geode::NO_ID );
+    std::vector< std::vector< geode::Point2D > > polygon_points(
+        surface->nb_polygons() );
+    for( const auto p : geode::Range{ surface->nb_polygons() } )
+    {
+        polygon_origin->set_value( p, p );
+        for( const auto v : geode::Range{ surface->nb_polygon_vertices( p ) } )
+        {
+            polygon_points[p].push_back(
+                surface->point( surface->polygon_vertex( { p, v } ) ) );
+        }
+    }
+
+    const auto vertex_order = geode::hilbert_vertex_ordering( *surface );
+    std::vector< geode::Point2D > points;
+    for( const auto v : vertex_order )
+    {
+        points.push_back( surface->point( v ) );
+    }
+    const auto old2new_vertices = builder->reorder_vertices( vertex_order );
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        OPENGEODE_EXCEPTION( old2new_vertices[vertex_order[v]] == v,
+            "[Test] Wrong returned vertex mapping" );
+        OPENGEODE_EXCEPTION( surface->point( v ) == points[v],
+            "[Test] Wrong vertex point after reordering" );
+    }
+    builder->reorder_polygons( geode::hilbert_polygon_ordering( *surface ) );
+
+    for( const auto p : geode::Range{ surface->nb_polygons() } )
+    {
+        const auto origin = polygon_origin->value( p );
+        for( const auto v : geode::Range{ surface->nb_polygon_vertices( p ) } )
+        {
+            OPENGEODE_EXCEPTION(
+                surface->point( surface->polygon_vertex( { p, v } ) )
+                    == polygon_points[origin][v],
+                "[Test] Wrong polygon vertex after reordering" );
+            const geode::PolygonEdge edge{ p, v };
+            OPENGEODE_EXCEPTION(
+                surface->edge_from_vertices(
+                    { surface->polygon_edge_vertex( edge, 0 ),
+                        surface->polygon_edge_vertex( edge, 1 ) } ),
+                "[Test] Missing edge after reordering" );
+            if( const auto adjacent = surface->polygon_adjacent_edge( edge ) )
+            {
+                OPENGEODE_EXCEPTION(
+                    surface->polygon_adjacent( adjacent.value() ) == p,
+                    "[Test] Wrong polygon adjacency after reordering" );
+            }
+        }
+    }
+    for( const auto v : geode::Range{ surface->nb_vertices() } )
+    {
+        const auto polygon_vertex = surface->polygon_around_vertex( v );
+        OPENGEODE_EXCEPTION( polygon_vertex
+                                 && surface->polygon_vertex(
+                                        polygon_vertex.value() )
+                                        == v,
+            "[Test] Wrong polygon around vertex after reordering" );
+    }
+}
+
+void test_reorder_solid()
+{
+    auto solid = create_solid();
+    auto builder = geode::PolyhedralSolidBuilder3D::create( *solid );
+    auto polyhedron_origin =
+        solid->polyhedron_attribute_manager()
+            .find_or_create_attribute< geode::VariableAttribute,
+                geode::index_t >( "origin", geode::NO_ID );
+    std::vector< std::vector< geode::Point3D > > polyhedron_points(
+        solid->nb_polyhedra() );
+    for( const auto p : geode::Range{ solid->nb_polyhedra() } )
+    {
+        polyhedron_origin->set_value( p, p );
+        for( const auto v :
+            geode::Range{ solid->nb_polyhedron_vertices( p ) } )
+        {
+            polyhedron_points[p].push_back(
+                solid->point( solid->polyhedron_vertex( { p, v } ) ) );
+        }
+    }
+    const auto nb_facets = solid->nb_facets();
+    const auto nb_edges = solid->nb_edges();
+
+    builder->reorder_vertices(
+        geode::reverse_cuthill_mckee_vertex_ordering( *solid ) );
+    builder->reorder_polyhedra( geode::hilbert_polyhedron_ordering( *solid ) );
+
+    OPENGEODE_EXCEPTION( solid->nb_facets() == nb_facets
+                             && solid->nb_edges() == nb_edges,
+        "[Test] Facets and edges should be kept after reordering" );
+    for( const auto p : geode::Range{ solid->nb_polyhedra() } )
+    {
+        const auto origin = polyhedron_origin->value( p );
+        for( const auto v :
+            geode::Range{ solid->nb_polyhedron_vertices( p ) } )
+        {
+            OPENGEODE_EXCEPTION(
+                solid->point( solid->polyhedron_vertex( { p, v } ) )
+                    == polyhedron_points[origin][v],
+                "[Test] Wrong polyhedron vertex after reordering" );
+        }
+        for( const auto f : geode::Range{ solid->nb_polyhedron_facets( p ) } )
+        {
+            const geode::PolyhedronFacet facet{ p, f };
+            geode::PolyhedronFacetVertices facet_vertices;
+            for( const auto v :
+                geode::Range{ solid->nb_polyhedron_facet_vertices( facet ) } )
+            {
+                facet_vertices.push_back(
+                    solid->polyhedron_facet_vertex( { facet, v } ) );
+            }
+            OPENGEODE_EXCEPTION( solid->facet_from_vertices( facet_vertices ),
+                "[Test] Missing facet after reordering" );
+            if( const auto adjacent =
+                    solid->polyhedron_adjacent_facet( facet ) )
+            {
+                OPENGEODE_EXCEPTION(
+                    solid->polyhedron_adjacent( adjacent.value() ) == p,
+                    "[Test] Wrong polyhedron adjacency after reordering" );
+            }
+        }
+    }
+    for( const auto v : geode::Range{ solid->nb_vertices() } )
+    {
+        const auto polyhedron_vertex = solid->polyhedron_around_vertex( v );
+        OPENGEODE_EXCEPTION( polyhedron_vertex
+                                 && solid->polyhedron_vertex(
+                                        polyhedron_vertex.value() )
+                                        == v,
+            "[Test] Wrong polyhedron around vertex after reordering" );
+    }
+}
+
+void test()
+{
+    test_reorder_attribute();
+    test_reorder_surface();
+    test_reorder_solid();
+}
+
+OPENGEODE_TEST( "reorder-mesh" )
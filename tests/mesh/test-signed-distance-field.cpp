@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/attribute_manager.h>
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/regular_grid.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/helpers/signed_distance_field.h>
+
+#include <geode/tests/common.h>
+
+std::unique_ptr< geode::TriangulatedSurface3D > create_unit_cube()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    for( const auto v : geode::Range{ 8 } )
+    {
+        builder->create_point(
+            { { 1. * ( v % 2 ), 1. * ( ( v / 2 ) % 2 ), 1. * ( v / 4 ) } } );
+    }
+    // Faces are oriented with normals pointing outside
+    const std::array< std::array< geode::index_t, 4 >, 6 > faces{ {
+        { { 0, 2, 3, 1 } },
+        { { 4, 5, 7, 6 } },
+        { { 0, 1, 5, 4 } },
+        { { 2, 6, 7, 3 } },
+        { { 0, 4, 6, 2 } },
+        { { 1, 3, 7, 5 } },
+    } };
+    for( const auto& face : faces )
+    {
+        builder->create_triangle( { face[0], face[1], face[2] } );
+        builder->create_triangle( { face[0], face[2], face[3] } );
+    }
+    return surface;
+}
+
+double cube_signed_distance( const geode::Point3D& point )
+{
+    double outside{ 0 };
+    double inside{ std::numeric_limits< double >::max() };
+    for( const auto d : geode::Range{ 3 } )
+    {
+        const auto offset = std::fabs( point.value( d ) - 0.5 ) - 0.5;
+        outside += std::max( offset, 0. ) * std::max( offset, 0. );
+        inside = std::min( inside, -offset );
+    }
+    return outside > 0 ? std::sqrt( outside ) : -inside;
+}
+
+geode::Point3D cell_center(
+    const geode::RegularGrid3D& grid, geode::index_t cell )
+{
+    const auto index = grid.cell_index( cell );
+    auto center = grid.point( index );
+    for( const auto d : geode::Range{ 3 } )
+    {
+        center.set_value( d, center.value( d ) + grid.cell_size( d ) / 2. );
+    }
+    return center;
+}
+
+void test_cell_distances( const geode::RegularGrid3D& grid,
+    const geode::TriangulatedSurface3D& surface )
+{
+    const auto distances =
+        geode::compute_cell_signed_distances( grid, surface, "distance" );
+    for( const auto c : geode::Range{ grid.nb_cells() } )
+    {
+        const auto expected = cube_signed_distance( cell_center( grid, c ) );
+        OPENGEODE_EXCEPTION(
+            std::fabs( distances->value( c ) - expected ) < 1e-10,
+            "[Test] Wrong signed distance at cell ", c );
+    }
+}
+
+void test_narrow_band( const geode::RegularGrid3D& grid,
+    const geode::TriangulatedSurface3D& surface )
+{
+    const double band{ 0.25 };
+    const auto distances = geode::compute_cell_signed_distances(
+        grid, surface, "narrow_distance", band );
+    for( const auto c : geode::Range{ grid.nb_cells() } )
+    {
+        const auto expected = cube_signed_distance( cell_center( grid, c ) );
+        const auto value = distances->value( c );
+        if( std::fabs( expected ) <= band )
+        {
+            OPENGEODE_EXCEPTION( std::fabs( value - expected ) < 1e-10,
+                "[Test] Wrong narrow band signed distance at cell ", c );
+        }
+        else
+        {
+            const auto is_exact = std::fabs( value - expected ) < 1e-10;
+            OPENGEODE_EXCEPTION(
+                is_exact || value == std::copysign( band, expected ),
+                "[Test] Wrong far signed distance at cell ", c );
+        }
+    }
+}
+
+void test_node_distances( const geode::RegularGrid3D& grid,
+    const geode::TriangulatedSurface3D& surface )
+{
+    const auto distances =
+        geode::compute_node_signed_distances( grid, surface );
+    OPENGEODE_EXCEPTION( distances.size() == 21 * 21 * 21,
+        "[Test] Wrong number of node distances" );
+    for( const auto k : geode::Range{ 21 } )
+    {
+        for( const auto j : geode::Range{ 21 } )
+        {
+            for( const auto i : geode::Range{ 21 } )
+            {
+                const auto expected =
+                    cube_signed_distance( grid.point( { i, j, k } ) );
+                // Nodes lying on the surface get a distance close to zero
+                OPENGEODE_EXCEPTION(
+                    std::fabs( distances[i + 21 * ( j + 21 * k )] - expected )
+                        < 1e-7,
+                    "[Test] Wrong signed distance at node ", i, " ", j, " ",
+                    k );
+            }
+        }
+    }
+}
+
+void test()
+{
+    const auto surface = create_unit_cube();
+    const geode::RegularGrid3D grid{ { { -0.5, -0.5, -0.5 } }, { 20, 20, 20 },
+        0.1 };
+    test_cell_distances( grid, *surface );
+    test_narrow_band( grid, *surface );
+    test_node_distances( grid, *surface );
+}
+
+OPENGEODE_TEST( "signed-distance-field" )
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 - 2020 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/logger.h>
+
+#include <geode/geometry/aabb.h>
+#include <geode/geometry/point.h>
+
+#include <geode/mesh/builder/triangulated_surface_builder.h>
+#include <geode/mesh/core/triangulated_surface.h>
+#include <geode/mesh/helpers/aabb_triangulated_surface_helpers.h>
+#include <geode/mesh/helpers/surface_intersections.h>
+
+#include <geode/tests/common.h>
+
+/*!
+ * Create a square grid of 2 x 2 cells split in 8 triangles, with the
+ * given origin and axes
+ */
+std::unique_ptr< geode::TriangulatedSurface3D > create_grid(
+    const geode::Point3D& origin,
+    const geode::Point3D& u,
+    const geode::Point3D& v )
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    for( const auto j : geode::Range{ 3 } )
+    {
+        for( const auto i : geode::Range{ 3 } )
+        {
+            builder->create_point( origin + u * i + v * j );
+        }
+    }
+    for( const auto j : geode::Range{ 2 } )
+    {
+        for( const auto i : geode::Range{ 2 } )
+        {
+            const auto v0 = i + 3 * j;
+            builder->create_triangle( { v0, v0 + 1, v0 + 4 } );
+            builder->create_triangle( { v0, v0 + 4, v0 + 3 } );
+        }
+    }
+    return surface;
+}
+
+void test_self_intersections()
+{
+    auto surface = create_grid(
+        { { 0, 0, 0 } }, { { 1, 0, 0 } }, { { 0, 1, 0 } } );
+    OPENGEODE_EXCEPTION( geode::triangulated_surface_self_intersections(
+                             *surface, geode::create_aabb_tree( *surface ) )
+                             .empty(),
+        "[Test] Adjacent triangles should not be reported" );
+
+    // Triangle piercing the grid around (0.3, 0.6), in triangle 1
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    const auto p0 = builder->create_point( { { 0.3, 0.6, -1 } } );
+    const auto p1 = builder->create_point( { { 0.3, 0.6, 1 } } );
+    const auto p2 = builder->create_point( { { 0.3, 0.7, 1 } } );
+    const auto piercing = builder->create_triangle( { p0, p1, p2 } );
+    // Triangle folded onto triangle 6 along their common edge (4, 8)
+    const auto apex = builder->create_point( { { 1.8, 1.2, 0 } } );
+    const auto folded = builder->create_triangle( { 4, 8, apex } );
+    const auto intersections = geode::triangulated_surface_self_intersections(
+        *surface, geode::create_aabb_tree( *surface ) );
+    const std::vector< std::pair< geode::index_t, geode::index_t > > expected{
+        { 1, piercing }, { 6, folded }
+    };
+    OPENGEODE_EXCEPTION( intersections == expected,
+        "[Test] Wrong self intersections" );
+}
+
+void test_surfaces_intersections()
+{
+    const auto surface = create_grid(
+        { { 0, 0, 0 } }, { { 1, 0, 0 } }, { { 0, 1, 0 } } );
+    // Grid sharing the boundary x = 2 with the first one
+    const auto neighbour = create_grid(
+        { { 2, 0, 0 } }, { { 1, 0, 0 } }, { { 0, 1, 0 } } );
+    OPENGEODE_EXCEPTION(
+        geode::triangulated_surfaces_intersections( *surface,
+            geode::create_aabb_tree( *surface ), *neighbour,
+            geode::create_aabb_tree( *neighbour ) )
+            .empty(),
+        "[Test] Surfaces sharing a boundary should not be reported" );
+
+    // Vertical grid crossing the plane y = 0.5 inside the first cell row
+    const auto crossing = create_grid(
+        { { 0.5, 0.5, -1 } }, { { 0.5, 0, 0 } }, { { 0, 0, 1 } } );
+    const auto surface_tree = geode::create_aabb_tree( *surface );
+    const auto crossing_tree = geode::create_aabb_tree( *crossing );
+    const auto intersections = geode::triangulated_surfaces_intersections(
+        *surface, surface_tree, *crossing, crossing_tree );
+    OPENGEODE_EXCEPTION( !intersections.empty(),
+        "[Test] Crossing surfaces should intersect" );
+    for( const auto& pair : intersections )
+    {
+        OPENGEODE_EXCEPTION( pair.first < 4,
+            "[Test] Only triangles of the first row should be intersected" );
+    }
+    const auto reversed = geode::triangulated_surfaces_intersections(
+        *crossing, crossing_tree, *surface, surface_tree );
+    OPENGEODE_EXCEPTION( reversed.size() == intersections.size(),
+        "[Test] Surfaces intersection should be symmetric" );
+}
+
+void test()
+{
+    test_self_intersections();
+    test_surfaces_intersections();
+}
+
+OPENGEODE_TEST( "surface-intersections" )
@@ -21,6 +21,8 @@
  *
  */
 
+#include <sstream>
+
 #include <geode/basic/attribute_manager.h>
 #include <geode/basic/logger.h>
 
@@ -127,6 +129,46 @@ void test_io(
         geode::OpenGeodeTriangulatedSurface3D::impl_name_static(), filename );
 }
 
+void test_stream_io( const geode::TriangulatedSurface3D& surface )
+{
+    // The extension is given as a view on a longer string so that
+    // it is not null-terminated
+    const auto padded_extension =
+        absl::StrCat( surface.native_extension(), ".padding" );
+    const absl::string_view extension{ padded_extension.data(),
+        surface.native_extension().size() };
+    std::ostringstream out;
+    geode::save_triangulated_surface( surface, out, extension );
+    const auto buffer = out.str();
+
+    std::istringstream in{ buffer };
+    auto new_surface = geode::load_triangulated_surface< 3 >( in, extension );
+    OPENGEODE_EXCEPTION( new_surface->nb_vertices() == 5
+                             && new_surface->nb_polygons() == 3,
+        "[Test] TriangulatedSurface reloaded from stream is not correct" );
+
+    new_surface = geode::load_triangulated_surface< 3 >(
+        absl::MakeConstSpan( buffer.data(), buffer.size() ), extension );
+    OPENGEODE_EXCEPTION( new_surface->nb_vertices() == 5
+                             && new_surface->nb_polygons() == 3,
+        "[Test] TriangulatedSurface reloaded from buffer is not correct" );
+
+    // Two meshes written back to back are read back one after the other
+    std::ostringstream out_twice;
+    geode::save_triangulated_surface( surface, out_twice, extension );
+    geode::save_triangulated_surface( surface, out_twice, extension );
+    std::istringstream in_twice{ out_twice.str() };
+    for( const auto i : geode::Range{ 2 } )
+    {
+        new_surface =
+            geode::load_triangulated_surface< 3 >( in_twice, extension );
+        OPENGEODE_EXCEPTION( new_surface->nb_vertices() == 5
+                                 && new_surface->nb_polygons() == 3,
+            "[Test] TriangulatedSurface ", i,
+            " reloaded from a shared stream is not correct" );
+    }
+}
+
 void test_clone( const geode::TriangulatedSurface3D& surface )
 {
     auto attr_from = surface.edge_attribute_manager()
@@ -204,6 +246,7 @@ void test()
     test_create_polygons( *surface, *builder );
     test_polygon_adjacencies( *surface, *builder );
     test_io( *surface, absl::StrCat( "test.", surface->native_extension() ) );
+    test_stream_io( *surface );
     test_backward_io( absl::StrCat(
         geode::data_path, "/test_v4.", surface->native_extension() ) );
 
@@ -827,6 +827,91 @@ void test_clone( const geode::BRep& brep )
     }
 }
 
+void test_remove_components()
+{
+    geode::BRep model;
+    geode::BRepBuilder builder( model );
+    std::vector< geode::uuid > corners;
+    for( const auto c : geode::Range{ 4 } )
+    {
+        geode_unused( c );
+        corners.push_back( builder.add_corner() );
+        builder.corner_mesh_builder( corners.back() )
+            ->create_point( { { 0, 0, 0 } } );
+    }
+    const auto line = builder.add_line();
+    const auto surface = builder.add_surface();
+    const auto boundary = builder.add_model_boundary();
+    for( const auto& corner : corners )
+    {
+        builder.add_corner_line_boundary_relationship(
+            model.corner( corner ), model.line( line ) );
+    }
+    builder.add_line_surface_boundary_relationship(
+        model.line( line ), model.surface( surface ) );
+    builder.create_unique_vertices( 2 );
+    for( const auto c : geode::Indices{ corners } )
+    {
+        builder.set_unique_vertex(
+            { model.corner( corners[c] ).component_id(), 0 }, c % 2 );
+    }
+
+    const std::array< geode::uuid, 4 > to_remove{ corners[0], corners[3],
+        line, boundary };
+    builder.remove_components( to_remove );
+
+    OPENGEODE_EXCEPTION( model.nb_corners() == 2 && model.nb_lines() == 0
+                             && model.nb_surfaces() == 1
+                             && model.nb_model_boundaries() == 0,
+        "[Test] Wrong number of components after removal" );
+    OPENGEODE_EXCEPTION( model.nb_incidences( corners[1] ) == 0
+                             && model.nb_boundaries( surface ) == 0,
+        "[Test] Relations with removed components should be removed" );
+    OPENGEODE_EXCEPTION(
+        model.component_id( corners[2] ).type()
+            == geode::Corner3D::component_type_static(),
+        "[Test] Wrong component type after removal" );
+    for( const auto uv : geode::Range{ model.nb_unique_vertices() } )
+    {
+        const auto& vertices = model.mesh_component_vertices( uv );
+        OPENGEODE_EXCEPTION( vertices.size() == 1,
+            "[Test] Removed components should be removed from unique "
+            "vertices" );
+        OPENGEODE_EXCEPTION( vertices.front().component_id.id() == corners[1]
+                                 || vertices.front().component_id.id()
+                                        == corners[2],
+            "[Test] Wrong component vertex after removal" );
+    }
+    OPENGEODE_EXCEPTION(
+        model.unique_vertex(
+            { model.corner( corners[2] ).component_id(), 0 } )
+            == 0,
+        "[Test] Wrong unique vertex after removal" );
+}
+
+void test_remove_duplicated_components()
+{
+    geode::BRep model;
+    geode::BRepBuilder builder( model );
+    const auto corner0 = builder.add_corner();
+    const auto corner1 = builder.add_corner();
+    const auto line = builder.add_line();
+    builder.add_corner_line_boundary_relationship(
+        model.corner( corner0 ), model.line( line ) );
+    builder.add_corner_line_boundary_relationship(
+        model.corner( corner1 ), model.line( line ) );
+
+    const std::array< geode::uuid, 3 > to_remove{ corner0, line, corner0 };
+    builder.remove_components( to_remove );
+
+    OPENGEODE_EXCEPTION( model.nb_corners() == 1 && model.nb_lines() == 0,
+        "[Test] Wrong number of components after duplicated removal" );
+    OPENGEODE_EXCEPTION( model.nb_incidences( corner1 ) == 0,
+        "[Test] Relations with removed components should be removed" );
+    OPENGEODE_EXCEPTION( model.corner( corner1 ).id() == corner1,
+        "[Test] Remaining component should still be accessible" );
+}
+
 void test()
 {
     geode::BRep model;
@@ -876,6 +961,9 @@ void test()
 
     geode::BRep model3{ std::move( model2 ) };
     test_moved_brep( model3 );
+
+    test_remove_components();
+    test_remove_duplicated_components();
 }
 
 OPENGEODE_TEST( "brep" )
\ No newline at end of file
@@ -139,6 +139,57 @@ void test_relations( const geode::Relationships& relations,
         "[Test] uuids[0] should be item of uuids[4]" );
 }
 
+void test_compiled_relations( const geode::Relationships& relations,
+    absl::Span< const geode::uuid > uuids )
+{
+    const auto compiled = relations.compile_relationships();
+    OPENGEODE_EXCEPTION( compiled.nb_components() == uuids.size(),
+        "[Test] Compiled relationships should have ", uuids.size(),
+        " components" );
+    for( const auto& uuid : uuids )
+    {
+        const auto c = compiled.component_index( uuid );
+        OPENGEODE_EXCEPTION( compiled.component_id( c ).id() == uuid,
+            "[Test] Wrong compiled component identifier" );
+        OPENGEODE_EXCEPTION(
+            compiled.boundaries( c ).size() == relations.nb_boundaries( uuid ),
+            "[Test] Wrong number of compiled boundaries" );
+        OPENGEODE_EXCEPTION(
+            compiled.incidences( c ).size() == relations.nb_incidences( uuid ),
+            "[Test] Wrong number of compiled incidences" );
+        OPENGEODE_EXCEPTION(
+            compiled.internals( c ).size() == relations.nb_internals( uuid ),
+            "[Test] Wrong number of compiled internals" );
+        OPENGEODE_EXCEPTION( compiled.embeddings( c ).size()
+                                 == relations.nb_embeddings( uuid ),
+            "[Test] Wrong number of compiled embeddings" );
+        OPENGEODE_EXCEPTION(
+            compiled.items( c ).size() == relations.nb_items( uuid ),
+            "[Test] Wrong number of compiled items" );
+        OPENGEODE_EXCEPTION( compiled.collections( c ).size()
+                                 == relations.nb_collections( uuid ),
+            "[Test] Wrong number of compiled collections" );
+        for( const auto boundary : compiled.boundaries( c ) )
+        {
+            OPENGEODE_EXCEPTION(
+                relations.is_boundary( compiled.component_id( boundary ).id(),
+                    uuid ),
+                "[Test] Wrong compiled boundary" );
+        }
+    }
+    const auto c0 = compiled.component_index( uuids[0] );
+    const auto c1 = compiled.component_index( uuids[1] );
+    const auto c4 = compiled.component_index( uuids[4] );
+    OPENGEODE_EXCEPTION( compiled.is_boundary( c0, c1 ),
+        "[Test] uuids[0] should be compiled boundary of uuids[1]" );
+    OPENGEODE_EXCEPTION( !compiled.is_boundary( c1, c0 ),
+        "[Test] uuids[1] should not be compiled boundary of uuids[0]" );
+    OPENGEODE_EXCEPTION( compiled.is_internal( c0, c1 ),
+        "[Test] uuids[0] should be compiled internal of uuids[1]" );
+    OPENGEODE_EXCEPTION( compiled.is_item( c0, c4 ),
+        "[Test] uuids[0] should be compiled item of uuids[4]" );
+}
+
 void test()
 {
     geode::Relationships relationships;
@@ -149,6 +200,7 @@ void test()
     add_internal_relations( relationships, uuids );
     add_items_in_collections( relationships, uuids );
     test_relations( relationships, uuids );
+    test_compiled_relations( relationships, uuids );
 
     relationships.save_relationships( "." );
     geode::Relationships reloaded_relationships;
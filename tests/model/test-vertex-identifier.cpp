@@ -250,6 +250,31 @@ void test_update_unique_vertices()
     }
 }
 
+void test_batch_unique_vertices()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+
+    const auto& surface_id = builder.add_surface();
+    builder.surface_mesh_builder( surface_id )->create_vertices( 4 );
+    const auto surface_cid = provider.surface( surface_id ).component_id();
+    builder.create_unique_vertices( 3 );
+    builder.set_unique_vertex( { surface_cid, 3 }, 0 );
+
+    const std::vector< geode::index_t > unique_vertices{ 2, 1, geode::NO_ID,
+        2 };
+    builder.set_unique_vertices( surface_cid, unique_vertices );
+    const auto result = provider.unique_vertices( surface_cid );
+    OPENGEODE_EXCEPTION(
+        std::equal( result.begin(), result.end(), unique_vertices.begin() ),
+        "[Test] Batch unique vertices are not correct" );
+    OPENGEODE_EXCEPTION(
+        provider.mesh_component_vertices( 0 ).empty()
+            && provider.mesh_component_vertices( 1 ).size() == 1
+            && provider.mesh_component_vertices( 2 ).size() == 2,
+        "[Test] Batch mesh component vertices are not correct" );
+}
+
 void test()
 {
     geode::VertexIdentifier vertex_identifier;
@@ -284,6 +309,7 @@ void test()
     test_save_and_load_unique_vertices( vertex_identifier );
 
     test_update_unique_vertices();
+    test_batch_unique_vertices();
 
     builder.unregister_mesh_component( provider.corner( corner2_id ) );
     builder.register_mesh_component( provider.corner( corner2_id ) );